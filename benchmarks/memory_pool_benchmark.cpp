@@ -0,0 +1,115 @@
+/**
+ * @file memory_pool_benchmark.cpp
+ * @brief Allocation throughput of memory::memory_pool vs operator new across threads
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * Each thread keeps a window of live allocations with mixed sizes
+ * (16 B - 4 KiB) and repeatedly frees a random one and allocates a
+ * replacement, touching the first byte of every block.
+ */
+
+#include <vulkan_stdpar/vulkan_stdpar.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t operations_per_thread = 1 << 19;
+constexpr size_t live_window = 256;
+
+struct new_delete_source {
+    unsigned char* allocate(size_t bytes) {
+        return static_cast<unsigned char*>(::operator new(bytes));
+    }
+    void deallocate(unsigned char* ptr, size_t) {
+        ::operator delete(ptr);
+    }
+};
+
+struct pool_source {
+    vulkan_stdpar::memory::memory_pool<unsigned char>& pool;
+    unsigned char* allocate(size_t bytes) {
+        return pool.allocate(bytes);
+    }
+    void deallocate(unsigned char* ptr, size_t bytes) {
+        pool.deallocate(ptr, bytes);
+    }
+};
+
+template<typename Source>
+void churn(Source source, uint32_t seed) {
+    struct slot {
+        unsigned char* ptr;
+        size_t bytes;
+    };
+    std::vector<slot> live(live_window);
+    uint32_t state = seed * 2654435761u + 1;
+    auto next = [&state] {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    };
+    auto pick_size = [&] { return size_t(16) << (next() % 9); };
+
+    for (auto& s : live) {
+        s.bytes = pick_size();
+        s.ptr = source.allocate(s.bytes);
+        s.ptr[0] = 1;
+    }
+    for (size_t i = 0; i < operations_per_thread; ++i) {
+        slot& s = live[next() % live_window];
+        source.deallocate(s.ptr, s.bytes);
+        s.bytes = pick_size();
+        s.ptr = source.allocate(s.bytes);
+        s.ptr[0] = static_cast<unsigned char>(i);
+    }
+    for (auto& s : live) {
+        source.deallocate(s.ptr, s.bytes);
+    }
+}
+
+template<typename MakeSource>
+double run_mops(size_t num_threads, MakeSource make_source) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] { churn(make_source(), static_cast<uint32_t>(t + 1)); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return 2.0 * operations_per_thread * num_threads / seconds / 1e6;
+}
+
+} // namespace
+
+int main() {
+    vulkan_stdpar::memory::memory_pool<unsigned char> pool;
+    
+    std::cout << "Alloc/free throughput, " << operations_per_thread
+              << " replacements per thread, sizes 16 B - 4 KiB\n";
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "new (Mops/s)"
+              << std::setw(16) << "pool (Mops/s)" << std::setw(10) << "speedup" << "\n";
+    std::cout << std::fixed << std::setprecision(2);
+    
+    for (size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+        double new_mops = run_mops(threads, [] { return new_delete_source{}; });
+        double pool_mops = run_mops(threads, [&] { return pool_source{pool}; });
+        std::cout << std::setw(8) << threads << std::setw(16) << new_mops
+                  << std::setw(16) << pool_mops << std::setw(9) << (pool_mops / new_mops) << "x\n";
+    }
+    
+    std::cout << "Pool peak: " << (pool.get_peak_usage() >> 20) << " MiB\n";
+    return pool.get_allocated() == 0 ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file transform_output_benchmark.cpp
+ * @brief Host-to-device traffic caused by transform's output vector
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * Transforms a vector that is already on the device into outputs in
+ * different states: freshly value-initialized, constructed with no_init,
+ * just written on the host, and empty (sized by transform itself). The
+ * kernel overwrites the whole output range, so none of these should
+ * upload anything; the benchmark reports the time per call and the
+ * host-to-device bytes recorded while it ran. Byte counts need
+ * -DVULKAN_STDPAR_ENABLE_PROFILING; without a SYCL device only the host
+ * fallback is timed.
+ */
+
+#include <vulkan_stdpar/vulkan_stdpar.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+namespace {
+
+constexpr int repetitions = 8;
+
+struct result {
+    double ms;
+    uint64_t uploaded;
+};
+
+/**
+ * @brief Time transform into a new output built by make_output
+ */
+template<typename MakeOutput>
+result measure(const vulkan_stdpar::unified_vector<float>& input, MakeOutput&& make_output) {
+    using vulkan_stdpar::vulkan_par;
+    result best{0.0, 0};
+    for (int r = 0; r < repetitions; ++r) {
+        vulkan_stdpar::unified_vector<float> output = make_output();
+        vulkan_stdpar::profiling::reset_all_counters();
+        auto start = std::chrono::steady_clock::now();
+        vulkan_stdpar::transform<float, float>(vulkan_par, input.cbegin(), input.cend(), output.begin(),
+                                               [](float x) { return x * 2.0f + 1.0f; });
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        uint64_t uploaded = vulkan_stdpar::profiling::get_global_metrics().bytes_copied_to_device;
+        if (r == 0 || elapsed.count() < best.ms) best = result{elapsed.count(), uploaded};
+    }
+    return best;
+}
+
+void print_row(const char* name, const result& r) {
+    std::cout << std::setw(16) << name << std::fixed << std::setprecision(3)
+              << std::setw(12) << r.ms << std::setw(16) << r.uploaded << "\n";
+}
+
+} // namespace
+
+int main() {
+    using vulkan_stdpar::unified_vector;
+
+    std::cout << "Transform output traffic (best of " << repetitions << ")\n";
+#ifndef VULKAN_STDPAR_ENABLE_PROFILING
+    std::cout << "(profiling disabled: build with -DVULKAN_STDPAR_ENABLE_PROFILING for byte counts)\n";
+#endif
+#ifndef VULKAN_STDPAR_USE_SYCL
+    std::cout << "(no SYCL device: timing the host fallback)\n";
+#endif
+
+    for (size_t count = size_t(1) << 16; count <= size_t(1) << 22; count <<= 2) {
+        unified_vector<float> input(count, 1.0f);
+        input.get_engine().sync_to_device();
+
+        std::cout << "\n" << count << " elements\n";
+        std::cout << std::setw(16) << "output" << std::setw(12) << "ms"
+                  << std::setw(16) << "H->D bytes" << "\n";
+        print_row("zeroed", measure(input, [&] { return unified_vector<float>(count); }));
+        print_row("no_init", measure(input, [&] {
+            return unified_vector<float>(count, vulkan_stdpar::no_init);
+        }));
+        print_row("host written", measure(input, [&] {
+            unified_vector<float> output(count, vulkan_stdpar::no_init);
+            std::fill(output.begin(), output.end(), 3.0f);
+            return output;
+        }));
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // The host fallback is std::transform and cannot grow its output
+        print_row("empty", measure(input, [] { return unified_vector<float>(); }));
+#endif
+    }
+    return 0;
+}
@@ -7,6 +7,23 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <numeric>
+
+/**
+ * @brief Element that records its own address, so a bitwise relocation shows
+ */
+struct self_tracking {
+    int value;
+    const self_tracking* self;
+    
+    self_tracking(int v = 0) : value(v), self(this) {}
+    self_tracking(const self_tracking& other) : value(other.value), self(this) {}
+    self_tracking& operator=(const self_tracking& other) {
+        value = other.value;
+        self = this;
+        return *this;
+    }
+};
 
 int main() {
     std::cout << "Vulkan STD-Parallel - Algorithms Demo\n";
@@ -132,6 +149,102 @@ int main() {
                   << ", sqrt(10000)=" << large_data[10000] << "\n\n";
     }
     
+    // Test 7: Policy algorithms on a vector with a custom allocator
+    {
+        std::cout << "🧩 Test 7: vulkan_par with pool_allocator\n";
+        std::cout << std::string(50, '-') << "\n";
+        
+        using pooled = vulkan_stdpar::unified_vector<int, vulkan_stdpar::memory::pool_allocator<int>>;
+        pooled data = {5, 3, 1, 4, 2};
+        vulkan_stdpar::unified_vector<int> squares;
+        
+        std::for_each(vulkan_stdpar::vulkan_par, data.begin(), data.end(), [](int& x) { x += 1; });
+        std::transform(vulkan_stdpar::vulkan_par, data.cbegin(), data.cend(), squares.begin(),
+                       [](int x) { return x * x; });
+        std::sort(vulkan_stdpar::vulkan_par, data.begin(), data.end());
+        int sum = std::reduce(vulkan_stdpar::vulkan_par, squares.cbegin(), squares.cend(), 0);
+        
+        std::cout << "Sorted: ";
+        for (int v : data) std::cout << v << " ";
+        std::cout << "\nSum of squares: " << sum << " (expected: 90)\n\n";
+        if (sum != 90 || data[0] != 2 || data[4] != 6) {
+            std::cerr << "pool_allocator algorithms returned wrong results\n";
+            return 1;
+        }
+    }
+    
+    // Test 8: Insert into the middle of a device-resident vector
+    {
+        std::cout << "📥 Test 8: Mid-vector insert\n";
+        std::cout << std::string(50, '-') << "\n";
+        
+        const size_t N = 1 << 16;
+        vulkan_stdpar::unified_vector<int> data(N, 1, vulkan_stdpar::on_device);
+        bool resident = data.get_engine().is_device_resident();
+        data.insert(data.begin() + N / 2, size_t(3), 7);
+        // The gap is opened on the device; nothing is downloaded
+        bool still_resident = data.get_engine().is_device_resident();
+        
+        std::cout << "Device-resident before/after: " << resident << "/" << still_resident << "\n";
+        if (resident && !still_resident) {
+            std::cerr << "insert downloaded a device-resident vector\n";
+            return 1;
+        }
+        if (data.size() != N + 3 || data[N / 2 - 1] != 1 || data[N / 2] != 7 ||
+            data[N / 2 + 2] != 7 || data[N / 2 + 3] != 1) {
+            std::cerr << "insert returned wrong contents\n";
+            return 1;
+        }
+        std::cout << "Inserted 3 elements at " << N / 2 << "\n\n";
+    }
+    
+    // Test 9: Copy between overlapping ranges of one vector
+    {
+        std::cout << "🔁 Test 9: Overlapping copy\n";
+        std::cout << std::string(50, '-') << "\n";
+        
+        const size_t N = 1 << 17;
+        const size_t K = 1000;
+        vulkan_stdpar::unified_vector<int> left(N);
+        std::iota(left.begin(), left.end(), 0);
+        vulkan_stdpar::unified_vector<int> right(N);
+        std::iota(right.begin(), right.end(), 0);
+        
+        // Shift left, as erase does, and right, as insert does
+        std::copy(left.begin() + K, left.end(), left.begin());
+        std::copy(right.cbegin(), right.cend() - K, right.begin() + K);
+        
+        const auto& l = left;
+        const auto& r = right;
+        for (size_t i = 0; i < N - K; ++i) {
+            if (l.data()[i] != static_cast<int>(i + K) || r.data()[i + K] != static_cast<int>(i)) {
+                std::cerr << "overlapping copy corrupted element " << i << "\n";
+                return 1;
+            }
+        }
+        std::cout << "Shifted " << N - K << " elements in both directions\n\n";
+    }
+    
+    // Test 10: Grow large storage holding non-trivially-copyable elements
+    {
+        std::cout << "📈 Test 10: Growing non-trivial elements\n";
+        std::cout << std::string(50, '-') << "\n";
+        
+        // Well past the mmap threshold, so growth remaps the storage
+        const int N = 400000;
+        vulkan_stdpar::unified_vector<self_tracking> items;
+        for (int i = 0; i < N; ++i) items.push_back(self_tracking(i));
+        
+        const auto& c = items;
+        for (int i = 0; i < N; ++i) {
+            if (c.data()[i].self != &c.data()[i] || c.data()[i].value != i) {
+                std::cerr << "element " << i << " was relocated bitwise\n";
+                return 1;
+            }
+        }
+        std::cout << "Grew to " << N * sizeof(self_tracking) / 1024 << " KiB\n\n";
+    }
+    
     std::cout << "✅ All algorithm tests completed successfully!\n";
     
     return 0;
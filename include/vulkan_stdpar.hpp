@@ -243,6 +243,25 @@ private:
     std::string reason_;
 };
 
+/**
+ * @brief Exception thrown when a file operation fails
+ */
+class io_exception : public vulkan_stdpar_exception {
+public:
+    io_exception(const std::string& path, const std::string& reason)
+        : vulkan_stdpar_exception("I/O error on '" + path + "': " + reason)
+        , path_(path)
+        , reason_(reason)
+    {}
+    
+    const std::string& path() const { return path_; }
+    const std::string& reason() const { return reason_; }
+    
+private:
+    std::string path_;
+    std::string reason_;
+};
+
 /**
  * @brief Error handling macro for try-catch blocks
  * 
@@ -274,6 +293,7 @@ private:
     } while (0)
 #else
 #define VULKAN_STDPAR_ASSERT(condition, message) ((void)0)
+#endif
 
 /**
  * @brief Throw exception with formatted message
@@ -283,7 +303,6 @@ private:
 
 } // namespace vulkan_stdpar
 
-#endif // VULKAN_STDPAR_CORE_EXCEPTIONS_HPP
 
 // ========== core/profiling.hpp ==========
 
@@ -302,6 +321,10 @@ private:
 #include <cstdint>
 #include <atomic>
 #include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 
@@ -318,6 +341,10 @@ struct performance_counters {
     double total_sync_time;                    ///< Cumulative synchronization time (seconds)
     uint64_t cache_hits;                       ///< Sync optimization hits
     uint64_t cache_misses;                     ///< Sync optimization misses
+    uint64_t device_cache_hits;                ///< Device allocations served by the buffer cache
+    uint64_t device_cache_misses;              ///< Device allocations that created a new buffer
+    uint64_t device_evictions;                 ///< Device copies evicted to host by the residency budget
+    uint64_t bytes_evicted;                    ///< Device bytes freed by eviction
     
     /**
      * @brief Default constructor - initializes all counters to zero
@@ -330,6 +357,10 @@ struct performance_counters {
         , total_sync_time(0.0)
         , cache_hits(0)
         , cache_misses(0)
+        , device_cache_hits(0)
+        , device_cache_misses(0)
+        , device_evictions(0)
+        , bytes_evicted(0)
     {}
     
     /**
@@ -343,6 +374,10 @@ struct performance_counters {
         total_sync_time = 0.0;
         cache_hits = 0;
         cache_misses = 0;
+        device_cache_hits = 0;
+        device_cache_misses = 0;
+        device_evictions = 0;
+        bytes_evicted = 0;
     }
     
     /**
@@ -365,6 +400,16 @@ struct performance_counters {
         return static_cast<double>(cache_hits) / static_cast<double>(total);
     }
     
+    /**
+     * @brief Get device buffer cache hit rate
+     * @return Hit ratio (0.0 to 1.0)
+     */
+    double get_device_cache_hit_rate() const {
+        uint64_t total = device_cache_hits + device_cache_misses;
+        if (total == 0) return 0.0;
+        return static_cast<double>(device_cache_hits) / static_cast<double>(total);
+    }
+    
     /**
      * @brief Get average kernel execution time
      * @return Average time in milliseconds
@@ -390,84 +435,206 @@ namespace profiling {
 
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
 
+namespace detail {
+
+/**
+ * @brief Process-wide profiling state
+ *
+ * Every record is applied to the calling thread's counters without locking
+ * and to the global and per-queue aggregates under a mutex. Engines submit
+ * to a single default queue, which is reported as queue 0.
+ */
+struct profiling_state {
+    std::atomic<bool> enabled{true};
+    std::mutex mutex;
+    performance_counters global;
+    std::unordered_map<uint32_t, performance_counters> queues;
+};
+
+inline profiling_state& get_profiling_state() {
+    // Never destroyed so that records from static destructors stay valid
+    static profiling_state* state = new profiling_state();
+    return *state;
+}
+
+inline performance_counters& thread_counters() {
+    static thread_local performance_counters counters;
+    return counters;
+}
+
+template<typename Update>
+void record(Update&& update) {
+    profiling_state& state = get_profiling_state();
+    if (!state.enabled.load(std::memory_order_relaxed)) return;
+    update(thread_counters());
+    std::lock_guard<std::mutex> lock(state.mutex);
+    update(state.global);
+    update(state.queues[0]);
+}
+
+} // namespace detail
+
 /**
  * @brief Enable or disable profiling
  * @param enabled True to enable profiling
  */
-void enable_profiling(bool enabled);
+inline void enable_profiling(bool enabled) {
+    detail::get_profiling_state().enabled.store(enabled, std::memory_order_relaxed);
+}
 
 /**
  * @brief Check if profiling is enabled
  * @return True if profiling is currently enabled
  */
-bool is_profiling_enabled();
+inline bool is_profiling_enabled() {
+    return detail::get_profiling_state().enabled.load(std::memory_order_relaxed);
+}
 
 /**
  * @brief Get thread-local performance counters
  * @return Reference to current thread's counters
  */
-performance_counters& get_thread_counters();
+inline performance_counters& get_thread_counters() {
+    return detail::thread_counters();
+}
 
 /**
  * @brief Get performance metrics for specific queue
- * @param queue_id Queue identifier
+ * @param queue_id Queue identifier (0 is the default queue)
  * @return Performance counters for queue
  */
-performance_counters get_queue_metrics(uint32_t queue_id);
+inline performance_counters get_queue_metrics(uint32_t queue_id) {
+    auto& state = detail::get_profiling_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.queues.find(queue_id);
+    return it == state.queues.end() ? performance_counters() : it->second;
+}
 
 /**
  * @brief Get global aggregated metrics
  * @return Aggregated performance counters across all threads
  */
-performance_counters get_global_metrics();
+inline performance_counters get_global_metrics() {
+    auto& state = detail::get_profiling_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.global;
+}
 
 /**
  * @brief Reset thread-local counters
  */
-void reset_thread_counters();
+inline void reset_thread_counters() {
+    detail::thread_counters().reset();
+}
 
 /**
- * @brief Reset all counters (thread-local and global)
+ * @brief Reset all counters (calling thread's and global)
  */
-void reset_all_counters();
+inline void reset_all_counters() {
+    reset_thread_counters();
+    auto& state = detail::get_profiling_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.global.reset();
+    state.queues.clear();
+}
 
 /**
  * @brief Record kernel launch
  * @param execution_time Kernel execution time in seconds
  */
-void record_kernel_launch(double execution_time);
+inline void record_kernel_launch(double execution_time) {
+    detail::record([&](performance_counters& c) {
+        ++c.kernel_launches;
+        c.total_kernel_time += execution_time;
+    });
+}
 
 /**
  * @brief Record data transfer to device
  * @param bytes Number of bytes transferred
  * @param transfer_time Transfer time in seconds
  */
-void record_transfer_to_device(uint64_t bytes, double transfer_time);
+inline void record_transfer_to_device(uint64_t bytes, double transfer_time) {
+    detail::record([&](performance_counters& c) {
+        c.bytes_copied_to_device += bytes;
+        c.total_sync_time += transfer_time;
+    });
+}
 
 /**
  * @brief Record data transfer from device
  * @param bytes Number of bytes transferred
  * @param transfer_time Transfer time in seconds
  */
-void record_transfer_from_device(uint64_t bytes, double transfer_time);
+inline void record_transfer_from_device(uint64_t bytes, double transfer_time) {
+    detail::record([&](performance_counters& c) {
+        c.bytes_copied_from_device += bytes;
+        c.total_sync_time += transfer_time;
+    });
+}
 
 /**
  * @brief Record synchronization operation
  * @param sync_time Synchronization time in seconds
  * @param cache_hit True if sync was optimized (cache hit)
  */
-void record_sync(double sync_time, bool cache_hit);
+inline void record_sync(double sync_time, bool cache_hit) {
+    detail::record([&](performance_counters& c) {
+        c.total_sync_time += sync_time;
+        ++(cache_hit ? c.cache_hits : c.cache_misses);
+    });
+}
 
 /**
- * @brief Print performance summary to stdout
+ * @brief Record a device buffer cache lookup
+ * @param hit True if a cached allocation was reused
+ */
+inline void record_device_cache(bool hit) {
+    detail::record([&](performance_counters& c) {
+        ++(hit ? c.device_cache_hits : c.device_cache_misses);
+    });
+}
+
+/**
+ * @brief Record eviction of a device copy to host
+ * @param bytes Device bytes freed
  */
-void print_summary();
+inline void record_device_eviction(uint64_t bytes) {
+    detail::record([&](performance_counters& c) {
+        ++c.device_evictions;
+        c.bytes_evicted += bytes;
+    });
+}
 
 /**
  * @brief Get performance summary as string
  * @return Formatted summary string
  */
-std::string get_summary_string();
+inline std::string get_summary_string() {
+    performance_counters c = get_global_metrics();
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "Vulkan STD-Parallel performance summary\n";
+    out << "  Kernel launches:      " << c.kernel_launches
+        << " (avg " << c.get_avg_kernel_time() << " ms)\n";
+    out << "  Host -> device:       " << c.bytes_copied_to_device << " bytes\n";
+    out << "  Device -> host:       " << c.bytes_copied_from_device << " bytes\n";
+    out << "  Sync time:            " << c.total_sync_time * 1000.0 << " ms\n";
+    out << "  Sync hit rate:        " << c.get_efficiency() * 100.0 << " %\n";
+    out << "  Device buffer cache:  " << c.device_cache_hits << " hits, "
+        << c.device_cache_misses << " misses ("
+        << c.get_device_cache_hit_rate() * 100.0 << " %)\n";
+    out << "  Device evictions:     " << c.device_evictions << " ("
+        << c.bytes_evicted << " bytes)\n";
+    return out.str();
+}
+
+/**
+ * @brief Print performance summary to stdout
+ */
+inline void print_summary() {
+    std::cout << get_summary_string();
+}
 
 #else // VULKAN_STDPAR_ENABLE_PROFILING
 
@@ -486,9 +653,12 @@ inline void record_kernel_launch(double) {}
 inline void record_transfer_to_device(uint64_t, double) {}
 inline void record_transfer_from_device(uint64_t, double) {}
 inline void record_sync(double, bool) {}
+inline void record_device_cache(bool) {}
+inline void record_device_eviction(uint64_t) {}
 inline void print_summary() {}
 inline std::string get_summary_string() { return ""; }
 
+#endif // VULKAN_STDPAR_ENABLE_PROFILING
 
 } // namespace profiling
 
@@ -555,2339 +725,9576 @@ private:
 
 } // namespace vulkan_stdpar
 
-#endif // VULKAN_STDPAR_CORE_PROFILING_HPP
 
-// ========== core/versioning_engine.hpp ==========
+// ========== core/device_selection.hpp ==========
 
 /**
- * @file versioning_engine.hpp
- * @brief Memory state management and dirty tracking for unified data structures
+ * @file device_selection.hpp
+ * @brief GPU device enumeration, selection, and management
  * @author Vulkan STD-Parallel Team
  * @version 1.0
  * @date 2025-12-02
  * 
- * This file contains the versioning_engine class that manages memory state
- * transitions and dirty range tracking for unified_vector containers.
+ * This file contains device management functionality including device enumeration,
+ * selection criteria, and queue management for vendor-agnostic GPU access.
  */
 
 
-#include <atomic>
+#include <string>
 #include <vector>
 #include <memory>
-#include <shared_mutex>
+#include <cstdint>
 #include <mutex>
+#include <unordered_map>
 #include <algorithm>
-#include <cassert>
+#include <cstring>
+#include <thread>
 
 #ifdef VULKAN_STDPAR_USE_SYCL
 #include <sycl/sycl.hpp>
+#endif
+
+#ifdef VULKAN_STDPAR_USE_VULKAN
+#include <vulkan/vulkan.h>
+#endif
 
 namespace vulkan_stdpar {
 
+// Forward declarations
+struct device_info;
+struct queue_family_info;
+enum class operation_type;
+
 /**
- * @brief Memory state enumeration for versioning engine
+ * @brief Queue family information for device selection
  */
-enum class memory_state {
-    clean,          ///< Host and device data synchronized
-    host_dirty,     ///< Host has modifications, device needs update
-    device_dirty     ///< Device has modifications, host needs update
+struct queue_family_info {
+    uint32_t family_index;                     ///< Queue family index
+    uint32_t queue_count;                      ///< Number of queues in family
+    bool supports_compute;                     ///< Compute operations support
+    bool supports_transfer;                    ///< Transfer operations support
+    bool supports_graphics;                    ///< Graphics operations support
+    bool supports_sparse_binding;              ///< Sparse memory binding
+    uint32_t timestamp_valid_bits;            ///< Timestamp valid bits
+    uint32_t min_image_transfer_granularity;  ///< Minimum image transfer granularity
+    
+    queue_family_info() 
+        : family_index(0)
+        , queue_count(0)
+        , supports_compute(false)
+        , supports_transfer(false)
+        , supports_graphics(false)
+        , supports_sparse_binding(false)
+        , timestamp_valid_bits(0)
+        , min_image_transfer_granularity(0)
+    {}
 };
 
 /**
- * @brief Represents a contiguous region of modified memory with merge/overlap logic
+ * @brief Queue properties structure
  */
-struct dirty_range {
-    size_t start;        ///< Start index (inclusive)
-    size_t end;          ///< End index (exclusive)
+struct queue_properties {
+    uint32_t queue_family_index;
+    bool supports_compute;
+    bool supports_transfer;
+    bool supports_timeline_semaphores;
+    size_t min_sub_group_size;
+    size_t max_sub_group_size;
+    size_t preferred_work_group_size_multiple;
     
-    /**
-     * @brief Construct a dirty range
-     * @param start Start index (inclusive)
-     * @param end End index (exclusive)
-     */
-    dirty_range(size_t start = 0, size_t end = 0) : start(start), end(end) {
-        assert(start <= end);
-    }
+    queue_properties()
+        : queue_family_index(0)
+        , supports_compute(false)
+        , supports_transfer(false)
+        , supports_timeline_semaphores(false)
+        , min_sub_group_size(1)
+        , max_sub_group_size(32)
+        , preferred_work_group_size_multiple(32)
+    {}
+};
+
+/**
+ * @brief Device information structure
+ */
+struct device_info {
+    // Basic identification
+    std::string name;                          ///< Device name
+    std::string vendor;                        ///< Vendor name
+    std::string driver_version;                ///< Driver version string
+    std::string api_version;                   ///< Vulkan API version
     
-    /**
-     * @brief Check if this range overlaps with another
-     * @param other Other range to check
-     * @return True if ranges overlap
-     */
-    bool overlaps(const dirty_range& other) const {
-        return start < other.end && other.start < end;
+    // Hardware capabilities
+    size_t memory_size;                        ///< Total device memory (bytes)
+    size_t max_compute_units;                  ///< Number of compute units
+    size_t max_work_group_size;                ///< Maximum work-group size
+    size_t max_work_items_per_compute_unit;    ///< Max work items per CU
+    uint32_t max_compute_work_group_count[3];  ///< Max compute work group count
+    
+    // Feature support
+    bool supports_timeline_semaphores;         ///< Timeline semaphore support
+    bool supports_pinned_memory;               ///< Host-coherent memory support
+    bool host_unified_memory;                  ///< Device memory is host memory (zero-copy)
+    bool supports_sub_groups;                  ///< Sub-group operations
+    bool supports_fp16;                        ///< Half-precision floating point
+    bool supports_fp64;                        ///< Double-precision floating point
+    bool supports_int8;                        ///< 8-bit integer operations
+    bool supports_int16;                       ///< 16-bit integer operations
+    bool supports_int64;                       ///< 64-bit integer operations
+    
+    // Queue families
+    std::vector<queue_family_info> queue_families; ///< Available queue families
+    
+    // Performance characteristics
+    double peak_performance;                   ///< Theoretical peak GFLOPS
+    double memory_bandwidth;                   ///< Memory bandwidth GB/s
+    uint32_t clock_frequency;                  ///< Core clock frequency (MHz)
+    
+    device_info() 
+        : memory_size(0)
+        , max_compute_units(0)
+        , max_work_group_size(0)
+        , max_work_items_per_compute_unit(0)
+        , supports_timeline_semaphores(false)
+        , supports_pinned_memory(false)
+        , host_unified_memory(false)
+        , supports_sub_groups(false)
+        , supports_fp16(false)
+        , supports_fp64(false)
+        , supports_int8(false)
+        , supports_int16(false)
+        , supports_int64(false)
+        , peak_performance(0.0)
+        , memory_bandwidth(0.0)
+        , clock_frequency(0)
+    {
+        max_compute_work_group_count[0] = 0;
+        max_compute_work_group_count[1] = 0;
+        max_compute_work_group_count[2] = 0;
     }
     
     /**
-     * @brief Check if this range is adjacent to another
-     * @param other Other range to check
-     * @return True if ranges are adjacent
+     * @brief Check if device is suitable for compute operations
+     * @return True if device meets minimum requirements
      */
-    bool adjacent(const dirty_range& other) const {
-        return end == other.start || other.end == start;
+    bool is_suitable() const {
+        return supports_compute() && 
+               // has_compute_queue_family() && // Relaxed check for CPU fallback
+               memory_size > 0;
     }
     
     /**
-     * @brief Merge this range with another
-     * @param other Other range to merge with
-     * @return Merged range
+     * @brief Calculate performance score for device selection
+     * @return Performance score (higher is better)
      */
-    dirty_range merge(const dirty_range& other) const {
-        return dirty_range(std::min(start, other.start), std::max(end, other.end));
+    double performance_score() const {
+        double score = 0.0;
+        
+        // Memory size (30% weight)
+        score += (memory_size / (1024.0 * 1024.0 * 1024.0)) * 0.3;
+        
+        // Compute units (25% weight)
+        score += max_compute_units * 0.25;
+        
+        // Peak performance (25% weight)
+        score += peak_performance * 0.01;
+        
+        // Memory bandwidth (20% weight)
+        score += memory_bandwidth * 0.02;
+        
+        return score;
     }
     
     /**
-     * @brief Get the size of this range
-     * @return Range size in elements
+     * @brief Get device summary string
+     * @return Formatted device summary
      */
-    size_t size() const {
-        return end - start;
+    std::string get_summary() const {
+        return name + " (" + vendor + ", " + 
+               std::to_string(memory_size / (1024*1024*1024)) + "GB)";
     }
     
-    /**
-     * @brief Check if this range is empty
-     * @return True if range is empty
-     */
-    bool empty() const {
-        return start >= end;
+private:
+    bool supports_compute() const {
+        if (queue_families.empty()) return true; // Assume true if no queue info (CPU fallback)
+        for (const auto& family : queue_families) {
+            if (family.supports_compute) return true;
+        }
+        return false;
     }
     
-    /**
-     * @brief Check if this range contains an index
-     * @param index Index to check
-     * @return True if index is within range
-     */
-    bool contains(size_t index) const {
-        return index >= start && index < end;
+    bool has_compute_queue_family() const {
+        if (queue_families.empty()) return true; // Assume true if no queue info
+        for (const auto& family : queue_families) {
+            if (family.supports_compute && family.queue_count > 0) return true;
+        }
+        return false;
     }
 };
 
 /**
- * @brief Memory state manager with dirty range tracking
- * @tparam T Element type
+ * @brief Operation type for queue selection
  */
-template<typename T>
-class versioning_engine {
-public:
-    using value_type = T;
-    using size_type = size_t;
+enum class operation_type {
+    compute,
+    transfer,
+    mixed
+};
+
+/**
+ * @brief Device management namespace
+ */
+namespace device {
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+
+/**
+ * @brief Convert SYCL device to device_info
+ */
+inline device_info sycl_device_to_info(const sycl::device& dev) {
+    device_info info;
     
-private:
-    mutable std::atomic<memory_state> state_;     ///< Current memory state
-    mutable std::vector<dirty_range> dirty_ranges_; ///< Modified regions
-    mutable std::shared_mutex mutex_;             ///< Thread safety
+    info.name = dev.get_info<sycl::info::device::name>();
+    info.vendor = dev.get_info<sycl::info::device::vendor>();
     
-#ifdef VULKAN_STDPAR_USE_SYCL
-    sycl::buffer<T> device_buffer_;            ///< Device memory buffer
-#endif
-    std::vector<T> host_data_;                  ///< Host memory storage
-    size_type capacity_;                         ///< Allocated capacity
-    bool device_allocated_;                       ///< Device buffer allocation flag
+    // Get memory size
+    info.memory_size = dev.get_info<sycl::info::device::global_mem_size>();
     
-public:
-    /**
-     * @brief Construct versioning engine
-     * @param capacity Initial capacity
-     */
-    explicit versioning_engine(size_type capacity = 0)
-        : state_(memory_state::clean)
-        , capacity_(capacity)
-        , device_allocated_(false)
-    {
-        host_data_.reserve(capacity_);
-    }
+    // Get compute units
+    info.max_compute_units = dev.get_info<sycl::info::device::max_compute_units>();
     
-    /**
-     * @brief Destructor - ensures proper cleanup
-     */
-    ~versioning_engine() {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        sync_to_host_impl(lock);
-    }
+    // Get work group size
+    info.max_work_group_size = dev.get_info<sycl::info::device::max_work_group_size>();
     
-    // Non-copyable but movable
-    versioning_engine(const versioning_engine&) = delete;
-    versioning_engine& operator=(const versioning_engine&) = delete;
+    // Feature support
+    info.supports_fp64 = dev.has(sycl::aspect::fp64);
+    info.supports_fp16 = dev.has(sycl::aspect::fp16);
+    info.supports_pinned_memory = dev.has(sycl::aspect::usm_host_allocations);
+    info.host_unified_memory = dev.is_cpu();
     
-    versioning_engine(versioning_engine&& other) noexcept
-        : state_(other.state_.load())
-        , dirty_ranges_(std::move(other.dirty_ranges_))
-        , host_data_(std::move(other.host_data_))
-#ifdef VULKAN_STDPAR_USE_SYCL
-        , device_buffer_(std::move(other.device_buffer_))
-#endif
-        , capacity_(other.capacity_)
-        , device_allocated_(other.device_allocated_)
-    {
-        other.capacity_ = 0;
-        other.device_allocated_ = false;
-        other.state_.store(memory_state::clean);
-    }
+    return info;
+}
+
+inline std::vector<device_info> enumerate_devices() {
+    std::vector<device_info> devices;
     
-    versioning_engine& operator=(versioning_engine&& other) noexcept {
-        if (this != &other) {
-            std::unique_lock<std::shared_mutex> lock1(mutex_, std::defer_lock);
-            std::unique_lock<std::shared_mutex> lock2(other.mutex_, std::defer_lock);
-            std::lock(lock1, lock2);
-            
-            state_ = other.state_.load();
-            dirty_ranges_ = std::move(other.dirty_ranges_);
-            host_data_ = std::move(other.host_data_);
-#ifdef VULKAN_STDPAR_USE_SYCL
-            device_buffer_ = std::move(other.device_buffer_);
-#endif
-            capacity_ = other.capacity_;
-            device_allocated_ = other.device_allocated_;
-            
-            other.capacity_ = 0;
-            other.device_allocated_ = false;
-            other.state_.store(memory_state::clean);
+    try {
+        auto platforms = sycl::platform::get_platforms();
+        for (const auto& platform : platforms) {
+            auto devs = platform.get_devices();
+            for (const auto& dev : devs) {
+                devices.push_back(sycl_device_to_info(dev));
+            }
         }
-        return *this;
+    } catch (const sycl::exception& e) {
+        // No devices available
     }
     
-    /**
-     * @brief Get current memory state
-     * @return Current memory state
-     */
-    memory_state get_memory_state() const noexcept {
-        return state_.load(std::memory_order_acquire);
-    }
+    return devices;
+}
+
+inline std::vector<device_info> enumerate_suitable_devices() {
+    auto all_devices = enumerate_devices();
+    std::vector<device_info> suitable;
     
-    /**
-     * @brief Check if device memory is dirty
-     * @return True if device has modifications
-     */
-    bool is_device_dirty() const noexcept {
-        return get_memory_state() == memory_state::device_dirty;
-    }
+    std::copy_if(all_devices.begin(), all_devices.end(),
+                std::back_inserter(suitable),
+                [](const device_info& dev) { return dev.is_suitable(); });
     
-    /**
-     * @brief Check if host memory is dirty
-     * @return True if host has modifications
-     */
-    bool is_host_dirty() const noexcept {
-        return get_memory_state() == memory_state::host_dirty;
+    return suitable;
+}
+
+inline device_info get_default_device() {
+    try {
+        sycl::device dev = sycl::device::get_devices(sycl::info::device_type::gpu)[0];
+        return sycl_device_to_info(dev);
+    } catch (...) {
+        try {
+            // Fallback to CPU
+            sycl::device dev = sycl::device::get_devices(sycl::info::device_type::cpu)[0];
+            return sycl_device_to_info(dev);
+        } catch (...) {
+            throw device_not_found_exception("No devices available");
+        }
     }
+}
+
+#else // !VULKAN_STDPAR_USE_SYCL
+
+// CPU-only fallback implementations
+
+inline std::vector<device_info> enumerate_devices() {
+    device_info cpu_device;
+    cpu_device.name = "CPU (Fallback)";
+    cpu_device.vendor = "Standard C++";
+    cpu_device.memory_size = 1024ULL * 1024 * 1024 * 16;  // Assume 16GB
+    cpu_device.max_compute_units = std::thread::hardware_concurrency();
+    cpu_device.max_work_group_size = 1;
+    cpu_device.host_unified_memory = true;
     
-    /**
-     * @brief Check if memory is clean
-     * @return True if host and device are synchronized
-     */
-    bool is_clean() const noexcept {
-        return get_memory_state() == memory_state::clean;
+    return {cpu_device};
+}
+
+inline std::vector<device_info> enumerate_suitable_devices() {
+    return enumerate_devices();
+}
+
+inline device_info get_default_device() {
+    auto devices = enumerate_devices();
+    if (devices.empty()) {
+        throw device_not_found_exception("No devices available");
     }
+    return devices[0];
+}
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+inline device_info select_by_name(const std::string& device_name) {
+    auto devices = enumerate_devices();
+    auto it = std::find_if(devices.begin(), devices.end(),
+                          [&device_name](const device_info& dev) {
+                              return dev.name.find(device_name) != std::string::npos;
+                          });
     
-    /**
-     * @brief Mark memory as host dirty
-     * @param start Start index of dirty region
-     * @param end End index of dirty region
-     */
-    void mark_host_dirty(size_type start, size_type end) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        mark_host_dirty_impl(lock, start, end);
+    if (it == devices.end()) {
+        throw device_not_found_exception("Device not found: " + device_name);
     }
     
-    /**
-     * @brief Mark memory as device dirty
-     */
-    void mark_device_dirty() {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        mark_device_dirty_impl(lock);
-    }
+    return *it;
+}
+
+inline device_info select_by_vendor(const std::string& vendor_name) {
+    auto devices = enumerate_devices();
+    auto it = std::find_if(devices.begin(), devices.end(),
+                          [&vendor_name](const device_info& dev) {
+                              return dev.vendor.find(vendor_name) != std::string::npos;
+                          });
     
-    /**
-     * @brief Synchronize host modifications to device
-     */
-    void sync_to_device() const {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        sync_to_device_impl(lock);
+    if (it == devices.end()) {
+        throw device_not_found_exception("Vendor not found: " + vendor_name);
     }
     
-    /**
-     * @brief Synchronize device modifications to host
-     */
-    void sync_to_host() const {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        sync_to_host_impl(lock);
-    }
+    return *it;
+}
+
+inline device_info select_by_memory(size_t minimum_memory) {
+    auto devices = enumerate_devices();
+    auto it = std::find_if(devices.begin(), devices.end(),
+                          [minimum_memory](const device_info& dev) {
+                              return dev.memory_size >= minimum_memory;
+                          });
     
-    /**
-     * @brief Resize storage capacity
-     * @param new_capacity New capacity
-     */
-    void resize(size_type new_capacity) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        resize_impl(lock, new_capacity);
+    if (it == devices.end()) {
+        throw device_not_found_exception("No device with sufficient memory");
     }
     
-    /**
-     * @brief Get current capacity
-     * @return Current capacity
-     */
-    size_type capacity() const noexcept {
-        return capacity_;
-    }
+    return *it;
+}
+
+inline device_info select_by_performance(double min_performance_score) {
+    auto devices = enumerate_devices();
+    auto it = std::find_if(devices.begin(), devices.end(),
+                          [min_performance_score](const device_info& dev) {
+                              return dev.performance_score() >= min_performance_score;
+                          });
     
-    /**
-     * @brief Get host data pointer (read-only access)
-     * @return Pointer to host data
-     */
-    const T* host_data() const {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        return host_data_.data();
+    if (it == devices.end()) {
+        throw device_not_found_exception("No device with sufficient performance");
     }
     
-    /**
-     * @brief Get host data pointer (write access)
-     * @return Pointer to host data
-     */
-    T* host_data() {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        return host_data_.data();
+    return *it;
+}
+
+inline device_info select_optimal_device(operation_type, size_t) {
+    // For now, just return default device
+    return get_default_device();
+}
+
+inline std::vector<device_info> rank_devices_by_performance() {
+    auto devices = enumerate_devices();
+    std::sort(devices.begin(), devices.end(),
+             [](const device_info& a, const device_info& b) {
+                 return a.performance_score() > b.performance_score();
+             });
+    return devices;
+}
+
+inline std::vector<device_info> rank_devices_by_memory() {
+    auto devices = enumerate_devices();
+    std::sort(devices.begin(), devices.end(),
+             [](const device_info& a, const device_info& b) {
+                 return a.memory_size > b.memory_size;
+             });
+    return devices;
+}
+
+inline bool validate_device(const device_info& device) {
+    return device.is_suitable();
+}
+
+inline bool is_device_available(const device_info& device) {
+    auto devices = enumerate_devices();
+    return std::any_of(devices.begin(), devices.end(),
+                      [&device](const device_info& dev) {
+                          return dev.name == device.name;
+                      });
+}
+
+inline std::string get_device_status(const device_info& device) {
+    if (!is_device_available(device)) {
+        return "unavailable";
     }
-    
+    if (!validate_device(device)) {
+        return "unsuitable";
+    }
+    return "ready";
+}
+
+} // namespace device
+
+/**
+ * @brief Queue management namespace
+ */
+namespace queue {
+
 #ifdef VULKAN_STDPAR_USE_SYCL
-    /**
-     * @brief Get device buffer
-     * @return Reference to device buffer
-     */
-    sycl::buffer<T>& get_device_buffer() {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        ensure_device_allocated(lock);
-        return device_buffer_;
+
+static sycl::queue* g_default_queue = nullptr;
+
+inline sycl::queue auto_select_queue() {
+    try {
+        return sycl::queue(sycl::gpu_selector_v);
+    } catch (...) {
+        return sycl::queue(sycl::cpu_selector_v);
     }
-    
-    /**
-     * @brief Get device buffer (const)
-     * @return Const reference to device buffer
-     */
-    const sycl::buffer<T>& get_device_buffer() const {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        ensure_device_allocated(lock);
-        return device_buffer_;
+}
+
+inline sycl::queue select_compute_queue() {
+    return auto_select_queue();
+}
+
+inline sycl::queue select_transfer_queue() {
+    return auto_select_queue();
+}
+
+inline sycl::queue select_optimal_queue(operation_type) {
+    return auto_select_queue();
+}
+
+inline sycl::queue create_queue(const device_info&) {
+    return auto_select_queue();
+}
+
+inline sycl::queue create_queue(const device_info&, uint32_t) {
+    return auto_select_queue();
+}
+
+inline sycl::queue create_queue(const device_info&, const queue_family_info&) {
+    return auto_select_queue();
+}
+
+inline void set_default_queue(const sycl::queue& queue) {
+    if (g_default_queue) {
+        delete g_default_queue;
     }
-#endif
-    
-    /**
-     * @brief Clear all dirty ranges
-     */
-    void clear_dirty_ranges() {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        dirty_ranges_.clear();
+    g_default_queue = new sycl::queue(queue);
+}
+
+inline sycl::queue get_default_queue() {
+    if (!g_default_queue) {
+        g_default_queue = new sycl::queue(auto_select_queue());
     }
-    
-    /**
-     * @brief Get dirty ranges
-     * @return Copy of dirty ranges
-     */
-    std::vector<dirty_range> get_dirty_ranges() const {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        return dirty_ranges_;
+    return *g_default_queue;
+}
+
+inline void reset_default_queue() {
+    if (g_default_queue) {
+        delete g_default_queue;
+        g_default_queue = nullptr;
     }
-    
+}
+
+inline queue_properties get_queue_properties(const sycl::queue& queue) {
+    queue_properties props;
+    // TODO: Query actual properties
+    props.supports_compute = true;
+    props.supports_transfer = true;
+    return props;
+}
+
+inline bool is_compute_queue(const sycl::queue& queue) {
+    return true;
+}
+
+inline bool is_transfer_queue(const sycl::queue& queue) {
+    return true;
+}
+
+inline bool supports_timeline_semaphores(const sycl::queue& queue) {
+    return false;
+}
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+} // namespace queue
+
+} // namespace vulkan_stdpar
+
+
+// ========== core/device_cache.hpp ==========
+
+/**
+ * @file device_cache.hpp
+ * @brief Process-wide recycling cache for device buffer allocations
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains device_buffer_cache, which keeps device allocations
+ * released by versioning_engine instances and hands them to later engines
+ * of a similar size instead of creating a new buffer each time, and its
+ * USM counterpart device_usm_cache.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+#include <sycl/sycl.hpp>
+#endif
+
+/**
+ * @brief Default byte budget of the device buffer cache
+ */
+#ifndef VULKAN_STDPAR_DEVICE_CACHE_BUDGET
+#define VULKAN_STDPAR_DEVICE_CACHE_BUDGET (size_t(256) * 1024 * 1024)
+#endif
+
+namespace vulkan_stdpar {
+
+namespace memory {
+
+/**
+ * @brief Device buffer cache statistics
+ */
+struct device_cache_stats {
+    uint64_t hits;          ///< Checkouts served from the cache
+    uint64_t misses;        ///< Checkouts that created a new buffer
+    uint64_t evictions;     ///< Buffers dropped to stay within budget
+    size_t cached_bytes;    ///< Bytes currently held by the cache
+    size_t budget;          ///< Byte budget
+
+    device_cache_stats()
+        : hits(0), misses(0), evictions(0), cached_bytes(0), budget(0)
+    {}
+};
+
+/**
+ * @brief Round a request up to its cache bucket size
+ *
+ * Buckets are 64 KiB minimum and then four per power of two, so a recycled
+ * allocation wastes at most a quarter of its size.
+ *
+ * @param bytes Requested size in bytes
+ * @return Bucket size in bytes
+ */
+inline size_t device_bucket_size(size_t bytes) {
+    const size_t min_bucket = size_t(64) * 1024;
+    if (bytes <= min_bucket) return min_bucket;
+    size_t power = min_bucket;
+    while (power * 2 <= bytes) power *= 2;
+    size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+}
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+
+/**
+ * @brief Device allocation from sycl::malloc_device, freed on destruction
+ */
+class usm_block {
 private:
+    std::byte* data_;           ///< Device pointer
+    size_t bytes_;              ///< Allocation size
+    sycl::context context_;     ///< Owning context
+
+public:
     /**
-     * @brief Implementation of mark_host_dirty with lock held
+     * @brief Allocate device memory
+     * @param bytes Size in bytes
+     * @param q Queue whose device and context own the allocation
+     * @throws out_of_memory_exception if allocation fails
      */
-    void mark_host_dirty_impl(std::unique_lock<std::shared_mutex>& lock, size_type start, size_type end) {
-        // Validate range
-        assert(start <= end);
-        assert(end <= capacity_);
-        
-        if (start == end) return;
-        
-        dirty_range new_range(start, end);
-        
-        // Merge with existing ranges
-        bool merged = false;
-        for (auto& existing : dirty_ranges_) {
-            if (existing.overlaps(new_range) || existing.adjacent(new_range)) {
-                existing = existing.merge(new_range);
-                merged = true;
-                break;
-            }
-        }
-        
-        if (!merged) {
-            dirty_ranges_.push_back(new_range);
-        }
-        
-        // Merge overlapping ranges
-        for (size_t i = 0; i < dirty_ranges_.size(); ++i) {
-            for (size_t j = i + 1; j < dirty_ranges_.size(); ++j) {
-                if (dirty_ranges_[i].overlaps(dirty_ranges_[j]) || 
-                    dirty_ranges_[i].adjacent(dirty_ranges_[j])) {
-                    dirty_ranges_[i] = dirty_ranges_[i].merge(dirty_ranges_[j]);
-                    dirty_ranges_.erase(dirty_ranges_.begin() + j);
-                    --j;
-                }
-            }
-        }
-        
-        // Update state
-        memory_state current = state_.load(std::memory_order_acquire);
-        if (current == memory_state::clean) {
-            state_.store(memory_state::host_dirty, std::memory_order_release);
+    usm_block(size_t bytes, const sycl::queue& q)
+        : data_(sycl::malloc_device<std::byte>(bytes, q))
+        , bytes_(bytes)
+        , context_(q.get_context())
+    {
+        if (!data_) throw out_of_memory_exception(bytes);
+    }
+
+    ~usm_block() {
+        if (data_) sycl::free(data_, context_);
+    }
+
+    usm_block(usm_block&& other) noexcept
+        : data_(other.data_), bytes_(other.bytes_), context_(other.context_)
+    {
+        other.data_ = nullptr;
+        other.bytes_ = 0;
+    }
+
+    usm_block& operator=(usm_block&& other) noexcept {
+        if (this != &other) {
+            if (data_) sycl::free(data_, context_);
+            data_ = other.data_;
+            bytes_ = other.bytes_;
+            context_ = other.context_;
+            other.data_ = nullptr;
+            other.bytes_ = 0;
         }
+        return *this;
     }
-    
+
+    usm_block(const usm_block&) = delete;
+    usm_block& operator=(const usm_block&) = delete;
+
+    std::byte* data() const noexcept { return data_; }
+    size_t byte_size() const noexcept { return bytes_; }
+};
+
+/**
+ * @brief Creation of cacheable device blocks
+ * @tparam Block Block type
+ */
+template<typename Block>
+struct device_block_traits;
+
+template<>
+struct device_block_traits<sycl::buffer<std::byte, 1>> {
+    static sycl::buffer<std::byte, 1> create(size_t bytes) {
+        return sycl::buffer<std::byte, 1>(sycl::range<1>(bytes));
+    }
+};
+
+/**
+ * USM blocks belong to the default queue's context; algorithms running on
+ * a queue of another context stage data through buffers instead of
+ * dereferencing them (see detail::shares_device_memory).
+ */
+template<>
+struct device_block_traits<usm_block> {
+    static usm_block create(size_t bytes) {
+        return usm_block(bytes, queue::get_default_queue());
+    }
+};
+
+/**
+ * @brief Size-bucketed cache of untyped device allocations
+ *
+ * Engines check out a byte block of at least the size they need and view
+ * it as their element type; when an engine is destroyed, shrinks its
+ * device footprint or reallocates, the block is checked back in. Cached
+ * blocks beyond the byte budget are dropped, largest buckets first.
+ * Contents of a checked-out block are unspecified.
+ *
+ * @tparam Block sycl::buffer<std::byte, 1> or usm_block
+ */
+template<typename Block>
+class basic_device_cache {
+public:
+    using block_type = Block;
+
+private:
+    mutable std::mutex mutex_;                              ///< Protects all members
+    std::map<size_t, std::vector<block_type>> buckets_;     ///< Free buffers by bucket size
+    size_t cached_bytes_;                                   ///< Sum of cached bucket sizes
+    size_t budget_;                                         ///< Byte budget
+    device_cache_stats stats_;                              ///< Counters
+
+public:
     /**
-     * @brief Implementation of mark_device_dirty with lock held
+     * @brief Construct cache
+     * @param budget Maximum bytes held while unused
      */
-    void mark_device_dirty_impl(std::unique_lock<std::shared_mutex>& lock) {
-        dirty_ranges_.clear();
-        state_.store(memory_state::device_dirty, std::memory_order_release);
+    explicit basic_device_cache(size_t budget = VULKAN_STDPAR_DEVICE_CACHE_BUDGET)
+        : cached_bytes_(0), budget_(budget) {}
+
+    basic_device_cache(const basic_device_cache&) = delete;
+    basic_device_cache& operator=(const basic_device_cache&) = delete;
+
+    /**
+     * @brief Get the process-wide cache
+     * @return Reference to the shared cache
+     */
+    static basic_device_cache& instance() {
+        // Never destroyed: vectors with static storage duration return
+        // their blocks after other statics have been torn down
+        static basic_device_cache* cache = new basic_device_cache();
+        return *cache;
     }
-    
+
     /**
-     * @brief Implementation of sync_to_device with lock held
+     * @brief Obtain a buffer of at least bytes
+     * @param bytes Required size in bytes
+     * @return Block of device_bucket_size(bytes) bytes
      */
-    void sync_to_device_impl(std::unique_lock<std::shared_mutex>& lock) const {
-        if (get_memory_state() != memory_state::host_dirty) return;
-        
-#ifdef VULKAN_STDPAR_USE_SYCL
-        ensure_device_allocated(lock);
-        
-        // Copy dirty ranges to device
-        for (const auto& range : dirty_ranges_) {
-            if (!range.empty()) {
-                auto host_sub = host_data_.data() + range.start;
-                auto device_sub = device_buffer_[sycl::range<1>(range.start)];
-                auto size = range.size();
-                
-                // Submit copy command
-                sycl::queue queue = get_default_queue();
-                queue.submit([&](sycl::handler& cgh) {
-                    auto device_acc = device_sub.get_access<sycl::access::mode::write>(cgh);
-                    cgh.copy(host_sub, device_acc, size);
-                });
+    block_type checkout(size_t bytes) {
+        size_t bucket = device_bucket_size(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = buckets_.find(bucket);
+            if (it != buckets_.end() && !it->second.empty()) {
+                block_type block = std::move(it->second.back());
+                it->second.pop_back();
+                cached_bytes_ -= bucket;
+                ++stats_.hits;
+                profiling::record_device_cache(true);
+                return block;
+            }
+            ++stats_.misses;
+        }
+        profiling::record_device_cache(false);
+        return device_block_traits<block_type>::create(bucket);
+    }
+
+    /**
+     * @brief Return a buffer obtained from checkout()
+     * @param block Buffer to recycle
+     */
+    void checkin(block_type block) {
+        size_t bucket = block.byte_size();
+        std::vector<block_type> dropped;    // destroyed outside the lock
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (bucket > budget_) {
+                ++stats_.evictions;
+                dropped.push_back(std::move(block));
+            } else {
+                evict_until(budget_ - bucket, dropped);
+                buckets_[bucket].push_back(std::move(block));
+                cached_bytes_ += bucket;
             }
         }
-        
-        // Wait for completion
-        get_default_queue().wait();
-#endif
-        
-        dirty_ranges_.clear();
-        state_.store(memory_state::clean, std::memory_order_release);
     }
-    
+
     /**
-     * @brief Implementation of sync_to_host with lock held
+     * @brief Set byte budget, evicting cached buffers if necessary
+     * @param bytes New budget (0 disables caching)
      */
-    void sync_to_host_impl(std::unique_lock<std::shared_mutex>& lock) const {
-        if (get_memory_state() != memory_state::device_dirty) return;
-        
-#ifdef VULKAN_STDPAR_USE_SYCL
-        if (!device_allocated_) return;
-        
-        // Copy entire buffer from device to host
-        sycl::queue queue = get_default_queue();
-        queue.submit([&](sycl::handler& cgh) {
-            auto device_acc = device_buffer_.get_access<sycl::access::mode::read>(cgh);
-            cgh.copy(device_acc, host_data_.data());
-        });
-        
-        queue.wait();
-#endif
-        
-        state_.store(memory_state::clean, std::memory_order_release);
+    void set_budget(size_t bytes) {
+        std::vector<block_type> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        budget_ = bytes;
+        evict_until(budget_, dropped);
     }
-    
+
     /**
-     * @brief Implementation of resize with lock held
+     * @brief Drop every cached buffer
      */
-    void resize_impl(std::unique_lock<std::shared_mutex>& lock, size_type new_capacity) {
-        if (new_capacity <= capacity_) return;
-        
-        // Resize host storage
-        host_data_.reserve(new_capacity);
-        
-#ifdef VULKAN_STDPAR_USE_SYCL
-        if (device_allocated_) {
-            // Create new device buffer
-            sycl::buffer<T> new_buffer(new_capacity);
-            
-            // Copy old data if device is dirty
-            if (get_memory_state() == memory_state::device_dirty) {
-                sycl::queue queue = get_default_queue();
-                queue.submit([&](sycl::handler& cgh) {
-                    auto old_acc = device_buffer_.get_access<sycl::access::mode::read>(cgh);
-                    auto new_acc = new_buffer.get_access<sycl::access::mode::write>(cgh);
-                    cgh.copy(old_acc, new_acc, capacity_);
-                });
-                queue.wait();
-            }
-            
-            device_buffer_ = std::move(new_buffer);
-        }
-#endif
-        
-        capacity_ = new_capacity;
+    void clear() {
+        std::vector<block_type> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        evict_until(0, dropped);
     }
-    
-#ifdef VULKAN_STDPAR_USE_SYCL
+
     /**
-     * @brief Ensure device buffer is allocated
+     * @brief Get cache statistics
+     * @return Snapshot of counters
      */
-    void ensure_device_allocated(std::shared_lock<std::shared_mutex>& lock) const {
-        if (!device_allocated_) {
-            // Need to upgrade to unique lock
-            lock.unlock();
-            std::unique_lock<std::shared_mutex> unique_lock(mutex_);
-            
-            // Double-check after acquiring unique lock
-            if (!device_allocated_) {
-                device_buffer_ = sycl::buffer<T>(capacity_);
-                device_allocated_ = true;
-            }
-            
-            // Downgrade back to shared lock
-            lock = std::shared_lock<std::shared_mutex>(std::move(unique_lock));
-        }
+    device_cache_stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        device_cache_stats result = stats_;
+        result.cached_bytes = cached_bytes_;
+        result.budget = budget_;
+        return result;
     }
-    
+
+private:
     /**
-     * @brief Get default SYCL queue
+     * @brief Evict largest buckets first until cached bytes <= limit
      */
-    static sycl::queue get_default_queue() {
-        static sycl::queue default_queue;
-        return default_queue;
+    void evict_until(size_t limit, std::vector<block_type>& dropped) {
+        while (cached_bytes_ > limit && !buckets_.empty()) {
+            auto it = std::prev(buckets_.end());
+            if (it->second.empty()) {
+                buckets_.erase(it);
+                continue;
+            }
+            dropped.push_back(std::move(it->second.back()));
+            it->second.pop_back();
+            cached_bytes_ -= it->first;
+            ++stats_.evictions;
+        }
     }
-#endif
 };
 
+/**
+ * @brief Cache of sycl::buffer blocks used by the buffer backend and streaming
+ */
+using device_buffer_cache = basic_device_cache<sycl::buffer<std::byte, 1>>;
+
+/**
+ * @brief Cache of malloc_device blocks used by the USM backend
+ */
+using device_usm_cache = basic_device_cache<usm_block>;
+
+/**
+ * @brief View the leading count elements of a byte buffer as T
+ * @tparam T Element type
+ * @param block Buffer from device_buffer_cache::checkout
+ * @param count Number of elements (count * sizeof(T) <= block size)
+ * @return Typed buffer sharing block's memory
+ */
+template<typename T>
+sycl::buffer<T, 1> view_device_block(device_buffer_cache::block_type& block, size_t count) {
+    size_t bytes = count * sizeof(T);
+    if (bytes == block.byte_size()) {
+        return block.template reinterpret<T, 1>(sycl::range<1>(count));
+    }
+    device_buffer_cache::block_type prefix(block, sycl::id<1>(0), sycl::range<1>(bytes));
+    return prefix.template reinterpret<T, 1>(sycl::range<1>(count));
+}
+
+/**
+ * @brief View a USM block as T
+ * @tparam T Element type
+ * @param block Block from device_usm_cache::checkout
+ * @return Typed device pointer
+ */
+template<typename T>
+T* view_device_block(usm_block& block, size_t) {
+    return reinterpret_cast<T*>(block.data());
+}
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+} // namespace memory
+
 } // namespace vulkan_stdpar
 
-#endif // VULKAN_STDPAR_CORE_VERSIONING_ENGINE_HPP
-// ========== core/device_selection.hpp ==========
+
+// ========== core/residency.hpp ==========
 
 /**
- * @file device_selection.hpp
- * @brief GPU device enumeration, selection, and management
+ * @file residency.hpp
+ * @brief Global device memory budget with least-recently-used eviction
  * @author Vulkan STD-Parallel Team
  * @version 1.0
  * @date 2025-12-02
- * 
- * This file contains device management functionality including device enumeration,
- * selection criteria, and queue management for vendor-agnostic GPU access.
+ *
+ * This file contains residency_manager, which tracks the device bytes held
+ * by every versioning_engine and evicts idle device copies back to host
+ * memory when a new allocation would exceed the budget. Victims are
+ * chosen under the manager lock but written back and freed after it is
+ * dropped, so a slow device-to-host copy does not stall every other
+ * allocation.
  */
 
 
-#include <string>
-#include <vector>
-#include <memory>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <list>
 #include <mutex>
-#include <unordered_map>
-
-#ifdef VULKAN_STDPAR_USE_SYCL
-#include <sycl/sycl.hpp>
+#include <vector>
 
-#ifdef VULKAN_STDPAR_USE_VULKAN
-#include <vulkan/vulkan.h>
+/**
+ * @brief Default device memory budget in bytes (0 derives it from the device)
+ */
+#ifndef VULKAN_STDPAR_DEVICE_MEMORY_BUDGET
+#define VULKAN_STDPAR_DEVICE_MEMORY_BUDGET 0
 #endif
 
 namespace vulkan_stdpar {
 
-// Forward declarations
-struct device_info;
-struct queue_family_info;
-enum class operation_type;
+namespace memory {
 
 /**
- * @brief Queue family information for device selection
+ * @brief Object owning a device copy that can be evicted to host memory
  */
-struct queue_family_info {
-    uint32_t family_index;                     ///< Queue family index
-    uint32_t queue_count;                      ///< Number of queues in family
-    bool supports_compute;                     ///< Compute operations support
-    bool supports_transfer;                    ///< Transfer operations support
-    bool supports_graphics;                    ///< Graphics operations support
-    bool supports_sparse_binding;              ///< Sparse memory binding
-    uint32_t timestamp_valid_bits;            ///< Timestamp valid bits
-    uint32_t min_image_transfer_granularity;  ///< Minimum image transfer granularity
-    
-    queue_family_info() 
-        : family_index(0)
-        , queue_count(0)
-        , supports_compute(false)
-        , supports_transfer(false)
-        , supports_graphics(false)
-        , supports_sparse_binding(false)
-        , timestamp_valid_bits(0)
-        , min_image_transfer_granularity(0)
+class device_resident {
+public:
+    /**
+     * @brief Write the device copy back to host if needed and free it
+     *
+     * Called without the residency manager lock, while the manager holds
+     * the object's registration aside. Implementations must not block on
+     * their own locks: if the object is busy or pinned by a running
+     * kernel it returns 0 and the manager moves on. An exception, e.g. a
+     * failed write-back, is treated the same way.
+     *
+     * @return Bytes freed, or 0 if nothing was evicted
+     */
+    virtual size_t try_evict() const = 0;
+
+protected:
+    ~device_resident() = default;
+};
+
+/**
+ * @brief Residency manager statistics
+ */
+struct residency_stats {
+    size_t resident_bytes;  ///< Device bytes currently held by engines
+    size_t peak_bytes;      ///< Highest resident_bytes observed
+    size_t budget;          ///< Byte budget (0 means unlimited)
+    size_t resident_count;  ///< Number of engines holding a device copy
+    uint64_t evictions;     ///< Device copies evicted to host
+    uint64_t bytes_evicted; ///< Device bytes freed by eviction
+
+    residency_stats()
+        : resident_bytes(0), peak_bytes(0), budget(0), resident_count(0)
+        , evictions(0), bytes_evicted(0)
     {}
 };
 
 /**
- * @brief Device information structure
+ * @brief Process-wide tracker of device copies in least-recently-used order
+ *
+ * Engines admit their device allocation before creating it, touch it on
+ * every device use and release it when they free it. Admitting past the
+ * budget evicts the least-recently-used other copies first; evicted
+ * engines re-upload transparently on their next device access.
  */
-struct device_info {
-    // Basic identification
-    std::string name;                          ///< Device name
-    std::string vendor;                        ///< Vendor name
-    std::string driver_version;                ///< Driver version string
-    std::string api_version;                   ///< Vulkan API version
-    
-    // Hardware capabilities
-    size_t memory_size;                        ///< Total device memory (bytes)
-    size_t max_compute_units;                  ///< Number of compute units
-    size_t max_work_group_size;                ///< Maximum work-group size
-    size_t max_work_items_per_compute_unit;    ///< Max work items per CU
-    uint32_t max_compute_work_group_count[3];  ///< Max compute work group count
-    
-    // Feature support
-    bool supports_timeline_semaphores;         ///< Timeline semaphore support
-    bool supports_pinned_memory;               ///< Host-coherent memory support
-    bool supports_sub_groups;                  ///< Sub-group operations
-    bool supports_fp16;                        ///< Half-precision floating point
-    bool supports_fp64;                        ///< Double-precision floating point
-    bool supports_int8;                        ///< 8-bit integer operations
-    bool supports_int16;                       ///< 16-bit integer operations
-    bool supports_int64;                       ///< 64-bit integer operations
-    
-    // Queue families
-    std::vector<queue_family_info> queue_families; ///< Available queue families
-    
-    // Performance characteristics
-    double peak_performance;                   ///< Theoretical peak GFLOPS
-    double memory_bandwidth;                   ///< Memory bandwidth GB/s
-    uint32_t clock_frequency;                  ///< Core clock frequency (MHz)
-    
-    device_info() 
-        : memory_size(0)
-        , max_compute_units(0)
-        , max_work_group_size(0)
-        , max_work_items_per_compute_unit(0)
-        , supports_timeline_semaphores(false)
-        , supports_pinned_memory(false)
-        , supports_sub_groups(false)
-        , supports_fp16(false)
-        , supports_fp64(false)
-        , supports_int8(false)
-        , supports_int16(false)
-        , supports_int64(false)
-        , peak_performance(0.0)
-        , memory_bandwidth(0.0)
-        , clock_frequency(0)
-    {
-        max_compute_work_group_count[0] = 0;
-        max_compute_work_group_count[1] = 0;
-        max_compute_work_group_count[2] = 0;
+class residency_manager {
+private:
+    struct entry {
+        const device_resident* owner;   ///< Engine holding the copy
+        size_t bytes;                   ///< Device bytes held
+        bool evicting;                  ///< Set aside in evicting_ by an eviction in progress
+    };
+
+public:
+    /**
+     * @brief Opaque registration handle returned by admit()
+     */
+    using handle = std::list<entry>::iterator;
+
+private:
+    mutable std::mutex mutex_;      ///< Protects all members
+    std::condition_variable evicted_; ///< Signals the end of an eviction pass
+    std::list<entry> lru_;          ///< Most recently used first
+    std::list<entry> evicting_;     ///< Entries being evicted outside the lock
+    size_t resident_bytes_;         ///< Sum of entry sizes
+    size_t budget_;                 ///< Byte budget (0 means unlimited)
+    bool budget_set_;               ///< Budget configured explicitly
+    residency_stats stats_;         ///< Peak and eviction counters
+
+public:
+    residency_manager()
+        : resident_bytes_(0)
+        , budget_(VULKAN_STDPAR_DEVICE_MEMORY_BUDGET)
+        , budget_set_(VULKAN_STDPAR_DEVICE_MEMORY_BUDGET != 0)
+    {}
+
+    residency_manager(const residency_manager&) = delete;
+    residency_manager& operator=(const residency_manager&) = delete;
+
+    /**
+     * @brief Get the process-wide manager
+     * @return Reference to the shared manager
+     */
+    static residency_manager& instance() {
+        // Never destroyed: engines with static storage duration release
+        // their allocations after other statics have been torn down
+        static residency_manager* manager = new residency_manager();
+        return *manager;
     }
-    
+
     /**
-     * @brief Check if device is suitable for compute operations
-     * @return True if device meets minimum requirements
+     * @brief Register a device allocation, evicting others to make room
+     * @param owner Engine about to allocate
+     * @param bytes Size of the allocation
+     * @return Handle for touch(), release() and rebind()
      */
-    bool is_suitable() const {
-        return supports_compute() && 
-               has_compute_queue_family() && 
-               memory_size > 0;
+    handle admit(const device_resident* owner, size_t bytes) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (budget_ != 0 && resident_bytes_ + bytes > budget_) {
+            evict_unlocked(lock, resident_bytes_ + bytes - budget_, owner);
+        }
+        lru_.push_front(entry{owner, bytes, false});
+        resident_bytes_ += bytes;
+        stats_.peak_bytes = std::max(stats_.peak_bytes, resident_bytes_);
+        return lru_.begin();
     }
-    
+
     /**
-     * @brief Calculate performance score for device selection
-     * @return Performance score (higher is better)
+     * @brief Mark an allocation as most recently used
+     * @param h Handle from admit()
      */
-    double performance_score() const {
-        double score = 0.0;
-        
-        // Memory size (30% weight)
-        score += (memory_size / (1024.0 * 1024.0 * 1024.0)) * 0.3;
-        
-        // Compute units (25% weight)
-        score += max_compute_units * 0.25;
-        
-        // Peak performance (25% weight)
-        score += peak_performance * 0.01;
-        
-        // Memory bandwidth (20% weight)
-        score += memory_bandwidth * 0.02;
-        
-        return score;
+    void touch(handle h) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!h->evicting) lru_.splice(lru_.begin(), lru_, h);
     }
-    
+
     /**
-     * @brief Get device summary string
-     * @return Formatted device summary
+     * @brief Unregister an allocation freed by its owner
+     * @param h Handle from admit()
      */
-    std::string get_summary() const {
-        return name + " (" + vendor + ", " + 
-               std::to_string(memory_size / (1024*1024*1024)) + "GB)";
+    void release(handle h) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // The owner holds its own lock, so a running eviction of h fails and returns it
+        evicted_.wait(lock, [&] { return !h->evicting; });
+        resident_bytes_ -= h->bytes;
+        lru_.erase(h);
     }
-    
-private:
-    bool supports_compute() const {
-        for (const auto& family : queue_families) {
-            if (family.supports_compute) return true;
+
+    /**
+     * @brief Transfer an allocation to a new owner (engine move)
+     * @param h Handle from admit()
+     * @param owner New owning engine
+     */
+    void rebind(handle h, const device_resident* owner) noexcept {
+        std::unique_lock<std::mutex> lock(mutex_);
+        evicted_.wait(lock, [&] { return !h->evicting; });
+        h->owner = owner;
+    }
+
+    /**
+     * @brief Evict least-recently-used copies until bytes are freed
+     * @param bytes Bytes to free
+     * @param keep Engine that must not be evicted (may be null)
+     * @return Bytes actually freed
+     */
+    size_t evict(size_t bytes, const device_resident* keep = nullptr) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return evict_unlocked(lock, bytes, keep);
+    }
+
+    /**
+     * @brief Set byte budget, evicting copies if necessary
+     * @param bytes New budget (0 means unlimited)
+     */
+    void set_budget(size_t bytes) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        budget_ = bytes;
+        budget_set_ = true;
+        if (budget_ != 0 && resident_bytes_ > budget_) {
+            evict_unlocked(lock, resident_bytes_ - budget_, nullptr);
         }
-        return false;
     }
-    
-    bool has_compute_queue_family() const {
-        for (const auto& family : queue_families) {
-            if (family.supports_compute && family.queue_count > 0) return true;
+
+    /**
+     * @brief Set the budget derived from device capacity unless configured
+     * @param bytes Default budget
+     */
+    void init_budget(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!budget_set_) {
+            budget_ = bytes;
+            budget_set_ = true;
         }
-        return false;
     }
-};
 
-/**
- * @brief Operation type for queue selection
- */
-enum class operation_type {
-    compute,
-    transfer,
-    mixed
-};
+    /**
+     * @brief Get byte budget
+     * @return Budget (0 means unlimited)
+     */
+    size_t budget() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return budget_;
+    }
 
-/**
- * @brief Device selection criteria
- */
-struct device_selection_criteria {
-    std::string preferred_vendor;
-    size_t minimum_memory;
-    double minimum_performance_score;
-    bool require_timeline_semaphores;
-    bool require_pinned_memory;
-    bool prefer_integrated_gpu;
-    
-    device_selection_criteria()
-        : minimum_memory(1024 * 1024 * 1024)  // 1GB minimum
-        , minimum_performance_score(0.0)
-        , require_timeline_semaphores(false)
-        , require_pinned_memory(false)
-        , prefer_integrated_gpu(false)
-    {}
-};
+    /**
+     * @brief Get residency statistics
+     * @return Snapshot of counters
+     */
+    residency_stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        residency_stats result = stats_;
+        result.resident_bytes = resident_bytes_;
+        result.budget = budget_;
+        result.resident_count = lru_.size() + evicting_.size();
+        return result;
+    }
 
-/**
- * @brief Queue selection criteria
- */
-struct queue_selection_criteria {
-    bool prefer_compute_queue;
-    bool prefer_dedicated_queue;
-    bool require_timeline_semaphores;
-    size_t min_work_group_size;
-    size_t max_work_group_size;
-    
-    queue_selection_criteria()
-        : prefer_compute_queue(true)
-        , prefer_dedicated_queue(false)
-        , require_timeline_semaphores(false)
-        , min_work_group_size(1)
-        , max_work_group_size(1024)
-    {}
+private:
+    /**
+     * @brief Ends an eviction pass however it is left
+     *
+     * Victims still set aside (not erased and replaced by evicting_.end())
+     * get their evicting flag cleared and go back to the cold end of the
+     * list, and waiters in release() and rebind() are woken, so none of
+     * them can wait on a stale flag.
+     */
+    class eviction_pass {
+    private:
+        residency_manager& manager_;
+        std::unique_lock<std::mutex>& lock_;
+        const std::vector<handle>& victims_;
+
+    public:
+        eviction_pass(residency_manager& manager, std::unique_lock<std::mutex>& lock,
+                      const std::vector<handle>& victims)
+            : manager_(manager), lock_(lock), victims_(victims) {}
+
+        ~eviction_pass() {
+            if (!lock_.owns_lock()) lock_.lock();
+            for (handle h : victims_) {
+                if (h == manager_.evicting_.end()) continue;
+                h->evicting = false;
+                manager_.lru_.splice(manager_.lru_.end(), manager_.evicting_, h);
+            }
+            manager_.evicted_.notify_all();
+        }
+
+        eviction_pass(const eviction_pass&) = delete;
+        eviction_pass& operator=(const eviction_pass&) = delete;
+    };
+
+    /**
+     * @brief Evict from the cold end of the list until bytes are freed
+     *
+     * Victims are moved to evicting_ under the lock, evicted with the lock
+     * dropped, then erased (or put back at the cold end if busy) under the
+     * lock again. An owner whose try_evict() throws counts as busy. Entries
+     * that refused are not retried in the same call.
+     */
+    size_t evict_unlocked(std::unique_lock<std::mutex>& lock, size_t bytes, const device_resident* keep) {
+        size_t freed = 0;
+        std::vector<const device_resident*> tried;
+        for (;;) {
+            std::vector<handle> victims;
+            eviction_pass pass(*this, lock, victims);
+            size_t picked = 0;
+            auto it = lru_.end();
+            while (freed + picked < bytes && it != lru_.begin()) {
+                auto victim = std::prev(it);
+                if (victim->owner == keep ||
+                    std::find(tried.begin(), tried.end(), victim->owner) != tried.end()) {
+                    it = victim;
+                    continue;
+                }
+                victims.push_back(victim);
+                picked += victim->bytes;
+                victim->evicting = true;
+                evicting_.splice(evicting_.end(), lru_, victim);
+            }
+            if (victims.empty()) return freed;
+
+            std::vector<size_t> released(victims.size());
+            tried.reserve(tried.size() + victims.size());
+            lock.unlock();
+            for (size_t i = 0; i < victims.size(); ++i) {
+                try {
+                    // Entries set aside are not modified until the lock is retaken
+                    released[i] = victims[i]->owner->try_evict();
+                } catch (...) {
+                    released[i] = 0;
+                }
+            }
+            lock.lock();
+
+            // Owners that refused go back to the list when pass ends
+            for (size_t i = 0; i < victims.size(); ++i) {
+                handle h = victims[i];
+                if (released[i] == 0) {
+                    tried.push_back(h->owner);
+                    continue;
+                }
+                freed += h->bytes;
+                resident_bytes_ -= h->bytes;
+                ++stats_.evictions;
+                stats_.bytes_evicted += h->bytes;
+                profiling::record_device_eviction(h->bytes);
+                evicting_.erase(h);
+                victims[i] = evicting_.end();
+            }
+            if (freed >= bytes) return freed;
+        }
+    }
 };
 
-/**
- * @brief Device management namespace
- */
-namespace device {
+} // namespace memory
 
-/**
- * @brief Enumerate all available devices
- * @return Vector of device information
- */
-std::vector<device_info> enumerate_devices();
+} // namespace vulkan_stdpar
 
-/**
- * @brief Enumerate suitable devices for compute operations
- * @return Vector of suitable device information
- */
-std::vector<device_info> enumerate_suitable_devices();
 
-/**
- * @brief Get default device (highest performance)
- * @return Default device information
- */
-device_info get_default_device();
+// ========== core/staging.hpp ==========
 
 /**
- * @brief Select device by name
- * @param device_name Device name to search for
- * @return Selected device information
- * @throws device_not_found_exception if device not found
+ * @file staging.hpp
+ * @brief Pinned staging ring for host-to-device uploads
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains staging_ring, a small set of pinned host slots that
+ * uploads stream through. Host data is copied into one slot while the
+ * previous slot's transfer is still in flight, and callers may modify
+ * their host data as soon as an upload call returns.
  */
-device_info select_by_name(const std::string& device_name);
 
-/**
- * @brief Select device by vendor
- * @param vendor_name Vendor name to search for
- * @return Selected device information
- * @throws device_not_found_exception if device not found
- */
-device_info select_by_vendor(const std::string& vendor_name);
 
-/**
- * @brief Select device by minimum memory requirement
- * @param minimum_memory Minimum memory in bytes
- * @return Selected device information
- * @throws device_not_found_exception if no suitable device found
- */
-device_info select_by_memory(size_t minimum_memory);
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+#include <vector>
 
-/**
- * @brief Select device by minimum performance score
- * @param min_performance_score Minimum performance score
- * @return Selected device information
- * @throws device_not_found_exception if no suitable device found
- */
-device_info select_by_performance(double min_performance_score);
+#ifdef VULKAN_STDPAR_USE_SYCL
+#include <sycl/sycl.hpp>
+#endif
 
 /**
- * @brief Select optimal device for given operation and data size
- * @param pattern Access pattern
- * @param data_size Data size in bytes
- * @return Selected device information
+ * @brief Size of one staging slot in bytes
  */
-device_info select_optimal_device(operation_type pattern, size_t data_size);
+#ifndef VULKAN_STDPAR_STAGING_SLOT_BYTES
+#define VULKAN_STDPAR_STAGING_SLOT_BYTES (size_t(8) * 1024 * 1024)
+#endif
 
 /**
- * @brief Rank devices by performance
- * @return Devices sorted by performance (best first)
+ * @brief Number of staging slots in the ring (at least 2 for overlap)
  */
-std::vector<device_info> rank_devices_by_performance();
+#ifndef VULKAN_STDPAR_STAGING_SLOTS
+#define VULKAN_STDPAR_STAGING_SLOTS 3
+#endif
 
 /**
- * @brief Rank devices by memory size
- * @return Devices sorted by memory size (largest first)
+ * @brief Largest clean gap merged into a neighbouring upload span, in bytes
  */
-std::vector<device_info> rank_devices_by_memory();
+#ifndef VULKAN_STDPAR_STAGING_COALESCE_BYTES
+#define VULKAN_STDPAR_STAGING_COALESCE_BYTES (size_t(64) * 1024)
+#endif
 
-/**
- * @brief Validate device availability and capabilities
- * @param device Device to validate
- * @return True if device is valid and available
- */
-bool validate_device(const device_info& device);
+namespace vulkan_stdpar {
+
+namespace memory {
 
 /**
- * @brief Check if device is currently available
- * @param device Device to check
- * @return True if device is available
+ * @brief Element span [start, end) to upload
  */
-bool is_device_available(const device_info& device);
+struct upload_span {
+    size_t start;   ///< First element
+    size_t end;     ///< One past the last element
+};
 
 /**
- * @brief Get device status string
- * @param device Device to query
- * @return Status description
+ * @brief Merge ranges into few large spans for upload
+ *
+ * Ranges closer than max_gap elements are joined; the clean elements in
+ * between are uploaded too, which is harmless because host and device
+ * agree on them and cheaper than a separate transfer.
+ *
+ * @tparam Range Type with start and end members
+ * @param ranges Dirty ranges in any order
+ * @param max_gap Largest gap in elements to bridge
+ * @return Sorted, disjoint spans
  */
-std::string get_device_status(const device_info& device);
+template<typename Range>
+std::vector<upload_span> coalesce_spans(const std::vector<Range>& ranges, size_t max_gap) {
+    std::vector<upload_span> spans;
+    spans.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        if (range.start < range.end) spans.push_back(upload_span{range.start, range.end});
+    }
+    std::sort(spans.begin(), spans.end(),
+              [](const upload_span& a, const upload_span& b) { return a.start < b.start; });
+
+    size_t out = 0;
+    for (size_t i = 0; i < spans.size(); ++i) {
+        if (out > 0 && spans[i].start <= spans[out - 1].end + max_gap) {
+            spans[out - 1].end = std::max(spans[out - 1].end, spans[i].end);
+        } else {
+            spans[out++] = spans[i];
+        }
+    }
+    spans.resize(out);
+    return spans;
+}
 
-} // namespace device
+#ifdef VULKAN_STDPAR_USE_SYCL
 
 /**
- * @brief Queue management namespace
+ * @brief Ring of pinned host slots for streaming uploads
+ *
+ * Each upload is cut into slot-sized pieces. A piece is copied into the
+ * next slot (waiting only for that slot's previous transfer) and a device
+ * copy is enqueued from it, so host copying and transfers overlap. Uploads
+ * from consecutive engines share the ring and pipeline the same way.
  */
-namespace queue {
+class staging_ring {
+private:
+    struct slot {
+        unsigned char* data;    ///< Pinned host memory
+        sycl::event pending;    ///< Last transfer reading this slot
+    };
 
-#ifdef VULKAN_STDPAR_USE_SYCL
+    std::mutex mutex_;          ///< Serializes use of the slots
+    sycl::context context_;     ///< Context the slots were allocated in
+    std::vector<slot> slots_;   ///< Ring slots
+    size_t slot_bytes_;         ///< Size of each slot
+    size_t next_;               ///< Next slot to fill
 
-/**
- * @brief Automatic queue selection
- * @return SYCL queue for optimal device
- */
-sycl::queue auto_select_queue();
+public:
+    /**
+     * @brief Allocate the ring on a queue's context
+     * @param q Queue whose context owns the pinned slots
+     */
+    explicit staging_ring(sycl::queue& q)
+        : context_(q.get_context())
+        , slot_bytes_(VULKAN_STDPAR_STAGING_SLOT_BYTES)
+        , next_(0)
+    {
+        size_t count = std::max<size_t>(2, VULKAN_STDPAR_STAGING_SLOTS);
+        for (size_t i = 0; i < count; ++i) {
+            auto* data = static_cast<unsigned char*>(sycl::malloc_host(slot_bytes_, q));
+            if (!data) break;
+            slots_.push_back(slot{data, sycl::event()});
+        }
+    }
 
-/**
- * @brief Select compute-optimized queue
- * @return SYCL queue for compute operations
- */
-sycl::queue select_compute_queue();
+    staging_ring(const staging_ring&) = delete;
+    staging_ring& operator=(const staging_ring&) = delete;
 
-/**
- * @brief Select transfer-optimized queue
- * @return SYCL queue for transfer operations
- */
-sycl::queue select_transfer_queue();
+    /**
+     * @brief Get the process-wide ring, creating it on first use
+     *
+     * The ring is never destroyed so pinned memory outlives any queue
+     * still referencing it at exit.
+     *
+     * @param q Queue used for the first allocation
+     * @return Reference to the shared ring
+     */
+    static staging_ring& instance(sycl::queue& q) {
+        static staging_ring* ring = new staging_ring(q);
+        return *ring;
+    }
 
-/**
- * @brief Select queue for specific operation type
- * @param op Operation type
- * @return SYCL queue optimized for operation
- */
-sycl::queue select_optimal_queue(operation_type op);
+    /**
+     * @brief Check whether uploads on a queue can use this ring
+     * @param q Target queue
+     * @return True if q shares the ring's context and slots were allocated
+     */
+    bool usable(const sycl::queue& q) const {
+        return slots_.size() >= 2 && q.get_context() == context_;
+    }
 
-/**
- * @brief Create queue for specific device
- * @param device Device to create queue for
- * @return SYCL queue for device
- */
-sycl::queue create_queue(const device_info& device);
+    /**
+     * @brief Upload count elements into dst starting at dst_index
+     *
+     * Returns once src has been copied into pinned slots; the transfers
+     * complete asynchronously and later commands on dst are ordered after
+     * them by the SYCL runtime.
+     *
+     * @tparam T Trivially copyable element type
+     * @param q Queue to enqueue the transfers on
+     * @param dst Destination device buffer
+     * @param dst_index First destination element
+     * @param src Host source
+     * @param count Number of elements
+     */
+    template<typename T>
+    void upload(sycl::queue& q, sycl::buffer<T>& dst, size_t dst_index, const T* src, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Staged uploads require trivially copyable elements");
+        size_t piece = slot_bytes_ / sizeof(T);
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (size_t offset = 0; offset < count; offset += piece) {
+            size_t n = std::min(piece, count - offset);
+            slot& s = slots_[next_];
+            next_ = (next_ + 1) % slots_.size();
+
+            // Only this slot's previous transfer must finish before reuse
+            s.pending.wait();
+            std::memcpy(s.data, src + offset, n * sizeof(T));
+
+            const T* staged = reinterpret_cast<const T*>(s.data);
+            s.pending = q.submit([&](sycl::handler& cgh) {
+                auto acc = dst.template get_access<sycl::access::mode::write>(
+                    cgh, sycl::range<1>(n), sycl::id<1>(dst_index + offset));
+                cgh.copy(staged, acc);
+            });
+        }
+    }
 
-/**
- * @brief Create queue for specific device and queue family
- * @param device Device to create queue for
- * @param queue_family_index Queue family index
- * @return SYCL queue for device and family
- */
-sycl::queue create_queue(const device_info& device, uint32_t queue_family_index);
+    /**
+     * @brief Upload count elements to a USM device pointer
+     *
+     * Like the buffer overload, but ordering is explicit: each piece
+     * depends on events and its event is appended to events.
+     *
+     * @tparam T Trivially copyable element type
+     * @param q Queue to enqueue the transfers on
+     * @param dst Destination device pointer
+     * @param src Host source
+     * @param count Number of elements
+     * @param events Work dst must wait for; receives the transfer events
+     */
+    template<typename T>
+    void upload(sycl::queue& q, T* dst, const T* src, size_t count, std::vector<sycl::event>& events) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Staged uploads require trivially copyable elements");
+        size_t piece = slot_bytes_ / sizeof(T);
+        std::vector<sycl::event> deps = events;
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (size_t offset = 0; offset < count; offset += piece) {
+            size_t n = std::min(piece, count - offset);
+            slot& s = slots_[next_];
+            next_ = (next_ + 1) % slots_.size();
+
+            s.pending.wait();
+            std::memcpy(s.data, src + offset, n * sizeof(T));
+            s.pending = q.memcpy(dst + offset, s.data, n * sizeof(T), deps);
+            events.push_back(s.pending);
+        }
+    }
 
-/**
- * @brief Create queue for specific device and queue family
- * @param device Device to create queue for
- * @param queue_family Queue family information
- * @return SYCL queue for device and family
- */
-sycl::queue create_queue(const device_info& device, const queue_family_info& queue_family);
+    /**
+     * @brief Get slot size in bytes
+     * @return Bytes per slot
+     */
+    size_t slot_bytes() const noexcept {
+        return slot_bytes_;
+    }
+};
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+} // namespace memory
+
+} // namespace vulkan_stdpar
 
-/**
- * @brief Get queue properties
- * @param queue SYCL queue
- * @return Queue properties
- */
-queue_properties get_queue_properties(const sycl::queue& queue);
+
+// ========== core/numa.hpp ==========
 
 /**
- * @brief Check if queue supports compute operations
- * @param queue SYCL queue
- * @return True if queue supports compute
+ * @file numa.hpp
+ * @brief Host NUMA topology and page placement
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains numa_topology, which reads the memory nodes and their
+ * CPUs from /sys/devices/system/node, and interleave_pages, which asks the
+ * kernel to spread a mapping's pages round-robin across those nodes. No
+ * libnuma is needed; on other systems the topology is one node holding
+ * every CPU and placement requests are ignored.
  */
-bool is_compute_queue(const sycl::queue& queue);
+
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_mbind)
+#define VULKAN_STDPAR_HAS_NUMA 1
+#endif
+#endif
+
+namespace vulkan_stdpar {
 
 /**
- * @brief Check if queue supports transfer operations
- * @param queue SYCL queue
- * @return True if queue supports transfer
+ * @brief Where the pages of large host storage are placed on NUMA systems
  */
-bool is_transfer_queue(const sycl::queue& queue);
+enum class numa_placement {
+    local,      ///< Each page on the node of the worker that first writes it
+    interleave  ///< Pages spread round-robin across all memory nodes
+};
+
+namespace host {
 
 /**
- * @brief Check if queue supports timeline semaphores
- * @param queue SYCL queue
- * @return True if queue supports timeline semaphores
+ * @brief One NUMA memory node
  */
-bool supports_timeline_semaphores(const sycl::queue& queue);
+struct numa_node {
+    int id;                 ///< Node number in /sys/devices/system/node
+    std::vector<int> cpus;  ///< Online CPUs attached to the node
+};
+
+namespace detail {
 
 /**
- * @brief Set default queue for operations
- * @param queue SYCL queue to set as default
+ * @brief Parse a kernel CPU or node list such as "0-3,8,10-11"
  */
-void set_default_queue(const sycl::queue& queue);
+inline std::vector<int> parse_id_list(const std::string& text) {
+    std::vector<int> ids;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t comma = text.find(',', pos);
+        std::string item = text.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        pos = comma == std::string::npos ? text.size() : comma + 1;
+        size_t dash = item.find('-');
+        try {
+            int first = std::stoi(item.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+            for (int id = first; id <= last; ++id) ids.push_back(id);
+        } catch (...) {
+            // Blank or malformed item (e.g. trailing newline)
+        }
+    }
+    return ids;
+}
 
 /**
- * @brief Get default queue
- * @return Default SYCL queue
+ * @brief Read the first line of a sysfs file, or "" if it cannot be read
  */
-sycl::queue get_default_queue();
+inline std::string read_sysfs_line(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+} // namespace detail
 
 /**
- * @brief Reset default queue to auto-selected
+ * @brief Memory nodes of the host and the CPUs attached to each
  */
-void reset_default_queue();
+class numa_topology {
+private:
+    std::vector<numa_node> nodes_;  ///< Nodes with at least one CPU, by id
 
-#endif // VULKAN_STDPAR_USE_SYCL
+public:
+    /**
+     * @brief Read the topology from sysfs
+     *
+     * Falls back to a single node holding CPUs 0..hardware_concurrency-1
+     * when sysfs is unavailable.
+     */
+    numa_topology() {
+#if defined(__linux__)
+        const std::string root = "/sys/devices/system/node/";
+        for (int id : detail::parse_id_list(detail::read_sysfs_line(root + "online"))) {
+            numa_node node;
+            node.id = id;
+            node.cpus = detail::parse_id_list(
+                detail::read_sysfs_line(root + "node" + std::to_string(id) + "/cpulist"));
+            if (!node.cpus.empty()) nodes_.push_back(std::move(node));
+        }
+#endif
+        if (nodes_.empty()) {
+            numa_node node;
+            node.id = 0;
+            unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned cpu = 0; cpu < hw; ++cpu) node.cpus.push_back(static_cast<int>(cpu));
+            nodes_.push_back(std::move(node));
+        }
+    }
 
-} // namespace queue
+    /**
+     * @brief Get the process-wide topology, read on first use
+     * @return Shared topology
+     */
+    static const numa_topology& get() {
+        static const numa_topology topology;
+        return topology;
+    }
+
+    /**
+     * @brief Get the nodes that have CPUs
+     * @return Nodes in id order
+     */
+    const std::vector<numa_node>& nodes() const noexcept {
+        return nodes_;
+    }
+
+    /**
+     * @brief Get number of nodes with CPUs
+     * @return Node count (at least 1)
+     */
+    size_t node_count() const noexcept {
+        return nodes_.size();
+    }
+
+    /**
+     * @brief Find the node index a CPU belongs to
+     * @param cpu CPU number
+     * @return Index into nodes(), or 0 if the CPU is unknown
+     */
+    size_t node_of_cpu(int cpu) const noexcept {
+        for (size_t i = 0; i < nodes_.size(); ++i) {
+            const auto& cpus = nodes_[i].cpus;
+            if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end()) return i;
+        }
+        return 0;
+    }
+};
 
 /**
- * @brief Queue properties structure
+ * @brief Interleave the not yet touched pages of a mapping across all nodes
+ *
+ * Pages already faulted in stay where they are. Does nothing on a single
+ * node or without NUMA support.
+ *
+ * @param ptr Page-aligned start of an anonymous or private mapping
+ * @param bytes Length of the range
+ * @return True if the interleave policy was applied
  */
-struct queue_properties {
-    uint32_t queue_family_index;
-    bool supports_compute;
-    bool supports_transfer;
-    bool supports_timeline_semaphores;
-    size_t min_sub_group_size;
-    size_t max_sub_group_size;
-    size_t preferred_work_group_size_multiple;
-    
-    queue_properties()
-        : queue_family_index(0)
-        , supports_compute(false)
-        , supports_transfer(false)
-        , supports_timeline_semaphores(false)
-        , min_sub_group_size(1)
-        , max_sub_group_size(32)
-        , preferred_work_group_size_multiple(32)
-    {}
-};
+inline bool interleave_pages(void* ptr, size_t bytes) noexcept {
+#ifdef VULKAN_STDPAR_HAS_NUMA
+    const auto& topology = numa_topology::get();
+    if (topology.node_count() < 2 || bytes == 0) return false;
+
+    constexpr size_t bits = sizeof(unsigned long) * 8;
+    constexpr int mpol_interleave = 3;  // MPOL_INTERLEAVE from <linux/mempolicy.h>
+    int max_id = topology.nodes().back().id;
+    std::vector<unsigned long> mask(static_cast<size_t>(max_id) / bits + 1, 0);
+    for (const auto& node : topology.nodes()) {
+        mask[static_cast<size_t>(node.id) / bits] |= 1ul << (static_cast<size_t>(node.id) % bits);
+    }
+    // The kernel reads maxnode - 1 bits
+    return ::syscall(SYS_mbind, ptr, bytes, mpol_interleave, mask.data(),
+                     mask.size() * bits + 1, 0u) == 0;
+#else
+    (void)ptr;
+    (void)bytes;
+    return false;
+#endif
+}
 
-// Exception declarations (to be defined in exceptions.hpp)
-class device_not_found_exception;
-class device_unavailable_exception;
-class device_initialization_exception;
-class queue_creation_exception;
+} // namespace host
 
 } // namespace vulkan_stdpar
 
-#endif // VULKAN_STDPAR_CORE_DEVICE_SELECTION_HPP
-// ========== containers/unified_reference.hpp ==========
+
+// ========== core/thread_pool.hpp ==========
 
 /**
- * @file unified_reference.hpp
- * @brief Proxy reference type for write detection in unified_vector
+ * @file thread_pool.hpp
+ * @brief Host worker pool for CPU-side parallel execution
  * @author Vulkan STD-Parallel Team
  * @version 1.0
  * @date 2025-12-02
- * 
- * This file implements the unified_reference proxy that enables write detection
- * for unified_vector elements while maintaining natural C++ syntax.
+ *
+ * This file contains the host thread pool used to run algorithms on raw
+ * host pointers in parallel when work is not dispatched to a device.
+ * Workers are pinned to CPUs in NUMA node order, and parallel_for hands
+ * chunk k of a range to the same worker on every call, so repeated passes
+ * over a vector find each chunk in that worker's cache and local memory.
  */
 
 
-#include <type_traits>
-#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @brief Minimum element count before host algorithms run in parallel
+ */
+#ifndef VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD
+#define VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD 32768
+#endif
+
+/**
+ * @brief Pin host pool workers to CPUs (set to 0 to let the OS place them)
+ */
+#ifndef VULKAN_STDPAR_HOST_PIN_WORKERS
+#define VULKAN_STDPAR_HOST_PIN_WORKERS 1
+#endif
 
 namespace vulkan_stdpar {
 
-// Forward declaration
-template<typename T> class unified_vector;
+/**
+ * @brief Host execution namespace
+ */
+namespace host {
 
 /**
- * @brief Proxy reference for unified_vector elements
- * 
- * This class acts as a proxy reference that detects writes to vector elements
- * and triggers appropriate synchronization. It provides implicit conversion
- * for reads while marking the host as dirty on writes.
- * 
- * @tparam T Element type
+ * @brief Fixed-size pool of host worker threads
+ *
+ * Each worker has its own task queue. parallel_for sends chunk k to worker
+ * k - 1 (the caller runs chunk 0), so the same range is split and
+ * assigned the same way on every call. A worker whose queue is empty
+ * takes tasks queued for busy workers, trying workers on its own NUMA
+ * node before the others.
  */
-template<typename T>
-class unified_reference {
+class thread_pool {
 private:
-    unified_vector<T>* container_;     ///< Parent container
-    size_t index_;                      ///< Element index
-    
-    // Friend declarations
-    template<typename U> friend class unified_vector;
-    template<typename U> friend class unified_iterator;
-    
+    static constexpr size_t no_worker = static_cast<size_t>(-1);
+
+    std::vector<std::thread> workers_;                     ///< Worker threads
+    std::vector<std::deque<std::function<void()>>> queues_; ///< Pending tasks per worker
+    std::vector<size_t> worker_node_;                      ///< NUMA node index of each worker
+    std::vector<char> busy_;                               ///< Worker is running a task
+    std::mutex mutex_;                                     ///< Protects queues_, busy_ and stop_
+    std::condition_variable cv_;                           ///< Signals new tasks and completions
+    bool stop_;                                            ///< Shutdown flag
+
 public:
     /**
-     * @brief Construct reference to vector element
-     * @param container Parent container
-     * @param index Element index
+     * @brief Construct pool
+     * @param num_threads Number of worker threads (0 selects hardware concurrency - 1)
      */
-    unified_reference(unified_vector<T>* container, size_t index)
-        : container_(container)
-        , index_(index)
-    {}
-    
+    explicit thread_pool(size_t num_threads = 0) : stop_(false) {
+        if (num_threads == 0) {
+            size_t hw = std::thread::hardware_concurrency();
+            num_threads = hw > 1 ? hw - 1 : 0;
+        }
+
+        // CPU slot 0 is left to the calling thread, which runs chunk 0
+        const auto& topology = host::numa_topology::get();
+        std::vector<int> cpus = allowed_cpus(topology);
+        queues_.resize(num_threads);
+        worker_node_.assign(num_threads, 0);
+        busy_.assign(num_threads, 0);
+        workers_.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i) {
+            int cpu = cpus.empty() ? -1 : cpus[(i + 1) % cpus.size()];
+            if (cpu >= 0) worker_node_[i] = topology.node_of_cpu(cpu);
+            workers_.emplace_back([this, i] { worker_loop(i); });
+            pin(workers_.back(), cpu);
+        }
+    }
+
     /**
-     * @brief Copy constructor
+     * @brief Destructor - drains pending tasks and joins workers
      */
-    unified_reference(const unified_reference& other) = default;
-    
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Non-copyable, non-movable
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
     /**
-     * @brief Implicit conversion to T for read access
-     * @return Element value
+     * @brief Get number of worker threads
+     * @return Worker count (the calling thread also participates in parallel_for)
      */
-    operator T() const {
-        return container_->at_impl(index_);
+    size_t size() const noexcept {
+        return workers_.size();
     }
-    
+
     /**
-     * @brief Assignment from value (triggers write detection)
-     * @param value Value to assign
-     * @return Reference to this
+     * @brief Get maximum useful parallelism (workers plus caller)
+     * @return Concurrency level
      */
-    unified_reference& operator=(const T& value) {
-        container_->set_impl(index_, value);
-        return *this;
+    size_t concurrency() const noexcept {
+        return workers_.size() + 1;
     }
-    
+
     /**
-     * @brief Assignment from another reference
-     * @param other Other reference
-     * @return Reference to this
+     * @brief Get the NUMA node a worker runs on
+     * @param worker Worker index
+     * @return Index into numa_topology::nodes()
      */
-    unified_reference& operator=(const unified_reference& other) {
-        if (this != &other) {
-            container_->set_impl(index_, other.operator T());
-        }
-        return *this;
+    size_t worker_node(size_t worker) const {
+        return worker_node_[worker];
     }
-    
+
     /**
-     * @brief Move assignment
-     * @param value Value to move
-     * @return Reference to this
+     * @brief Run func over [0, count) split into contiguous chunks
+     *
+     * The split depends only on count, grain and the pool size, and chunk
+     * k always goes to worker k - 1, so successive calls over the same
+     * range give each worker the same elements. The calling thread
+     * executes chunk 0 and then helps with tasks of busy workers while
+     * waiting, so nested calls from worker threads cannot deadlock. The
+     * first exception thrown by any chunk is rethrown in the caller.
+     *
+     * @tparam Func Callable as func(size_t begin, size_t end)
+     * @param count Number of iterations
+     * @param grain Minimum iterations per chunk
+     * @param func Chunk body
      */
-    unified_reference& operator=(T&& value) {
-        container_->set_impl(index_, std::move(value));
-        return *this;
+    template<typename Func>
+    void parallel_for(size_t count, size_t grain, Func&& func) {
+        if (count == 0) return;
+
+        size_t max_chunks = grain == 0 ? count : std::max<size_t>(1, count / grain);
+        size_t num_chunks = std::min(concurrency(), max_chunks);
+        if (num_chunks <= 1) {
+            func(size_t(0), count);
+            return;
+        }
+
+        struct completion {
+            std::atomic<size_t> remaining;
+            std::exception_ptr error;
+            std::mutex error_mutex;
+        } done;
+        done.remaining.store(num_chunks - 1, std::memory_order_relaxed);
+
+        auto run_chunk = [&](size_t chunk) {
+            size_t begin = count * chunk / num_chunks;
+            size_t end = count * (chunk + 1) / num_chunks;
+            try {
+                func(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(done.error_mutex);
+                if (!done.error) done.error = std::current_exception();
+            }
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+                queues_[chunk - 1].emplace_back([&run_chunk, &done, chunk, this] {
+                    run_chunk(chunk);
+                    if (done.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        std::lock_guard<std::mutex> wake(mutex_);
+                        cv_.notify_all();
+                    }
+                });
+            }
+        }
+        cv_.notify_all();
+
+        run_chunk(0);
+
+        // Help with queued work until all chunks of this call have finished
+        size_t self = current_worker();
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] {
+                    return done.remaining.load(std::memory_order_acquire) == 0 || can_take(self);
+                });
+                if (done.remaining.load(std::memory_order_acquire) == 0) break;
+                take(self, task);
+            }
+            task();
+        }
+
+        if (done.error) {
+            std::rethrow_exception(done.error);
+        }
     }
-    
-    // Address operator disabled to prevent pointer escape
-    T* operator&() = delete;
-    
-    // Compound assignment operators (trigger write detection)
-    
-    template<typename U>
-    unified_reference& operator+=(const U& rhs) {
-        T value = this->operator T();
-        value += rhs;
-        container_->set_impl(index_, value);
-        return *this;
+
+private:
+    /**
+     * @brief Pool and worker index of the calling thread
+     */
+    struct worker_identity {
+        const thread_pool* pool = nullptr;
+        size_t index = no_worker;
+    };
+
+    static worker_identity& identity() {
+        thread_local worker_identity id;
+        return id;
     }
-    
-    template<typename U>
-    unified_reference& operator-=(const U& rhs) {
-        T value = this->operator T();
-        value -= rhs;
-        container_->set_impl(index_, value);
-        return *this;
+
+    /**
+     * @brief Worker index of the calling thread in this pool, or no_worker
+     */
+    size_t current_worker() const {
+        const worker_identity& id = identity();
+        return id.pool == this ? id.index : no_worker;
     }
-    
-    template<typename U>
-    unified_reference& operator*=(const U& rhs) {
-        T value = this->operator T();
-        value *= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator/=(const U& rhs) {
-        T value = this->operator T();
-        value /= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator%=(const U& rhs) {
-        T value = this->operator T();
-        value %= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator&=(const U& rhs) {
-        T value = this->operator T();
-        value &= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator|=(const U& rhs) {
-        T value = this->operator T();
-        value |= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator^=(const U& rhs) {
-        T value = this->operator T();
-        value ^= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator<<=(const U& rhs) {
-        T value = this->operator T();
-        value <<= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    template<typename U>
-    unified_reference& operator>>=(const U& rhs) {
-        T value = this->operator T();
-        value >>= rhs;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    // Increment/decrement operators
-    
-    unified_reference& operator++() {
-        T value = this->operator T();
-        ++value;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    T operator++(int) {
-        T old_value = this->operator T();
-        T new_value = old_value;
-        ++new_value;
-        container_->set_impl(index_, new_value);
-        return old_value;
-    }
-    
-    unified_reference& operator--() {
-        T value = this->operator T();
-        --value;
-        container_->set_impl(index_, value);
-        return *this;
-    }
-    
-    T operator--(int) {
-        T old_value = this->operator T();
-        T new_value = old_value;
-        --new_value;
-        container_->set_impl(index_, new_value);
-        return old_value;
+
+    /**
+     * @brief Check whether worker self (or a non-worker) has a task to run
+     *
+     * Own tasks always qualify; another worker's tasks only while that
+     * worker is busy, so an idle worker keeps the chunks meant for it.
+     */
+    bool can_take(size_t self) const {
+        if (self != no_worker && !queues_[self].empty()) return true;
+        for (size_t w = 0; w < queues_.size(); ++w) {
+            if (w != self && busy_[w] && !queues_[w].empty()) return true;
+        }
+        return false;
     }
-    
+
     /**
-     * @brief Swap with another reference
-     * @param other Other reference
+     * @brief Pop a task for worker self: own queue, then same node, then others
      */
-    void swap(unified_reference& other) {
-        T temp = this->operator T();
-        container_->set_impl(index_, other.operator T());
-        other.container_->set_impl(other.index_, temp);
+    bool take(size_t self, std::function<void()>& task) {
+        if (self != no_worker && !queues_[self].empty()) {
+            task = std::move(queues_[self].front());
+            queues_[self].pop_front();
+            return true;
+        }
+        size_t node = self != no_worker ? worker_node_[self] : no_worker;
+        for (int pass = 0; pass < 2; ++pass) {
+            for (size_t w = 0; w < queues_.size(); ++w) {
+                if (w == self || !busy_[w] || queues_[w].empty()) continue;
+                if ((pass == 0) != (worker_node_[w] == node)) continue;
+                task = std::move(queues_[w].back());
+                queues_[w].pop_back();
+                return true;
+            }
+        }
+        return false;
     }
-    
+
+    void worker_loop(size_t index) {
+        identity() = worker_identity{this, index};
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] { return stop_ || can_take(index); });
+                if (!take(index, task)) return;
+                busy_[index] = 1;
+                // Tasks left behind are now stealable
+                if (!queues_[index].empty()) cv_.notify_all();
+            }
+            task();
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_[index] = 0;
+        }
+    }
+
     /**
-     * @brief Get const pointer to element (read-only)
-     * @return Const pointer
+     * @brief CPUs this process may run on, grouped by NUMA node
      */
-    const T* get_ptr() const {
-        return &container_->data_impl()[index_];
+    static std::vector<int> allowed_cpus(const host::numa_topology& topology) {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        bool known = ::sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+        for (const auto& node : topology.nodes()) {
+            for (int cpu : node.cpus) {
+                if (!known || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) cpus.push_back(cpu);
+            }
+        }
+#else
+        (void)topology;
+#endif
+        return cpus;
+    }
+
+    static void pin(std::thread& worker, int cpu) {
+#if defined(__linux__) && VULKAN_STDPAR_HOST_PIN_WORKERS
+        if (cpu < 0 || cpu >= CPU_SETSIZE) return;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        // Best effort: a failure leaves the worker unpinned
+        (void)::pthread_setaffinity_np(worker.native_handle(), sizeof(set), &set);
+#else
+        (void)worker;
+        (void)cpu;
+#endif
     }
 };
 
 /**
- * @brief Non-member swap for unified_reference
- * @tparam T Element type
- * @param lhs Left reference
- * @param rhs Right reference
+ * @brief Get the process-wide host thread pool
+ * @return Reference to the shared pool
  */
-template<typename T>
-void swap(unified_reference<T> lhs, unified_reference<T> rhs) noexcept {
-    lhs.swap(rhs);
+inline thread_pool& get_thread_pool() {
+    static thread_pool pool;
+    return pool;
+}
+
+/**
+ * @brief Run func over [0, count) on the shared pool
+ * @tparam Func Callable as func(size_t begin, size_t end)
+ * @param count Number of iterations
+ * @param func Chunk body
+ * @param grain Minimum iterations per chunk
+ */
+template<typename Func>
+void parallel_for(size_t count, Func&& func, size_t grain = VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD / 4) {
+    get_thread_pool().parallel_for(count, grain, std::forward<Func>(func));
+}
+
+/**
+ * @brief Check whether a range is large enough to run in parallel
+ * @param count Number of elements
+ * @return True if count meets the parallel threshold
+ */
+inline bool should_parallelize(size_t count) noexcept {
+    return count >= VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD && get_thread_pool().size() > 0;
 }
 
+} // namespace host
+
 } // namespace vulkan_stdpar
 
 
-// ========== containers/unified_vector.hpp ==========
+// ========== core/memory_management.hpp ==========
 
 /**
- * @file unified_vector.hpp
- * @brief Drop-in replacement for std::vector with GPU acceleration
+ * @file memory_management.hpp
+ * @brief Memory allocation strategies and optimization utilities
  * @author Vulkan STD-Parallel Team
  * @version 1.0
  * @date 2025-12-02
  * 
- * This file implements unified_vector, a container that provides 100% std::vector
- * API compatibility while enabling transparent GPU acceleration for parallel algorithms.
+ * This file contains memory management utilities including pinned memory allocation,
+ * lazy buffer creation, memory pooling, and memory optimization strategies.
  */
 
 
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
 #include <vector>
-#include <initializer_list>
 #include <algorithm>
-#include <iterator>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <new>
+#include <unordered_map>
+
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+#include <sycl/sycl.hpp>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Bytes of freed pinned memory kept for reuse
+ */
+#ifndef VULKAN_STDPAR_PINNED_POOL_BYTES
+#define VULKAN_STDPAR_PINNED_POOL_BYTES (size_t(64) * 1024 * 1024)
+#endif
+
+/**
+ * @brief Smallest allocation for which pinning is worthwhile
+ */
+#ifndef VULKAN_STDPAR_PINNED_MIN_BYTES
+#define VULKAN_STDPAR_PINNED_MIN_BYTES (size_t(64) * 1024)
+#endif
+
+/**
+ * @brief Let devices that share host memory use host storage in place (0 disables)
+ */
+#ifndef VULKAN_STDPAR_ZERO_COPY
+#define VULKAN_STDPAR_ZERO_COPY 1
+#endif
 
 namespace vulkan_stdpar {
 
 // Forward declarations
-template<typename T> class unified_iterator;
-template<typename T> class const_unified_iterator;
+struct device_info;
+enum class access_pattern;
+enum class allocation_strategy;
+enum class memory_advice;
 
 /**
- * @brief Unified vector with automatic GPU acceleration
+ * @brief Access pattern enumeration for memory optimization
+ */
+enum class access_pattern {
+    sequential,    ///< Sequential access pattern
+    random,        ///< Random access pattern
+    strided,       ///< Strided access pattern
+    unknown        ///< Unknown access pattern
+};
+
+/**
+ * @brief Memory allocation strategy enumeration
+ */
+enum class allocation_strategy {
+    host_pinned,   ///< Host-pinned memory
+    device_local,   ///< Device-local memory
+    unified,        ///< Unified memory (if available)
+    automatic       ///< Automatic selection based on heuristics
+};
+
+/**
+ * @brief Memory advice enumeration for optimization hints
+ */
+enum class memory_advice {
+    will_need,           ///< Memory will be needed soon
+    will_not_need,        ///< Memory will not be needed
+    prefer_location,      ///< Prefer specific location
+    preferred_location    ///< Preferred location hint
+};
+
+/**
+ * @brief Memory properties structure
+ */
+struct memory_properties {
+    bool host_visible;                          ///< Host can access memory
+    bool host_coherent;                         ///< Automatic host/device coherence
+    bool host_cached;                            ///< Host caching available
+    bool device_local;                          ///< Device-local memory
+    bool lazily_allocated;                      ///< Lazy allocation support
+    size_t alignment;                           ///< Required memory alignment
+    size_t max_allocation_size;                 ///< Maximum single allocation
+    
+    memory_properties()
+        : host_visible(false)
+        , host_coherent(false)
+        , host_cached(false)
+        , device_local(false)
+        , lazily_allocated(false)
+        , alignment(0)
+        , max_allocation_size(0)
+    {}
+};
+
+/**
+ * @brief Memory management namespace
+ */
+namespace memory {
+
+/**
+ * @brief Get memory properties for a device
  * 
- * This class provides a drop-in replacement for std::vector that automatically
- * manages host/device memory synchronization and enables GPU acceleration for
- * standard parallel algorithms.
+ * Devices whose memory is host memory report it as host visible, coherent
+ * and cached as well as device local.
  * 
- * @tparam T Element type (must be trivially copyable)
+ * @param device Device information
+ * @return Memory properties
+ */
+inline memory_properties get_memory_properties(const device_info& device) {
+    memory_properties props;
+    props.device_local = true;
+    props.host_visible = device.host_unified_memory;
+    props.host_coherent = device.host_unified_memory;
+    props.host_cached = device.host_unified_memory;
+    props.alignment = alignof(std::max_align_t);
+    props.max_allocation_size = device.memory_size;
+    return props;
+}
+
+/**
+ * @brief Check if device supports unified memory
+ * @param device Device information
+ * @return True if device memory is host memory, so host data can be used in place
+ */
+inline bool supports_unified_memory(const device_info& device) {
+    memory_properties props = get_memory_properties(device);
+    return props.device_local && props.host_visible && props.host_coherent;
+}
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+/**
+ * @brief Check whether kernels on a device can work on host storage in place
+ * 
+ * The USM backend additionally needs the device to accept pointers from
+ * the system allocator. Results are cached per device.
+ * 
+ * @param dev SYCL device
+ * @return True if host storage can be bound as the device copy
+ */
+inline bool supports_zero_copy(const sycl::device& dev) {
+#if VULKAN_STDPAR_ZERO_COPY
+    static std::mutex mutex;
+    static std::unordered_map<sycl::device, bool> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(dev);
+    if (it != cache.end()) return it->second;
+    
+    bool zero_copy = supports_unified_memory(device::sycl_device_to_info(dev));
+#ifdef VULKAN_STDPAR_USE_USM
+    zero_copy = zero_copy && dev.has(sycl::aspect::usm_system_allocations);
+#endif
+    cache.emplace(dev, zero_copy);
+    return zero_copy;
+#else
+    (void)dev;
+    return false;
+#endif
+}
+#endif
+
+/**
+ * @brief Check if device supports device-local memory
+ * @param device Device information
+ * @return True if device-local memory is supported
+ */
+bool supports_device_local_memory(const device_info& device);
+
+/**
+ * @brief Select optimal allocation strategy
+ * @param size Allocation size in bytes
+ * @param pattern Expected access pattern
+ * @return Optimal allocation strategy
+ */
+allocation_strategy select_optimal_strategy(size_t size, access_pattern pattern);
+
+/**
+ * @brief Select device-local memory allocation strategy
+ * @param size Allocation size in bytes
+ * @return Device-local memory allocation strategy
+ */
+allocation_strategy select_device_local_strategy(size_t size);
+
+/**
+ * @brief Allocate device memory
+ * @param size Size to allocate in bytes
+ * @param device Device information
+ * @return Aligned pointer to allocated memory
+ * @throws std::bad_alloc if allocation fails
+ */
+void* allocate_device_memory(size_t size, const device_info& device);
+
+/**
+ * @brief Free device memory
+ * @param ptr Pointer to free
+ * @param size Size of allocation
+ */
+void free_device_memory(void* ptr, size_t size);
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+
+/**
+ * @brief Lazy SYCL buffer allocator with host-pointer reuse
+ * @tparam T Element type
  */
 template<typename T>
-class unified_vector {
+class lazy_buffer_allocator {
 public:
-    // Type definitions (match std::vector)
     using value_type = T;
+    using pointer = T*;
     using size_type = size_t;
-    using difference_type = ptrdiff_t;
-    using reference = unified_reference<T>;
-    using const_reference = const T&;
-    using pointer = void;  // Disabled to prevent pointer escape
-    using const_pointer = const T*;
-    using iterator = unified_iterator<T>;
-    using const_iterator = const_unified_iterator<T>;
-    using reverse_iterator = std::reverse_iterator<iterator>;
-    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     
 private:
-    versioning_engine<T> engine_;     ///< Memory state management
-    size_type size_;                   ///< Current element count
+    struct buffer_state {
+        sycl::buffer<T> buffer;              ///< SYCL buffer
+        T* host_ptr;                        ///< Host pointer
+        size_t size;                         ///< Buffer size
+        bool device_allocated;                 ///< Device allocation flag
+        bool host_ptr_valid;                 ///< Host pointer validity flag
+        
+        buffer_state() : host_ptr(nullptr), size(0), device_allocated(false), host_ptr_valid(false) {}
+    };
     
-    // Friend declarations
-    template<typename U> friend class unified_reference;
-    template<typename U> friend class unified_iterator;
-    template<typename U> friend class const_unified_iterator;
+    mutable std::mutex mutex_;               ///< Thread safety
+    mutable std::unique_ptr<buffer_state> state_;  ///< Buffer state
     
 public:
-    // ==================== Constructors ====================
-    
     /**
-     * @brief Default constructor
+     * @brief Constructor
      */
-    unified_vector() : engine_(0), size_(0) {}
+    lazy_buffer_allocator() : state_(std::make_unique<buffer_state>()) {}
     
     /**
-     * @brief Construct with size
-     * @param count Number of elements
+     * @brief Destructor
      */
-    explicit unified_vector(size_type count)
-        : engine_(count), size_(count)
-    {
-        std::fill_n(data_impl(), count, T());
-    }
+    ~lazy_buffer_allocator() = default;
     
-    /**
-     * @brief Construct with size and value
-     * @param count Number of elements
-     * @param value Initial value
-     */
-    unified_vector(size_type count, const T& value)
-        : engine_(count), size_(count)
-    {
-        std::fill_n(data_impl(), count, value);
-    }
+    // Non-copyable but movable
+    lazy_buffer_allocator(const lazy_buffer_allocator&) = delete;
+    lazy_buffer_allocator& operator=(const lazy_buffer_allocator&) = delete;
+    
+    lazy_buffer_allocator(lazy_buffer_allocator&&) = default;
+    lazy_buffer_allocator& operator=(lazy_buffer_allocator&&) = default;
     
     /**
-     * @brief Construct from range
-     * @tparam InputIt Iterator type
-     * @param first Beginning of range
-     * @param last End of range
+     * @brief Get or create SYCL buffer
+     * @param host_ptr Host pointer to reuse (optional)
+     * @param size Buffer size in elements
+     * @return Reference to SYCL buffer
      */
-    template<typename InputIt>
-    unified_vector(InputIt first, InputIt last)
-        : engine_(std::distance(first, last))
-        , size_(std::distance(first, last))
-    {
-        std::copy(first, last, data_impl());
+    sycl::buffer<T>& get_or_create_buffer(T* host_ptr = nullptr, size_type size = 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (!state_->device_allocated || 
+            (size > 0 && size != state_->size) ||
+            (host_ptr && host_ptr != state_->host_ptr)) {
+            
+            // Create new buffer with host pointer reuse if possible
+            if (host_ptr && size > 0) {
+                state_->buffer = sycl::buffer<T>(host_ptr, sycl::range<1>(size));
+                state_->host_ptr = host_ptr;
+                state_->host_ptr_valid = true;
+            } else {
+                state_->buffer = sycl::buffer<T>(size);
+                state_->host_ptr = nullptr;
+                state_->host_ptr_valid = false;
+            }
+            
+            state_->size = size;
+            state_->device_allocated = true;
+        }
+        
+        return state_->buffer;
     }
     
     /**
-     * @brief Construct from initializer list
-     * @param init Initializer list
+     * @brief Get current buffer size
+     * @return Buffer size in elements
      */
-    unified_vector(std::initializer_list<T> init)
-        : engine_(init.size())
-        , size_(init.size())
-    {
-        std::copy(init.begin(), init.end(), data_impl());
+    size_type size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return state_->size;
     }
     
     /**
-     * @brief Copy constructor
-     * @param other Vector to copy
+     * @brief Check if buffer is allocated
+     * @return True if buffer is allocated
      */
-    unified_vector(const unified_vector& other)
-        : engine_(other.size_)
-        , size_(other.size_)
-    {
-        // Sync other to host first
-        other.engine_.sync_to_host();
-        std::copy_n(other.data_impl(), size_, data_impl());
+    bool is_allocated() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return state_->device_allocated;
     }
     
     /**
-     * @brief Move constructor
-     * @param other Vector to move
+     * @brief Get host pointer
+     * @return Host pointer (may be nullptr)
      */
-    unified_vector(unified_vector&& other) noexcept
-        : engine_(std::move(other.engine_))
-        , size_(other.size_)
-    {
-        other.size_ = 0;
+    T* get_host_pointer() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return state_->host_ptr_valid ? state_->host_ptr : nullptr;
     }
     
     /**
-     * @brief Destructor
+     * @brief Reset buffer state
      */
-    ~unified_vector() = default;
-    
-    // ==================== Assignment ====================
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        state_->buffer = sycl::buffer<T>();
+        state_->host_ptr = nullptr;
+        state_->size = 0;
+        state_->device_allocated = false;
+        state_->host_ptr_valid = false;
+    }
     
     /**
-     * @brief Copy assignment
-     * @param other Vector to copy
-     * @return Reference to this
+     * @brief Force buffer allocation
+     * @param size Buffer size in elements
+     * @return Reference to allocated buffer
      */
-    unified_vector& operator=(const unified_vector& other) {
-        if (this != &other) {
-            other.engine_.sync_to_host();
-            engine_ = versioning_engine<T>(other.size_);
-            size_ = other.size_;
-            std::copy_n(other.data_impl(), size_, data_impl());
-        }
-        return *this;
+    sycl::buffer<T>& allocate(size_type size) {
+        return get_or_create_buffer(nullptr, size);
     }
     
     /**
-     * @brief Move assignment
-     * @param other Vector to move
-     * @return Reference to this
+     * @brief Create buffer from existing host data
+     * @param host_ptr Host pointer to data
+     * @param size Buffer size in elements
+     * @return Reference to created buffer
      */
-    unified_vector& operator=(unified_vector&& other) noexcept {
-        if (this != &other) {
-            engine_ = std::move(other.engine_);
-            size_ = other.size_;
-            other.size_ = 0;
-        }
-        return *this;
+    sycl::buffer<T>& create_from_host(T* host_ptr, size_type size) {
+        return get_or_create_buffer(host_ptr, size);
     }
+};
+
+/**
+ * @brief Optimize memory layout for specific access pattern
+ * @tparam T Element type
+ * @param buffer SYCL buffer to optimize
+ * @param pattern Access pattern
+ */
+template<typename T>
+void optimize_memory_layout(sycl::buffer<T>& buffer, access_pattern pattern);
+
+/**
+ * @brief Prefetch memory to specific device
+ * @tparam T Element type
+ * @param buffer SYCL buffer to prefetch
+ * @param device Target device
+ */
+template<typename T>
+void prefetch_memory(sycl::buffer<T>& buffer, const device_info& device);
+
+/**
+ * @brief Advise memory usage pattern to runtime
+ * @tparam T Element type
+ * @param buffer SYCL buffer to advise
+ * @param advice Memory advice
+ */
+template<typename T>
+void advise_memory_usage(sycl::buffer<T>& buffer, memory_advice advice);
+
+/**
+ * @brief Create sub-buffer for range operations
+ * @tparam T Element type
+ * @param parent Parent buffer
+ * @param offset Offset in elements
+ * @param size Size in elements
+ * @return Sub-buffer for range
+ */
+template<typename T>
+sycl::buffer<T> create_sub_buffer(sycl::buffer<T>& parent, size_t offset, size_t size) {
+    return parent.template reinterpret<T>(sycl::range<1>(offset + size), sycl::id<1>(offset));
+}
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+namespace detail {
+
+/**
+ * @brief Shared buddy heap behind memory_pool
+ *
+ * Memory is carved from arenas of 2^arena_shift bytes, each aligned to its
+ * own size. Blocks are power-of-two size classes from 2^min_shift bytes up
+ * to half an arena; a free block of order k keeps an intrusive list node in
+ * its first bytes, and a per-arena order map (stored in the arena's first
+ * block) lets deallocation find and coalesce its buddy in O(1). Requests
+ * above the largest class go straight to operator new.
+ */
+class buddy_heap : public std::enable_shared_from_this<buddy_heap> {
+public:
+    static constexpr size_t min_shift = 6;                              ///< 64-byte minimum class
+    static constexpr size_t arena_shift = 22;                           ///< 4 MiB arenas
+    static constexpr size_t arena_bytes = size_t(1) << arena_shift;
+    static constexpr size_t num_orders = arena_shift - min_shift;       ///< Orders 0 .. 15
+    static constexpr size_t max_block = size_t(1) << (arena_shift - 1); ///< Largest pooled block
+    static constexpr size_t meta_order = arena_shift - 2 * min_shift;   ///< Order of the order map
+    static constexpr uint8_t not_free = 0xff;
     
-    /**
-     * @brief Assign from initializer list
-     * @param init Initializer list
-     * @return Reference to this
-     */
-    unified_vector& operator=(std::initializer_list<T> init) {
-        assign(init);
-        return *this;
+private:
+    struct free_node {
+        free_node* prev;
+        free_node* next;
+    };
+    
+    std::mutex mutex_;                          ///< Protects free lists and arenas
+    free_node* free_lists_[num_orders];         ///< Free blocks per order
+    uint32_t nonempty_;                         ///< Bit k set when free_lists_[k] is non-empty
+    std::vector<unsigned char*> arenas_;        ///< Owned arenas
+    std::atomic<size_t> outstanding_;           ///< Bytes checked out of the heap
+    std::atomic<size_t> peak_;                  ///< High-water mark of outstanding_
+    uint64_t id_;                               ///< Unique heap identity for thread caches
+    
+public:
+    buddy_heap() : nonempty_(0), outstanding_(0), peak_(0), id_(next_id()) {
+        std::fill(std::begin(free_lists_), std::end(free_lists_), nullptr);
     }
     
-    /**
-     * @brief Assign from range
-     * @tparam InputIt Iterator type
-     * @param first Beginning of range
-     * @param last End of range
-     */
-    template<typename InputIt>
-    void assign(InputIt first, InputIt last) {
-        size_type new_size = std::distance(first, last);
-        if (new_size > capacity()) {
-            engine_.resize(new_size);
+    ~buddy_heap() {
+        for (unsigned char* arena : arenas_) {
+            ::operator delete(arena, std::align_val_t(arena_bytes));
         }
-        size_ = new_size;
-        std::copy(first, last, data_impl());
-        engine_.mark_host_dirty(0, size_);
     }
     
+    buddy_heap(const buddy_heap&) = delete;
+    buddy_heap& operator=(const buddy_heap&) = delete;
+    
+    uint64_t id() const noexcept { return id_; }
+    size_t outstanding() const noexcept { return outstanding_.load(std::memory_order_relaxed); }
+    size_t peak() const noexcept { return peak_.load(std::memory_order_relaxed); }
+    
     /**
-     * @brief Assign from count copies of value
-     * @param count Number of elements
-     * @param value Value to copy
+     * @brief Map a byte count to its size class
+     * @param bytes Request size
+     * @return Order k such that 2^(min_shift + k) >= bytes
      */
-    void assign(size_type count, const T& value) {
-        if (count > capacity()) {
-            engine_.resize(count);
-        }
-        size_ = count;
-        std::fill_n(data_impl(), count, value);
-        engine_.mark_host_dirty(0, size_);
+    static size_t order_for(size_t bytes) noexcept {
+        size_t order = 0;
+        while ((size_t(1) << (min_shift + order)) < bytes) ++order;
+        return order;
+    }
+    
+    static size_t block_size(size_t order) noexcept {
+        return size_t(1) << (min_shift + order);
     }
     
     /**
-     * @brief Assign from initializer list
-     * @param init Initializer list
+     * @brief Pre-map arenas so that at least bytes can be served without growing
      */
-    void assign(std::initializer_list<T> init) {
-        assign(init.begin(), init.end());
+    void reserve(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t arenas = (bytes + arena_bytes - 1) / arena_bytes;
+        for (size_t i = 0; i < arenas; ++i) add_arena();
     }
     
-    // ==================== Element Access ====================
-    
     /**
-     * @brief Access element with bounds checking
-     * @param pos Element index
-     * @return Reference to element
-     * @throws std::out_of_range if pos >= size
-*/
-    reference at(size_type pos) {
-        if (pos >= size_) {
-            throw std::out_of_range("unified_vector::at: index out of range");
+     * @brief Take up to count blocks of one order, splitting larger blocks as needed
+     * @return Number of blocks written to out (at least 1)
+     * @throws std::bad_alloc if no arena can be added
+     */
+    size_t acquire(size_t order, void** out, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t taken = 0;
+        while (taken < count) {
+            try {
+                out[taken] = take_block(order);
+            } catch (...) {
+                if (taken == 0) throw;
+                break;
+            }
+            ++taken;
         }
-        return reference(this, pos);
+        note_checkout(block_size(order) * taken);
+        return taken;
     }
     
     /**
-     * @brief Access element with bounds checking (const)
-     * @param pos Element index
-     * @return Const reference to element
-     * @throws std::out_of_range if pos >= size
+     * @brief Return blocks of one order, coalescing with free buddies
      */
-    const_reference at(size_type pos) const {
-        if (pos >= size_) {
-            throw std::out_of_range("unified_vector::at: index out of range");
+    void release(size_t order, void* const* blocks, size_t count) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < count; ++i) {
+            put_block(static_cast<unsigned char*>(blocks[i]), order);
         }
-        return at_impl(pos);
+        outstanding_.fetch_sub(block_size(order) * count, std::memory_order_relaxed);
     }
     
     /**
-     * @brief Access element without bounds checking
-     * @param pos Element index
-     * @return Reference to element
+     * @brief Allocate a request larger than every size class
      */
-    reference operator[](size_type pos) {
-        return reference(this, pos);
+    void* allocate_large(size_t bytes) {
+        void* ptr = ::operator new(bytes, std::align_val_t(64));
+        note_checkout(bytes);
+        return ptr;
     }
     
-    /**
-     * @brief Access element without bounds checking (const)
-     * @param pos Element index
-     * @return Const reference to element
-     */
-    const_reference operator[](size_type pos) const {
-        return at_impl(pos);
+    void deallocate_large(void* ptr, size_t bytes) noexcept {
+        ::operator delete(ptr, std::align_val_t(64));
+        outstanding_.fetch_sub(bytes, std::memory_order_relaxed);
     }
     
-    /**
-     * @brief Access first element
-     * @return Reference to first element
-     */
-    reference front() {
-        return reference(this, 0);
+private:
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
     }
     
-    /**
-     * @brief Access first element (const)
-     * @return Const reference to first element
-     */
-    const_reference front() const {
-        return at_impl(0);
+    void note_checkout(size_t bytes) {
+        size_t now = outstanding_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_.load(std::memory_order_relaxed);
+        while (now > peak && !peak_.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
     }
     
-    /**
-     * @brief Access last element
-     * @return Reference to last element
-     */
-    reference back() {
-        return reference(this, size_ - 1);
+    static unsigned char* arena_of(unsigned char* block) noexcept {
+        return reinterpret_cast<unsigned char*>(reinterpret_cast<uintptr_t>(block) & ~(arena_bytes - 1));
     }
     
-    /**
-     * @brief Access last element (const)
-     * @return Const reference to last element
-     */
-    const_reference back() const {
-        return at_impl(size_ - 1);
+    static uint8_t* order_map(unsigned char* arena) noexcept {
+        return reinterpret_cast<uint8_t*>(arena);
     }
     
-    /**
-     * @brief Get pointer to underlying data (const)
-     * @return Pointer to data
-     */
-    const T* data() const noexcept {
-        engine_.sync_to_host();
-        return data_impl();
+    void push(unsigned char* block, size_t order) noexcept {
+        auto* node = reinterpret_cast<free_node*>(block);
+        node->prev = nullptr;
+        node->next = free_lists_[order];
+        if (node->next) node->next->prev = node;
+        free_lists_[order] = node;
+        nonempty_ |= uint32_t(1) << order;
+        unsigned char* arena = arena_of(block);
+        order_map(arena)[(block - arena) >> min_shift] = static_cast<uint8_t>(order);
     }
     
-    // ==================== Iterators ====================
+    void unlink(unsigned char* block, size_t order) noexcept {
+        auto* node = reinterpret_cast<free_node*>(block);
+        if (node->prev) node->prev->next = node->next;
+        else free_lists_[order] = node->next;
+        if (node->next) node->next->prev = node->prev;
+        if (!free_lists_[order]) nonempty_ &= ~(uint32_t(1) << order);
+        unsigned char* arena = arena_of(block);
+        order_map(arena)[(block - arena) >> min_shift] = not_free;
+    }
     
-    iterator begin() noexcept;
-    const_iterator begin() const noexcept;
-    const_iterator cbegin() const noexcept;
+    unsigned char* take_block(size_t order) {
+        uint32_t candidates = nonempty_ & ~((uint32_t(1) << order) - 1);
+        if (candidates == 0) {
+            add_arena();
+            candidates = nonempty_ & ~((uint32_t(1) << order) - 1);
+        }
+        size_t found = order;
+        while (!(candidates & (uint32_t(1) << found))) ++found;
+        auto* block = reinterpret_cast<unsigned char*>(free_lists_[found]);
+        unlink(block, found);
+        // Split down to the requested class, freeing the upper halves
+        while (found > order) {
+            --found;
+            push(block + block_size(found), found);
+        }
+        return block;
+    }
+    
+    void put_block(unsigned char* block, size_t order) noexcept {
+        unsigned char* arena = arena_of(block);
+        uint8_t* map = order_map(arena);
+        size_t index = static_cast<size_t>(block - arena) >> min_shift;
+        while (order + 1 < num_orders) {
+            size_t buddy = index ^ (size_t(1) << order);
+            if (map[buddy] != order) break;
+            unlink(arena + (buddy << min_shift), order);
+            index &= ~(size_t(1) << order);
+            ++order;
+        }
+        push(arena + (index << min_shift), order);
+    }
     
-    iterator end() noexcept;
-    const_iterator end() const noexcept;
-    const_iterator cend() const noexcept;
+    void add_arena() {
+        auto* arena = static_cast<unsigned char*>(::operator new(arena_bytes, std::align_val_t(arena_bytes)));
+        arenas_.push_back(arena);
+        // The order map occupies the first block of order meta_order; the rest
+        // of the arena is one free buddy of each order from meta_order upwards
+        std::memset(arena, not_free, block_size(meta_order));
+        for (size_t order = meta_order; order < num_orders; ++order) {
+            push(arena + block_size(order), order);
+        }
+    }
+};
+
+/**
+ * @brief Per-thread block cache for small size classes
+ *
+ * Each thread keeps a short stack of free blocks per size class and heap,
+ * refilled from and flushed to the shared heap in batches so that the
+ * common allocate/deallocate pair takes no lock.
+ */
+class thread_block_cache {
+public:
+    static constexpr size_t cached_orders = 10;        ///< Classes up to 32 KiB are cached
+    static constexpr size_t bin_bytes = 64 * 1024;     ///< Byte budget per bin
+    static constexpr size_t max_bin = 64;
     
-    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
-    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
-    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+    struct bin {
+        void* blocks[max_bin];
+        size_t count = 0;
+    };
     
-    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
-    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
-    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+    struct entry {
+        uint64_t heap_id;
+        std::weak_ptr<buddy_heap> owner;
+        bin bins[cached_orders];
+    };
     
-    // ==================== Capacity ====================
+private:
+    std::vector<std::unique_ptr<entry>> entries_;
+    entry* last_ = nullptr;
     
-    /**
-     * @brief Check if vector is empty
-     * @return True if size == 0
-     */
-    bool empty() const noexcept {
-        return size_ == 0;
+public:
+    ~thread_block_cache() {
+        for (auto& e : entries_) {
+            if (auto heap = e->owner.lock()) {
+                for (size_t order = 0; order < cached_orders; ++order) {
+                    heap->release(order, e->bins[order].blocks, e->bins[order].count);
+                }
+            }
+        }
     }
     
-    /**
-     * @brief Get number of elements
-     * @return Current size
-     */
-    size_type size() const noexcept {
-        return size_;
+    static size_t capacity(size_t order) noexcept {
+        return std::min(max_bin, std::max<size_t>(4, bin_bytes / buddy_heap::block_size(order)));
     }
     
     /**
-     * @brief Get maximum possible size
-     * @return Maximum size
+     * @brief Get this thread's cache entry for a heap
+     * @throws std::bad_alloc if a new entry cannot be created
      */
-    size_type max_size() const noexcept {
-        return std::numeric_limits<size_type>::max() / sizeof(T);
+    entry& lookup(buddy_heap& heap) {
+        if (last_ && last_->heap_id == heap.id()) return *last_;
+        for (auto& e : entries_) {
+            if (e->heap_id == heap.id()) {
+                last_ = e.get();
+                return *last_;
+            }
+        }
+        // Drop entries of destroyed heaps; their blocks are already gone
+        entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                      [](const std::unique_ptr<entry>& e) { return e->owner.expired(); }),
+                       entries_.end());
+        auto fresh = std::make_unique<entry>();
+        fresh->heap_id = heap.id();
+        fresh->owner = heap.shared_from_this();
+        last_ = fresh.get();
+        entries_.push_back(std::move(fresh));
+        return *last_;
+    }
+    
+    static thread_block_cache& local() {
+        static thread_local thread_block_cache cache;
+        return cache;
     }
+};
+
+} // namespace detail
+
+/**
+ * @brief Memory pool for efficient allocation
+ *
+ * Requests are rounded up to power-of-two size classes (64 B to 2 MiB)
+ * served by a buddy heap: O(1) free lists per class, splitting of larger
+ * blocks on demand and coalescing of freed buddies. Classes up to 32 KiB
+ * are additionally cached per thread and moved to and from the shared heap
+ * in batches. Larger requests bypass the pool.
+ *
+ * @tparam T Element type
+ */
+template<typename T>
+class memory_pool {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using pointer = T*;
+    
+private:
+    static_assert(alignof(T) <= (size_t(1) << detail::buddy_heap::min_shift),
+                  "memory_pool: over-aligned types are not supported");
+    
+    using cache_type = detail::thread_block_cache;
     
+    std::shared_ptr<detail::buddy_heap> heap_;    ///< Shared with thread caches
+    
+public:
     /**
-     * @brief Reserve capacity
-     * @param new_cap New capacity
+     * @brief Constructor
+     * @param initial_capacity Elements to pre-map so early allocations do not grow the pool
      */
-    void reserve(size_type new_cap) {
-        if (new_cap > capacity()) {
-            engine_.resize(new_cap);
+    explicit memory_pool(size_type initial_capacity = 0)
+        : heap_(std::make_shared<detail::buddy_heap>())
+    {
+        if (initial_capacity > 0) {
+            heap_->reserve(initial_capacity * sizeof(T));
         }
     }
     
     /**
-     * @brief Get current capacity
-     * @return Capacity
+     * @brief Destructor - releases every arena (outstanding blocks become invalid)
      */
-    size_type capacity() const noexcept {
-        return engine_.capacity();
-    }
+    ~memory_pool() = default;
+    
+    // Non-copyable, non-movable (allocators hold a pointer to the pool)
+    memory_pool(const memory_pool&) = delete;
+    memory_pool& operator=(const memory_pool&) = delete;
     
     /**
-     * @brief Reduce capacity to fit size
+     * @brief Allocate memory from pool
+     * @param size Size to allocate in elements
+     * @return Pointer to allocated memory
+     * @throws std::bad_alloc if allocation fails
      */
-    void shrink_to_fit() {
-        if (size_ < capacity()) {
-            engine_.resize(size_);
+    pointer allocate(size_type size) {
+        size_t bytes = std::max<size_t>(size * sizeof(T), 1);
+        if (bytes > detail::buddy_heap::max_block) {
+            return static_cast<pointer>(heap_->allocate_large(bytes));
+        }
+        size_t order = detail::buddy_heap::order_for(bytes);
+        if (order >= cache_type::cached_orders) {
+            void* block;
+            heap_->acquire(order, &block, 1);
+            return static_cast<pointer>(block);
+        }
+        
+        auto& bin = cache_type::local().lookup(*heap_).bins[order];
+        if (bin.count == 0) {
+            bin.count = heap_->acquire(order, bin.blocks, cache_type::capacity(order) / 2);
         }
+        return static_cast<pointer>(bin.blocks[--bin.count]);
     }
     
-    // ==================== Modifiers ====================
-    
     /**
-     * @brief Clear all elements
+     * @brief Deallocate memory back to pool
+     * @param ptr Pointer to deallocate
+     * @param size Size of allocation (as passed to allocate)
      */
-    void clear() noexcept {
-        size_ = 0;
-        engine_.clear_dirty_ranges();
+    void deallocate(pointer ptr, size_type size) noexcept {
+        if (!ptr) return;
+        size_t bytes = std::max<size_t>(size * sizeof(T), 1);
+        if (bytes > detail::buddy_heap::max_block) {
+            heap_->deallocate_large(ptr, bytes);
+            return;
+        }
+        size_t order = detail::buddy_heap::order_for(bytes);
+        if (order >= cache_type::cached_orders) {
+            void* block = ptr;
+            heap_->release(order, &block, 1);
+            return;
+        }
+        
+        cache_type::entry* cache;
+        try {
+            cache = &cache_type::local().lookup(*heap_);
+        } catch (...) {
+            // Creating this thread's cache entry failed; bypass the cache
+            void* block = ptr;
+            heap_->release(order, &block, 1);
+            return;
+        }
+        
+        auto& bin = cache->bins[order];
+        size_t limit = cache_type::capacity(order);
+        if (bin.count == limit) {
+            // Flush the older half so the next frees stay local
+            size_t flush = limit / 2;
+            heap_->release(order, bin.blocks, flush);
+            std::copy(bin.blocks + flush, bin.blocks + bin.count, bin.blocks);
+            bin.count -= flush;
+        }
+        bin.blocks[bin.count++] = ptr;
     }
     
     /**
-     * @brief Insert element at position
-     * @param pos Position to insert at
-     * @param value Value to insert
-     * @return Iterator to inserted element
+     * @brief Get current usage statistics
+     * @return Elements checked out of the shared heap (including thread-cached blocks)
      */
-    iterator insert(const_iterator pos, const T& value);
+    size_type get_allocated() const {
+        return heap_->outstanding() / sizeof(T);
+    }
     
     /**
-     * @brief Insert element at position (move)
-     * @param pos Position to insert at
-     * @param value Value to insert
-     * @return Iterator to inserted element
+     * @brief Get peak usage
+     * @return Peak of get_allocated()
      */
-    iterator insert(const_iterator pos, T&& value);
+    size_type get_peak_usage() const {
+        return heap_->peak() / sizeof(T);
+    }
+};
+
+/**
+ * @brief Get the process-wide byte pool used by default-constructed pool_allocators
+ * @return Reference to the shared pool
+ */
+inline memory_pool<unsigned char>& get_default_pool() {
+    // Never destroyed: containers with static storage duration may return
+    // blocks after other statics have been torn down
+    static memory_pool<unsigned char>* pool = new memory_pool<unsigned char>();
+    return *pool;
+}
+
+/**
+ * @brief Standard allocator drawing storage from a memory_pool
+ *
+ * Freed blocks go back to the pool and are handed out again to later
+ * allocations instead of returning to the system allocator, which suits
+ * many short-lived containers of similar size. Allocators compare equal
+ * when they share a pool.
+ *
+ * @tparam T Element type
+ */
+template<typename T>
+class pool_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using pool_type = memory_pool<unsigned char>;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
     
-    /**
-     * @brief Erase element at position
-     * @param pos Position to erase
-     * @return Iterator to next element
-     */
-    iterator erase(const_iterator pos);
+    template<typename U>
+    struct rebind {
+        using other = pool_allocator<U>;
+    };
     
-    /**
-     * @brief Erase range of elements
-     * @param first Beginning of range
-     * @param last End of range
-     * @return Iterator to next element
-     */
-    iterator erase(const_iterator first, const_iterator last);
+private:
+    static_assert(alignof(T) <= (size_t(1) << detail::buddy_heap::min_shift),
+                  "pool_allocator: over-aligned types are not supported");
     
-    /**
-     * @brief Add element to end
-     * @param value Value to add
-     */
-    void push_back(const T& value) {
-        if (size_ >= capacity()) {
-            size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
-            reserve(new_cap);
-        }
-        data_impl()[size_] = value;
-        engine_.mark_host_dirty(size_, size_ + 1);
-        ++size_;
-    }
+    pool_type* pool_;    ///< Backing pool (never null)
+    
+    template<typename U> friend class pool_allocator;
     
+public:
     /**
-     * @brief Add element to end (move)
-     * @param value Value to add
+     * @brief Construct allocator using the process-wide pool
      */
-    void push_back(T&& value) {
-        if (size_ >= capacity()) {
-            size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
-            reserve(new_cap);
-        }
-        data_impl()[size_] = std::move(value);
-        engine_.mark_host_dirty(size_, size_ + 1);
-        ++size_;
-    }
+    pool_allocator() noexcept : pool_(&get_default_pool()) {}
     
     /**
-     * @brief Construct element in place at end
-     * @tparam Args Constructor argument types
-     * @param args Constructor arguments
-     * @return Reference to constructed element
+     * @brief Construct allocator using a specific pool
+     * @param pool Backing pool (must outlive every allocation made through it)
      */
-    template<typename... Args>
-    reference emplace_back(Args&&... args) {
-        if (size_ >= capacity()) {
-            size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
-            reserve(new_cap);
-        }
-        new (&data_impl()[size_]) T(std::forward<Args>(args)...);
-        engine_.mark_host_dirty(size_, size_ + 1);
-        return reference(this, size_++);
-    }
+    explicit pool_allocator(pool_type& pool) noexcept : pool_(&pool) {}
     
     /**
-     * @brief Remove last element
+     * @brief Rebinding copy constructor
      */
-    void pop_back() {
-        if (size_ > 0) {
-            --size_;
-        }
-    }
+    template<typename U>
+    pool_allocator(const pool_allocator<U>& other) noexcept : pool_(other.pool_) {}
     
     /**
-     * @brief Resize vector
-     * @param count New size
+     * @brief Allocate storage for n elements
+     * @param n Number of elements
+     * @return Pointer to uninitialized storage
+     * @throws std::bad_alloc if allocation fails
      */
-    void resize(size_type count) {
-        resize(count, T());
+    T* allocate(size_type n) {
+        return reinterpret_cast<T*>(pool_->allocate(n * sizeof(T)));
     }
     
     /**
-     * @brief Resize vector with value
-     * @param count New size
-     * @param value Value for new elements
+     * @brief Return storage to the pool
+     * @param ptr Pointer from allocate()
+     * @param n Number of elements passed to allocate()
      */
-    void resize(size_type count, const T& value) {
-        if (count > capacity()) {
-            reserve(count);
-        }
-        if (count > size_) {
-            std::fill_n(data_impl() + size_, count - size_, value);
-            engine_.mark_host_dirty(size_, count);
-        }
-        size_ = count;
+    void deallocate(T* ptr, size_type n) noexcept {
+        pool_->deallocate(reinterpret_cast<unsigned char*>(ptr), n * sizeof(T));
     }
     
     /**
-     * @brief Swap with another vector
-     * @param other Other vector
+     * @brief Get backing pool
+     * @return Reference to the pool
      */
-    void swap(unified_vector& other) noexcept {
-        std::swap(engine_, other.engine_);
-        std::swap(size_, other.size_);
+    pool_type& pool() const noexcept {
+        return *pool_;
     }
     
-    // ==================== Internal Implementation ====================
+    template<typename U>
+    bool operator==(const pool_allocator<U>& other) const noexcept {
+        return pool_ == other.pool_;
+    }
     
+    template<typename U>
+    bool operator!=(const pool_allocator<U>& other) const noexcept {
+        return pool_ != other.pool_;
+    }
+};
+
+/**
+ * @brief Pinned memory pool statistics
+ */
+struct pinned_stats {
+    uint64_t allocations;   ///< Pinned allocations served
+    uint64_t pool_hits;     ///< Allocations served from freed regions
+    uint64_t lock_failures; ///< Regions that could not be page-locked
+    size_t live_bytes;      ///< Bytes handed out and not yet freed
+    size_t cached_bytes;    ///< Freed bytes kept for reuse
+
+    pinned_stats()
+        : allocations(0), pool_hits(0), lock_failures(0), live_bytes(0), cached_bytes(0)
+    {}
+};
+
+namespace detail {
+
+/**
+ * @brief Pool of page-locked host regions
+ *
+ * Regions come from sycl::malloc_host when SYCL is enabled and from
+ * mmap + mlock on Linux otherwise. Pinning and unpinning cost a system
+ * call and page-table walk each, so freed regions are kept by size bucket
+ * (page granular, four buckets per power of two) up to
+ * VULKAN_STDPAR_PINNED_POOL_BYTES and handed out again. If mlock fails
+ * (typically RLIMIT_MEMLOCK), the region stays usable but unlocked.
+ */
+class pinned_pool {
 private:
+    struct region {
+        size_t bytes;   ///< Bucket size
+        bool locked;    ///< Page-locked by mlock or the SYCL runtime
+    };
+
+    mutable std::mutex mutex_;                          ///< Protects all members
+    std::map<size_t, std::vector<void*>> free_;         ///< Freed regions by bucket size
+    std::unordered_map<void*, region> regions_;         ///< Every region owned by the pool
+    size_t limit_;                                      ///< Cached byte limit
+    pinned_stats stats_;                                ///< Counters
+
+public:
+    pinned_pool() : limit_(VULKAN_STDPAR_PINNED_POOL_BYTES) {}
+
+    pinned_pool(const pinned_pool&) = delete;
+    pinned_pool& operator=(const pinned_pool&) = delete;
+
     /**
-     * @brief Get element value (implementation)
+     * @brief Get the process-wide pool
+     *
+     * Never destroyed, so storage with static lifetime can free into it.
+     *
+     * @return Reference to the shared pool
      */
-    const T& at_impl(size_type index) const {
-        engine_.sync_to_host();
-        return data_impl()[index];
+    static pinned_pool& instance() {
+        static pinned_pool* pool = new pinned_pool();
+        return *pool;
     }
-    
+
     /**
-     * @brief Set element value (implementation)
+     * @brief Round a request to its bucket size
+     * @param bytes Requested size
+     * @return Page-aligned bucket size
      */
-    void set_impl(size_type index, const T& value) {
-        engine_.sync_to_host();
-        data_impl()[index] = value;
-        engine_.mark_host_dirty(index, index + 1);
+    static size_t bucket_size(size_t bytes) {
+        size_t page = page_size();
+        bytes = std::max(bytes, page);
+        size_t power = page;
+        while (power * 2 <= bytes) power *= 2;
+        size_t step = std::max(page, power / 4);
+        return (bytes + step - 1) / step * step;
     }
-    
+
     /**
-     * @brief Set element value (implementation, move)
+     * @brief Allocate a page-aligned pinned region
+     * @param bytes Minimum size
+     * @return Pointer to bucket_size(bytes) bytes
+     * @throws std::bad_alloc if allocation fails
      */
-    void set_impl(size_type index, T&& value) {
-        engine_.sync_to_host();
-        data_impl()[index] = std::move(value);
-        engine_.mark_host_dirty(index, index + 1);
+    void* allocate(size_t bytes) {
+        size_t bucket = bucket_size(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.allocations;
+            auto it = free_.find(bucket);
+            if (it != free_.end() && !it->second.empty()) {
+                void* ptr = it->second.back();
+                it->second.pop_back();
+                stats_.cached_bytes -= bucket;
+                stats_.live_bytes += bucket;
+                ++stats_.pool_hits;
+                return ptr;
+            }
+        }
+
+        bool locked = false;
+        void* ptr = map_region(bucket, locked);
+        std::lock_guard<std::mutex> lock(mutex_);
+        regions_.emplace(ptr, region{bucket, locked});
+        stats_.live_bytes += bucket;
+        if (!locked) ++stats_.lock_failures;
+        return ptr;
+    }
+
+    /**
+     * @brief Return a region to the pool
+     * @param ptr Pointer from allocate() (null is ignored)
+     */
+    void deallocate(void* ptr) {
+        if (!ptr) return;
+        region released;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = regions_.find(ptr);
+            if (it == regions_.end()) return;
+            released = it->second;
+            stats_.live_bytes -= released.bytes;
+            if (stats_.cached_bytes + released.bytes <= limit_) {
+                free_[released.bytes].push_back(ptr);
+                stats_.cached_bytes += released.bytes;
+                return;
+            }
+            regions_.erase(it);
+        }
+        unmap_region(ptr, released);
     }
-    
+
     /**
-     * @brief Get data pointer (mutable)
+     * @brief Get the usable size of a region
+     * @param ptr Pointer from allocate()
+     * @return Bucket size, or 0 if ptr is not a pool region
      */
-    T* data_impl() {
-        return engine_.host_data();
+    size_t capacity(const void* ptr) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = regions_.find(const_cast<void*>(ptr));
+        return it == regions_.end() ? 0 : it->second.bytes;
     }
-    
+
     /**
-     * @brief Get data pointer (const)
+     * @brief Release every cached region to the system
      */
-    const T* data_impl() const {
-        return engine_.host_data();
+    void trim() {
+        std::vector<std::pair<void*, region>> dropped;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& bucket : free_) {
+                for (void* ptr : bucket.second) {
+                    auto it = regions_.find(ptr);
+                    dropped.emplace_back(ptr, it->second);
+                    regions_.erase(it);
+                }
+            }
+            free_.clear();
+            stats_.cached_bytes = 0;
+        }
+        for (auto& entry : dropped) {
+            unmap_region(entry.first, entry.second);
+        }
     }
-    
-public:
-    // ==================== GPU Integration ====================
-    
+
     /**
-     * @brief Prefetch data to device
+     * @brief Get pool statistics
+     * @return Snapshot of counters
      */
-    void prefetch_to_device() {
-        engine_.sync_to_device();
+    pinned_stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
     }
-    
-    /**
-     * @brief Get versioning engine for GPU operations
-     * @return Reference to versioning engine
-     */
-    versioning_engine<T>& get_engine() {
-        return engine_;
+
+    static size_t page_size() {
+#if defined(__linux__)
+        static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+#else
+        return 4096;
+#endif
     }
-    
-    /**
-     * @brief Get versioning engine (const)
-     * @return Const reference to versioning engine
-     */
-    const versioning_engine<T>& get_engine() const {
-        return engine_;
+
+private:
+    static void* map_region(size_t bytes, bool& locked) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        void* ptr = sycl::malloc_host(bytes, queue::get_default_queue());
+        if (!ptr) throw std::bad_alloc();
+        locked = true;
+        return ptr;
+#elif defined(__linux__)
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) throw std::bad_alloc();
+        locked = ::mlock(ptr, bytes) == 0;
+        return ptr;
+#else
+        locked = false;
+        return ::operator new(bytes, std::align_val_t(page_size()));
+#endif
+    }
+
+    static void unmap_region(void* ptr, const region& r) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        (void)r;
+        sycl::free(ptr, queue::get_default_queue());
+#elif defined(__linux__)
+        if (r.locked) ::munlock(ptr, r.bytes);
+        ::munmap(ptr, r.bytes);
+#else
+        (void)r;
+        ::operator delete(ptr, std::align_val_t(page_size()));
+#endif
     }
 };
 
-// ==================== Non-member Functions ====================
+} // namespace detail
 
 /**
- * @brief Equality comparison
+ * @brief Check if device supports pinned memory
+ * @param device Device information
+ * @return True if pinned memory is supported
  */
-template<typename T>
-bool operator==(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
-    if (lhs.size() != rhs.size()) return false;
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+inline bool supports_pinned_memory(const device_info& device) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+    return device.supports_pinned_memory;
+#elif defined(__linux__)
+    (void)device;
+    return true;
+#else
+    (void)device;
+    return false;
+#endif
 }
 
 /**
- * @brief Inequality comparison
+ * @brief Select pinned memory allocation strategy
+ * 
+ * Small buffers are not worth a pinned region of at least one page and
+ * the locking cost; they keep the automatic strategy.
+ * 
+ * @param size Allocation size in bytes
+ * @return host_pinned for sizes of at least VULKAN_STDPAR_PINNED_MIN_BYTES, otherwise automatic
  */
-template<typename T>
-bool operator!=(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
-    return !(lhs == rhs);
+inline allocation_strategy select_pinned_strategy(size_t size) {
+    return size >= VULKAN_STDPAR_PINNED_MIN_BYTES ? allocation_strategy::host_pinned
+                                                  : allocation_strategy::automatic;
 }
 
 /**
- * @brief Less than comparison
+ * @brief Allocate pinned memory
+ * @param size Size to allocate in bytes
+ * @param device Device information
+ * @return Page-aligned pointer to allocated memory (null for size 0)
+ * @throws std::bad_alloc if allocation fails
  */
-template<typename T>
-bool operator<(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+inline void* allocate_pinned_memory(size_t size, const device_info& device) {
+    (void)device;
+    if (size == 0) return nullptr;
+    return detail::pinned_pool::instance().allocate(size);
 }
 
 /**
- * @brief Swap specialization
+ * @brief Free pinned memory
+ * @param ptr Pointer to free
+ * @param size Size of allocation
  */
-template<typename T>
-void swap(unified_vector<T>& lhs, unified_vector<T>& rhs) noexcept {
-    lhs.swap(rhs);
+inline void free_pinned_memory(void* ptr, size_t size) {
+    (void)size;
+    detail::pinned_pool::instance().deallocate(ptr);
 }
 
-} // namespace vulkan_stdpar
+/**
+ * @brief Get pinned memory pool statistics
+ * @return Snapshot of counters
+ */
+inline pinned_stats get_pinned_stats() {
+    return detail::pinned_pool::instance().stats();
+}
 
-// Include iterator implementation
+/**
+ * @brief Release cached pinned regions to the system
+ */
+inline void trim_pinned_memory() {
+    detail::pinned_pool::instance().trim();
+}
 
+} // namespace memory
 
-// ========== iterators/unified_iterator.hpp ==========
+} // namespace vulkan_stdpar
+
+
+// ========== core/host_storage.hpp ==========
 
 /**
- * @file unified_iterator.hpp
- * @brief Iterator adaptors for unified_vector with sync-on-dereference
+ * @file host_storage.hpp
+ * @brief Aligned, growable raw host storage for versioning_engine
  * @author Vulkan STD-Parallel Team
  * @version 1.0
  * @date 2025-12-02
- * 
- * This file implements iterators for unified_vector that trigger synchronization
- * on dereference to maintain data consistency between host and device.
+ *
+ * This file contains host_storage, the raw element buffer that backs
+ * unified_vector on the host. Small buffers come from aligned operator new;
+ * large buffers on Linux are anonymous mappings that grow with mremap and
+ * can be advised to use transparent huge pages. Storage can also reserve a
+ * large virtual address range up front and commit pages as it grows, so
+ * growth never moves existing elements, or live in pooled page-locked
+ * memory for faster device transfers, or map a file so elements fault in
+ * lazily from disk. A user-supplied allocator replaces all of this with
+ * allocator_traits allocation.
  */
 
 
-#include <iterator>
+#include <algorithm>
+#include <cstddef>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
 #include <type_traits>
+#include <utility>
 
-namespace vulkan_stdpar {
 
-// Forward declarations
-template<typename T> class unified_vector;
-template<typename T> class unified_reference;
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VULKAN_STDPAR_HAS_MMAP 1
+#endif
 
 /**
- * @brief Mutable iterator for unified_vector
- * @tparam T Element type
+ * @brief Default byte alignment of host storage (SIMD friendly)
  */
-template<typename T>
-class unified_iterator {
-public:
-    // Iterator traits
-    using iterator_category = std::random_access_iterator_tag;
-    using value_type = T;
-    using difference_type = ptrdiff_t;
-    using pointer = void;  // Disabled to prevent pointer escape
-    using reference = unified_reference<T>;
-    
-private:
-    unified_vector<T>* container_;    ///< Parent container
-    size_t index_;                     ///< Current position
-    
-    // Friend declarations
-    template<typename U> friend class unified_vector;
-    template<typename U> friend class const_unified_iterator;
-    
-public:
-    /**
-     * @brief Default constructor
-     */
-    unified_iterator() : container_(nullptr), index_(0) {}
-    
-    /**
-     * @brief Construct iterator
-     * @param container Parent container
-     * @param index Start position
-     */
-    unified_iterator(unified_vector<T>* container, size_t index)
-        : container_(container), index_(index)
+#ifndef VULKAN_STDPAR_HOST_ALIGNMENT
+#define VULKAN_STDPAR_HOST_ALIGNMENT 64
+#endif
+
+/**
+ * @brief Allocation size (bytes) from which host storage is mmap-backed
+ */
+#ifndef VULKAN_STDPAR_HOST_MMAP_THRESHOLD
+#define VULKAN_STDPAR_HOST_MMAP_THRESHOLD (2u * 1024u * 1024u)
+#endif
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Host storage configuration
+ */
+struct storage_options {
+    size_t alignment;       ///< Byte alignment of element storage (power of two)
+    bool huge_pages;        ///< Advise transparent huge pages for mmap-backed storage
+    size_t reserve_bytes;   ///< Virtual address space reserved up front (0 disables)
+    bool pinned;            ///< Place elements in page-locked memory from the pinned pool
+    bool copy_on_write;     ///< Copies share storage until one of them is written
+    numa_placement placement; ///< NUMA page placement of mmap-backed storage
+
+    storage_options()
+        : alignment(VULKAN_STDPAR_HOST_ALIGNMENT)
+        , huge_pages(true)
+        , reserve_bytes(0)
+        , pinned(false)
+        , copy_on_write(false)
+        , placement(numa_placement::local)
     {}
-    
-    /**
-     * @brief Copy constructor
-     */
-    unified_iterator(const unified_iterator&) = default;
-    
+};
+
+/**
+ * @brief How a file-backed vector relates to its file
+ */
+enum class map_mode {
+    read_only,  ///< File is never written; modified pages become private copies
+    read_write  ///< Shared mapping; modifications and growth are written to the file
+};
+
+/**
+ * @brief Aligned raw element buffer with realloc semantics
+ *
+ * Elements are not constructed or destroyed by the storage; the owning
+ * container is responsible for element lifetime (T is expected to be
+ * trivially copyable). Growing preserves the first `preserve` elements;
+ * mremap only relocates trivially copyable elements, others are moved.
+ *
+ * With std::allocator the storage manages memory itself (aligned heap,
+ * mmap, reserved address space). Any other allocator is used as-is through
+ * std::allocator_traits; storage_options are then ignored.
+ *
+ * @tparam T Element type
+ * @tparam Alloc Allocator type
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class host_storage {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using allocator_type = Alloc;
+
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                  "host_storage: allocator value_type must match T");
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "host_storage: fancy allocator pointers are not supported");
+
+    /// True when memory is managed directly rather than through Alloc
+    static constexpr bool raw_storage = std::is_same<Alloc, std::allocator<T>>::value;
+
+private:
     /**
-     * @brief Copy assignment
-     */
-    unified_iterator& operator=(const unified_iterator&) = default;
-    
+     * @brief Origin of the current allocation
+     */
+    enum class origin {
+        none,       ///< No allocation
+        heap,       ///< Aligned operator new
+        mapped,     ///< Anonymous mmap
+        reserved,   ///< PROT_NONE reservation with committed prefix
+        pinned,     ///< Region from the pinned memory pool
+        file,       ///< Mapping of a file (fd_ open)
+        allocator   ///< User allocator
+    };
+
+    T* data_;                   ///< Element storage
+    size_type capacity_;        ///< Capacity in elements
+    size_t bytes_;              ///< Allocated (committed) bytes
+    size_t reserved_;           ///< Reserved address space in bytes
+    origin origin_;             ///< Allocation origin
+    int fd_;                    ///< Mapped file descriptor (origin::file)
+    size_t file_offset_;        ///< File offset of the first element (origin::file)
+    bool file_shared_;          ///< File mapping writes through to the file
+    storage_options options_;   ///< Configuration
+    Alloc alloc_;               ///< Element allocator
+
+public:
     /**
-     * @brief Dereference operator
-     * @return Reference to current element
-     */
-    reference operator*() const {
-        return reference(container_, index_);
+     * @brief Construct storage
+     * @param capacity Initial capacity in elements
+     * @param options Storage configuration
+     * @param alloc Element allocator
+     */
+    explicit host_storage(size_type capacity = 0, const storage_options& options = storage_options(),
+                          const Alloc& alloc = Alloc())
+        : data_(nullptr)
+        , capacity_(0)
+        , bytes_(0)
+        , reserved_(0)
+        , origin_(origin::none)
+        , fd_(-1)
+        , file_offset_(0)
+        , file_shared_(false)
+        , options_(options)
+        , alloc_(alloc)
+    {
+        options_.alignment = std::max(options_.alignment, alignof(T));
+        reallocate(capacity, 0);
     }
-    
+
     /**
-     * @brief Subscript operator
-     * @param n Offset
-     * @return Reference to element at offset
+     * @brief Destructor - releases the allocation
      */
-    reference operator[](difference_type n) const {
-        return reference(container_, index_ + n);
+    ~host_storage() {
+        release();
     }
-    
-    // ==================== Increment/Decrement ====================
-    
-    /**
-     * @brief Pre-increment
-     */
-    unified_iterator& operator++() {
-        ++index_;
+
+    // Non-copyable but movable
+    host_storage(const host_storage&) = delete;
+    host_storage& operator=(const host_storage&) = delete;
+
+    host_storage(host_storage&& other) noexcept
+        : data_(other.data_)
+        , capacity_(other.capacity_)
+        , bytes_(other.bytes_)
+        , reserved_(other.reserved_)
+        , origin_(other.origin_)
+        , fd_(other.fd_)
+        , file_offset_(other.file_offset_)
+        , file_shared_(other.file_shared_)
+        , options_(other.options_)
+        , alloc_(std::move(other.alloc_))
+    {
+        other.data_ = nullptr;
+        other.capacity_ = 0;
+        other.bytes_ = 0;
+        other.reserved_ = 0;
+        other.origin_ = origin::none;
+        other.fd_ = -1;
+    }
+
+    host_storage& operator=(host_storage&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            bytes_ = other.bytes_;
+            reserved_ = other.reserved_;
+            origin_ = other.origin_;
+            fd_ = other.fd_;
+            file_offset_ = other.file_offset_;
+            file_shared_ = other.file_shared_;
+            options_ = other.options_;
+            alloc_ = std::move(other.alloc_);
+            other.data_ = nullptr;
+            other.capacity_ = 0;
+            other.bytes_ = 0;
+            other.reserved_ = 0;
+            other.origin_ = origin::none;
+            other.fd_ = -1;
+        }
         return *this;
     }
-    
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    size_type capacity() const noexcept { return capacity_; }
+    const storage_options& options() const noexcept { return options_; }
+    Alloc get_allocator() const { return alloc_; }
+
     /**
-     * @brief Post-increment
+     * @brief Check whether storage is backed by an mmap region
+     * @return True for mapped storage
      */
-    unified_iterator operator++(int) {
-        unified_iterator temp = *this;
-        ++index_;
-        return temp;
+    bool is_mapped() const noexcept {
+        return origin_ == origin::mapped || origin_ == origin::reserved || origin_ == origin::file;
     }
-    
+
     /**
-     * @brief Pre-decrement
+     * @brief Check whether storage is a mapping of a file
+     * @return True after map_file() until the storage detaches or is released
      */
-    unified_iterator& operator--() {
-        --index_;
-        return *this;
+    bool is_file_mapped() const noexcept {
+        return origin_ == origin::file;
     }
-    
+
     /**
-     * @brief Post-decrement
+     * @brief Check whether storage is page-locked pinned memory
+     * @return True for storage from the pinned pool
      */
-    unified_iterator operator--(int) {
-        unified_iterator temp = *this;
-        --index_;
-        return temp;
+    bool is_pinned() const noexcept {
+        return origin_ == origin::pinned;
     }
-    
-    // ==================== Arithmetic ====================
-    
+
     /**
-     * @brief Add offset
+     * @brief Get the largest capacity reachable without moving elements
+     * @return Capacity in elements (equals capacity() unless address space is reserved)
      */
-    unified_iterator& operator+=(difference_type n) {
-        index_ += n;
-        return *this;
+    size_type reserved_capacity() const noexcept {
+        return origin_ == origin::reserved ? reserved_ / sizeof(T) : capacity_;
     }
-    
+
     /**
-     * @brief Subtract offset
+     * @brief Replace the allocation with a mapping of a file
+     *
+     * Capacity becomes the number of elements in [offset, offset + length).
+     * Pages are read from disk on first access. A read_write mapping grows
+     * the file when capacity grows, so it must extend to the end of the
+     * file; a read_only mapping moves to anonymous memory instead.
+     *
+     * @param path File to map
+     * @param mode Whether modifications reach the file
+     * @param offset Byte offset of the first element (multiple of alignof(T))
+     * @param length Bytes to map (default: to the end of the file)
+     * @throws invalid_argument_exception if the range is misaligned, outside the
+     *         file, not a whole number of elements, or short of the end of a
+     *         read_write file
+     * @throws io_exception if the file cannot be opened or mapped
      */
-    unified_iterator& operator-=(difference_type n) {
-        index_ -= n;
-        return *this;
+    void map_file(const std::string& path, map_mode mode, size_t offset = 0,
+                  size_t length = static_cast<size_t>(-1)) {
+        static_assert(raw_storage, "host_storage: file mapping requires std::allocator");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        int fd = ::open(path.c_str(), mode == map_mode::read_write ? O_RDWR : O_RDONLY);
+        if (fd < 0) {
+            throw io_exception(path, std::strerror(errno));
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            int error = errno;
+            ::close(fd);
+            throw io_exception(path, std::strerror(error));
+        }
+        size_t file_bytes = static_cast<size_t>(info.st_size);
+        if (offset % alignof(T) != 0 || offset > file_bytes) {
+            ::close(fd);
+            throw invalid_argument_exception("offset", "must be element aligned and within " + path);
+        }
+        size_t bytes = std::min(length, file_bytes - offset);
+        if (bytes % sizeof(T) != 0) {
+            ::close(fd);
+            throw invalid_argument_exception("path", path + " is not a whole number of elements");
+        }
+        if (mode == map_mode::read_write && offset + bytes != file_bytes) {
+            ::close(fd);
+            throw invalid_argument_exception("length", "read_write mappings must reach the end of " + path);
+        }
+
+        // Mappings start on a page; elements start lead bytes into the first one
+        size_t lead = offset % page_size();
+        char* ptr = nullptr;
+        if (bytes > 0) {
+            // Private mappings are copy-on-write, so read_only files stay untouched
+            int flags = mode == map_mode::read_write ? MAP_SHARED : MAP_PRIVATE;
+            void* base = ::mmap(nullptr, lead + bytes, PROT_READ | PROT_WRITE, flags, fd,
+                                static_cast<off_t>(offset - lead));
+            if (base == MAP_FAILED) {
+                int error = errno;
+                ::close(fd);
+                throw io_exception(path, std::strerror(error));
+            }
+            ptr = static_cast<char*>(base) + lead;
+        }
+
+        release();
+        data_ = reinterpret_cast<T*>(ptr);
+        bytes_ = bytes;
+        capacity_ = bytes / sizeof(T);
+        origin_ = origin::file;
+        fd_ = fd;
+        file_offset_ = offset;
+        file_shared_ = mode == map_mode::read_write;
+#else
+        (void)path;
+        (void)mode;
+        (void)offset;
+        (void)length;
+        throw unsupported_operation_exception("map_file without mmap");
+#endif
     }
-    
+
     /**
-     * @brief Add offset (non-modifying)
+     * @brief Write modified pages of a read_write mapping back to the file
+     * @throws io_exception if msync fails
      */
-    unified_iterator operator+(difference_type n) const {
-        return unified_iterator(container_, index_ + n);
+    void flush() {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (origin_ == origin::file && file_shared_ && bytes_ > 0) {
+            if (::msync(file_base(), file_lead() + bytes_, MS_SYNC) != 0) {
+                throw io_exception("mapped file", std::strerror(errno));
+            }
+        }
+#endif
     }
-    
+
     /**
-     * @brief Subtract offset (non-modifying)
+     * @brief Unmap a file, trimming a read_write file to its used length
+     *
+     * Capacity growth extends the file ahead of the elements actually
+     * written; this cuts it back. The storage is empty afterwards.
+     *
+     * @param used_bytes Bytes of the file that hold elements
      */
-    unified_iterator operator-(difference_type n) const {
-        return unified_iterator(container_, index_ - n);
+    void close_file(size_t used_bytes) noexcept {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (origin_ != origin::file) return;
+        int fd = fd_;
+        bool trim = file_shared_ && used_bytes < bytes_;
+        fd_ = -1;
+        release();
+        if (trim) {
+            (void)::ftruncate(fd, static_cast<off_t>(file_offset_ + used_bytes));
+        }
+        ::close(fd);
+#else
+        (void)used_bytes;
+#endif
     }
-    
+
     /**
-     * @brief Distance between iterators
+     * @brief Change capacity, preserving leading elements
+     * @param new_capacity New capacity in elements
+     * @param preserve Number of leading elements to keep
+     * @throws std::bad_alloc if allocation fails
+     * @throws io_exception if a read_write file mapping cannot be resized
      */
-    difference_type operator-(const unified_iterator& other) const {
-        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    void reallocate(size_type new_capacity, size_type preserve) {
+        if (new_capacity == capacity_) return;
+        preserve = std::min({preserve, capacity_, new_capacity});
+
+        if (new_capacity == 0) {
+            release();
+            return;
+        }
+
+        if constexpr (!raw_storage) {
+            T* fresh = alloc_traits::allocate(alloc_, new_capacity);
+            move_elements(fresh, preserve);
+            release();
+            data_ = fresh;
+            bytes_ = new_capacity * sizeof(T);
+            capacity_ = new_capacity;
+            origin_ = origin::allocator;
+            return;
+        }
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (origin_ == origin::file && file_shared_) {
+            resize_file(new_capacity, preserve);
+            return;
+        }
+#endif
+
+        size_t new_bytes = round_up(new_capacity * sizeof(T), options_.alignment);
+
+        if (options_.pinned && options_.alignment <= memory::detail::pinned_pool::page_size()) {
+            grow_pinned(new_capacity, new_bytes, preserve);
+            return;
+        }
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (options_.reserve_bytes > 0 && options_.alignment <= page_size()) {
+            grow_reserved(new_capacity, new_bytes, preserve);
+            return;
+        }
+
+        if (use_mapping(new_bytes)) {
+            new_bytes = round_up(new_bytes, page_size());
+            if (origin_ == origin::mapped) {
+                // Page tables move; element data is never copied. Objects that
+                // are not trivially copyable may only stay where they are.
+                constexpr int flags = std::is_trivially_copyable<T>::value ? MREMAP_MAYMOVE : 0;
+                void* moved = ::mremap(data_, bytes_, new_bytes, flags);
+                if (moved != MAP_FAILED) {
+                    data_ = static_cast<T*>(moved);
+                    bytes_ = new_bytes;
+                    capacity_ = new_capacity;
+                    advise(data_, bytes_);
+                    return;
+                }
+                if (flags != 0) throw std::bad_alloc();
+            }
+            T* fresh = map(new_bytes);
+            move_elements(fresh, preserve);
+            release();
+            data_ = fresh;
+            bytes_ = new_bytes;
+            capacity_ = new_capacity;
+            origin_ = origin::mapped;
+            return;
+        }
+#endif
+
+        T* fresh = static_cast<T*>(::operator new(new_bytes, std::align_val_t(options_.alignment)));
+        move_elements(fresh, preserve);
+        release();
+        data_ = fresh;
+        bytes_ = new_bytes;
+        capacity_ = new_capacity;
+        origin_ = origin::heap;
     }
-    
-    // ==================== Comparison ====================
-    
-    /**
-     * @brief Equality comparison
-     */
-    bool operator==(const unified_iterator& other) const {
-        return container_ == other.container_ && index_ == other.index_;
+
+private:
+    static size_t round_up(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void move_elements(T* destination, size_type count) {
+        if (count == 0) return;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memcpy(static_cast<void*>(destination), data_, count * sizeof(T));
+        } else {
+            // destination is raw memory: construct there, then end the moved-from objects
+            std::uninitialized_move(data_, data_ + count, destination);
+            std::destroy(data_, data_ + count);
+        }
     }
-    
-    /**
-     * @brief Inequality comparison
-     */
-    bool operator!=(const unified_iterator& other) const {
-        return !(*this == other);
+
+    void release() noexcept {
+        switch (origin_) {
+        case origin::heap:
+            ::operator delete(data_, std::align_val_t(options_.alignment));
+            break;
+        case origin::mapped:
+#ifdef VULKAN_STDPAR_HAS_MMAP
+            ::munmap(data_, bytes_);
+#endif
+            break;
+        case origin::reserved:
+#ifdef VULKAN_STDPAR_HAS_MMAP
+            ::munmap(data_, reserved_);
+#endif
+            break;
+        case origin::pinned:
+            memory::detail::pinned_pool::instance().deallocate(data_);
+            break;
+        case origin::file:
+#ifdef VULKAN_STDPAR_HAS_MMAP
+            if (data_) ::munmap(file_base(), file_lead() + bytes_);
+            if (fd_ >= 0) ::close(fd_);
+#endif
+            fd_ = -1;
+            break;
+        case origin::allocator:
+            alloc_traits::deallocate(alloc_, data_, capacity_);
+            break;
+        case origin::none:
+            break;
+        }
+        data_ = nullptr;
+        capacity_ = 0;
+        bytes_ = 0;
+        reserved_ = 0;
+        origin_ = origin::none;
     }
-    
+
     /**
-     * @brief Less than comparison
+     * @brief Grow within the current pinned region or move to a larger one
      */
-    bool operator<(const unified_iterator& other) const {
-        return index_ < other.index_;
+    void grow_pinned(size_type new_capacity, size_t new_bytes, size_type preserve) {
+        auto& pool = memory::detail::pinned_pool::instance();
+        if (origin_ == origin::pinned && new_bytes <= bytes_) {
+            // Bucket rounding left room; no new pinning needed
+            capacity_ = new_capacity;
+            return;
+        }
+
+        T* fresh = static_cast<T*>(pool.allocate(new_bytes));
+        move_elements(fresh, preserve);
+        release();
+        data_ = fresh;
+        bytes_ = pool.capacity(fresh);
+        capacity_ = new_capacity;
+        origin_ = origin::pinned;
     }
-    
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
     /**
-     * @brief Less than or equal comparison
+     * @brief Resize a shared file mapping together with the file
+     * @param new_capacity New capacity in elements
+     * @param preserve Number of leading elements to keep
+     * @throws io_exception if the file cannot be resized or remapped
      */
-    bool operator<=(const unified_iterator& other) const {
-        return index_ <= other.index_;
+    void resize_file(size_type new_capacity, size_type preserve) {
+        size_t new_bytes = new_capacity * sizeof(T);
+        off_t file_end = static_cast<off_t>(file_offset_ + new_bytes);
+        if (new_bytes > bytes_ && ::ftruncate(fd_, file_end) != 0) {
+            throw io_exception("mapped file", std::strerror(errno));
+        }
+        size_t lead = file_lead();
+        void* ptr;
+        if (!data_) {
+            ptr = map_file_range(lead + new_bytes);
+        } else if constexpr (std::is_trivially_copyable<T>::value) {
+            ptr = ::mremap(file_base(), lead + bytes_, lead + new_bytes, MREMAP_MAYMOVE);
+        } else {
+            ptr = ::mremap(file_base(), lead + bytes_, lead + new_bytes, 0);
+            if (ptr == MAP_FAILED) ptr = relocate_file_mapping(lead + new_bytes, preserve);
+        }
+        if (ptr == MAP_FAILED) throw io_exception("mapped file", std::strerror(errno));
+        if (new_bytes < bytes_) {
+            (void)::ftruncate(fd_, file_end);
+        }
+        data_ = reinterpret_cast<T*>(static_cast<char*>(ptr) + lead);
+        bytes_ = new_bytes;
+        capacity_ = new_capacity;
     }
-    
+
     /**
-     * @brief Greater than comparison
+     * @brief Map the file from the page containing file_offset_
+     * @return Mapping base, or MAP_FAILED
      */
-    bool operator>(const unified_iterator& other) const {
-        return index_ > other.index_;
+    void* map_file_range(size_t bytes) const {
+        return ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+                      static_cast<off_t>(file_offset_ - file_lead()));
     }
-    
+
     /**
-     * @brief Greater than or equal comparison
+     * @brief Move a file mapping that cannot grow in place, keeping the elements
+     *
+     * Both mappings show the same file pages, so the leading elements are
+     * moved out to a temporary buffer and back rather than relocated bitwise.
+     *
+     * @return New mapping base, or MAP_FAILED with the old mapping intact
      */
-    bool operator>=(const unified_iterator& other) const {
-        return index_ >= other.index_;
+    void* relocate_file_mapping(size_t new_mapping_bytes, size_type preserve) {
+        std::allocator<T> temporary_alloc;
+        T* temporary = temporary_alloc.allocate(std::max<size_type>(preserve, 1));
+        std::uninitialized_move(data_, data_ + preserve, temporary);
+        std::destroy(data_, data_ + preserve);
+
+        void* ptr = map_file_range(new_mapping_bytes);
+        T* destination = data_;
+        if (ptr != MAP_FAILED) {
+            ::munmap(file_base(), file_lead() + bytes_);
+            destination = reinterpret_cast<T*>(static_cast<char*>(ptr) + file_lead());
+        }
+        int saved_errno = errno;
+        std::uninitialized_move(temporary, temporary + preserve, destination);
+        std::destroy(temporary, temporary + preserve);
+        temporary_alloc.deallocate(temporary, std::max<size_type>(preserve, 1));
+        errno = saved_errno;
+        return ptr;
     }
-    
+
     /**
-     * @brief Get current index
-     * @return Index into container
+     * @brief Grow inside a reserved address range, committing pages on demand
      */
-    size_t get_index() const {
-        return index_;
+    void grow_reserved(size_type new_capacity, size_t new_bytes, size_type preserve) {
+        new_bytes = round_up(new_bytes, page_size());
+
+        if (origin_ != origin::reserved || new_bytes > reserved_) {
+            // Reserve a fresh range; only happens once unless the reservation is outgrown
+            size_t reserve = round_up(std::max(options_.reserve_bytes, new_bytes), page_size());
+            if (origin_ == origin::reserved) {
+                reserve = std::max(reserve, reserved_ * 2);
+            }
+            void* range = ::mmap(nullptr, reserve, PROT_NONE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (range == MAP_FAILED) throw std::bad_alloc();
+            if (::mprotect(range, new_bytes, PROT_READ | PROT_WRITE) != 0) {
+                ::munmap(range, reserve);
+                throw std::bad_alloc();
+            }
+            advise(range, reserve);
+
+            T* fresh = static_cast<T*>(range);
+            move_elements(fresh, preserve);
+            release();
+            data_ = fresh;
+            bytes_ = new_bytes;
+            reserved_ = reserve;
+            capacity_ = new_capacity;
+            origin_ = origin::reserved;
+            return;
+        }
+
+        if (new_bytes > bytes_) {
+            // Commit the next pages in place; existing elements never move
+            char* base = reinterpret_cast<char*>(data_);
+            if (::mprotect(base + bytes_, new_bytes - bytes_, PROT_READ | PROT_WRITE) != 0) {
+                throw std::bad_alloc();
+            }
+            bytes_ = new_bytes;
+        }
+        capacity_ = new_capacity;
     }
-    
+
     /**
-     * @brief Get container pointer
-     * @return Pointer to container
+     * @brief Bytes between the page-aligned start of a file mapping and data_
      */
-    unified_vector<T>* get_container() const {
-        return container_;
+    size_t file_lead() const {
+        return file_offset_ % page_size();
     }
-};
 
-/**
- * @brief Const iterator for unified_vector
- * @tparam T Element type
- */
-template<typename T>
-class const_unified_iterator {
-public:
-    // Iterator traits
-    using iterator_category = std::random_access_iterator_tag;
-    using value_type = T;
-    using difference_type = ptrdiff_t;
-    using pointer = const T*;
-    using reference = const T&;
-    
-private:
-    const unified_vector<T>* container_;    ///< Parent container
-    size_t index_;                           ///< Current position
-    
-    // Friend declarations
-    template<typename U> friend class unified_vector;
+    void* file_base() const {
+        return reinterpret_cast<char*>(data_) - file_lead();
+    }
+
+    static size_t page_size() {
+        static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    bool use_mapping(size_t bytes) const {
+        return bytes >= VULKAN_STDPAR_HOST_MMAP_THRESHOLD && options_.alignment <= page_size();
+    }
+
+    T* map(size_t bytes) const {
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) throw std::bad_alloc();
+        advise(ptr, bytes);
+        return static_cast<T*>(ptr);
+    }
+
+    void advise(void* ptr, size_t bytes) const {
+        if (options_.placement == numa_placement::interleave) {
+            host::interleave_pages(ptr, bytes);
+        }
+#ifdef MADV_HUGEPAGE
+        if (options_.huge_pages) {
+            ::madvise(ptr, bytes, MADV_HUGEPAGE);
+        }
+#endif
+    }
+#endif
+};
+
+} // namespace vulkan_stdpar
+
+
+// ========== core/versioning_engine.hpp ==========
+
+/**
+ * @file versioning_engine.hpp
+ * @brief Memory state management and dirty tracking for unified data structures
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ * 
+ * This file contains the versioning_engine class that manages memory state
+ * transitions and dirty range tracking for unified_vector containers.
+ */
+
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <shared_mutex>
+#include <mutex>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+#include <optional>
+#include <sycl/sycl.hpp>
+#endif
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Memory state enumeration for versioning engine
+ */
+enum class memory_state {
+    clean,          ///< Host and device data synchronized
+    host_dirty,     ///< Host has modifications, device needs update
+    device_dirty     ///< Device has modifications, host needs update
+};
+
+/**
+ * @brief Represents a contiguous region of modified memory with merge/overlap logic
+ */
+struct dirty_range {
+    size_t start;        ///< Start index (inclusive)
+    size_t end;          ///< End index (exclusive)
     
-public:
     /**
-     * @brief Default constructor
+     * @brief Construct a dirty range
+     * @param start Start index (inclusive)
+     * @param end End index (exclusive)
      */
-    const_unified_iterator() : container_(nullptr), index_(0) {}
+    dirty_range(size_t start = 0, size_t end = 0) : start(start), end(end) {
+        assert(start <= end);
+    }
     
     /**
-     * @brief Construct const iterator
-     * @param container Parent container
-     * @param index Start position
+     * @brief Check if this range overlaps with another
+     * @param other Other range to check
+     * @return True if ranges overlap
      */
-    const_unified_iterator(const unified_vector<T>* container, size_t index)
-        : container_(container), index_(index)
-    {}
+    bool overlaps(const dirty_range& other) const {
+        return start < other.end && other.start < end;
+    }
     
     /**
-     * @brief Construct from mutable iterator
-     * @param other Mutable iterator
+     * @brief Check if this range is adjacent to another
+     * @param other Other range to check
+     * @return True if ranges are adjacent
      */
-    const_unified_iterator(const unified_iterator<T>& other)
-        : container_(other.get_container()), index_(other.get_index())
-    {}
+    bool adjacent(const dirty_range& other) const {
+        return end == other.start || other.end == start;
+    }
     
     /**
-     * @brief Copy constructor
+     * @brief Merge this range with another
+     * @param other Other range to merge with
+     * @return Merged range
      */
-    const_unified_iterator(const const_unified_iterator&) = default;
+    dirty_range merge(const dirty_range& other) const {
+        return dirty_range(std::min(start, other.start), std::max(end, other.end));
+    }
     
     /**
-     * @brief Copy assignment
+     * @brief Get the size of this range
+     * @return Range size in elements
      */
-    const_unified_iterator& operator=(const const_unified_iterator&) = default;
+    size_t size() const {
+        return end - start;
+    }
     
     /**
-     * @brief Dereference operator
-     * @return Const reference to current element
+     * @brief Check if this range is empty
+     * @return True if range is empty
      */
-    reference operator*() const {
-        return (*container_)[index_];
+    bool empty() const {
+        return start >= end;
     }
     
     /**
-     * @brief Subscr operator
-     * @param n Offset
-     * @return Const reference to element at offset
+     * @brief Check if this range contains an index
+     * @param index Index to check
+     * @return True if index is within range
      */
-    reference operator[](difference_type n) const {
-        return (*container_)[index_ + n];
+    bool contains(size_t index) const {
+        return index >= start && index < end;
     }
+};
+
+/**
+ * @brief Memory state manager with dirty range tracking
+ * @tparam T Element type
+ * @tparam Alloc Host storage allocator
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class versioning_engine : private memory::device_resident {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using allocator_type = Alloc;
     
-    // ==================== Increment/Decrement ====================
+private:
+    mutable std::atomic<memory_state> state_;     ///< Current memory state
+    std::atomic<uint64_t> host_epoch_;            ///< Bumped when host snapshots go stale
+    mutable std::vector<dirty_range> dirty_ranges_; ///< Modified regions
+    mutable std::vector<dirty_range> undefined_ranges_; ///< Discarded host ranges the next device allocation skips
+    mutable std::shared_mutex mutex_;             ///< Thread safety
+    mutable std::atomic<unsigned> host_writers_{0}; ///< Writable host views open on the storage
     
-    const_unified_iterator& operator++() {
-        ++index_;
-        return *this;
+#ifdef VULKAN_STDPAR_USE_SYCL
+#ifdef VULKAN_STDPAR_USE_USM
+    using device_cache = memory::device_usm_cache;
+#else
+    using device_cache = memory::device_buffer_cache;
+#endif
+    using device_block = device_cache::block_type;
+    mutable std::optional<device_block> device_block_;      ///< Allocation checked out of the cache
+#ifdef VULKAN_STDPAR_USE_USM
+    mutable T* device_ptr_ = nullptr;                       ///< Typed view of device_block_
+    mutable std::vector<sycl::event> device_events_;        ///< Outstanding work on device_ptr_
+#else
+    mutable std::optional<sycl::buffer<T>> device_buffer_;  ///< Typed view of device_block_
+#endif
+    mutable std::optional<memory::residency_manager::handle> residency_; ///< LRU registration
+    mutable std::atomic<unsigned> device_pins_{0};          ///< Kernels using the device copy
+    mutable bool zero_copy_ = false;                        ///< Device view aliases host storage
+#endif
+    mutable host_storage<T, Alloc> host_data_;  ///< Host memory storage
+    size_type capacity_;                         ///< Allocated capacity
+    mutable bool device_allocated_;               ///< Device buffer allocation flag
+    
+public:
+    /**
+     * @brief Construct versioning engine
+     * @param capacity Initial capacity
+     * @param options Host storage configuration
+     * @param alloc Host storage allocator
+     */
+    explicit versioning_engine(size_type capacity = 0, const storage_options& options = storage_options(),
+                               const Alloc& alloc = Alloc())
+        : state_(memory_state::clean)
+        , host_epoch_(0)
+        , host_data_(capacity, options, alloc)
+        , capacity_(capacity)
+        , device_allocated_(false)
+    {}
+    
+    /**
+     * @brief Destructor - returns the device allocation to the buffer cache
+     * 
+     * Device-dirty data is not copied back: the host storage is released
+     * together with the engine.
+     */
+    ~versioning_engine() {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // Locked so a concurrent eviction cannot race the release
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        release_device_buffer();
+#endif
     }
     
-    const_unified_iterator operator++(int) {
-        const_unified_iterator temp = *this;
-        ++index_;
-        return temp;
+    // Non-copyable but movable
+    versioning_engine(const versioning_engine&) = delete;
+    versioning_engine& operator=(const versioning_engine&) = delete;
+    
+    versioning_engine(versioning_engine&& other) noexcept
+        : state_(other.state_.load())
+        , host_epoch_(other.host_epoch_.load())
+        , dirty_ranges_(std::move(other.dirty_ranges_))
+        , undefined_ranges_(std::move(other.undefined_ranges_))
+        , host_data_(std::move(other.host_data_))
+        , capacity_(other.capacity_)
+        , device_allocated_(other.device_allocated_)
+    {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        std::unique_lock<std::shared_mutex> lock(other.mutex_);
+        device_allocated_ = other.device_allocated_;
+        take_device_buffer(other);
+#endif
+        other.capacity_ = 0;
+        other.device_allocated_ = false;
+        other.state_.store(memory_state::clean);
+        other.host_epoch_.fetch_add(1, std::memory_order_release);
     }
     
-    const_unified_iterator& operator--() {
-        --index_;
+    versioning_engine& operator=(versioning_engine&& other) noexcept {
+        if (this != &other) {
+            std::unique_lock<std::shared_mutex> lock1(mutex_, std::defer_lock);
+            std::unique_lock<std::shared_mutex> lock2(other.mutex_, std::defer_lock);
+            std::lock(lock1, lock2);
+            
+            state_ = other.state_.load();
+            host_epoch_.store(std::max(host_epoch_.load(), other.host_epoch_.load()) + 1,
+                              std::memory_order_release);
+            dirty_ranges_ = std::move(other.dirty_ranges_);
+            undefined_ranges_ = std::move(other.undefined_ranges_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+            // Before the host storage goes: a zero-copy view may alias it
+            release_device_buffer();
+#endif
+            host_data_ = std::move(other.host_data_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+            take_device_buffer(other);
+#endif
+            capacity_ = other.capacity_;
+            device_allocated_ = other.device_allocated_;
+            
+            other.capacity_ = 0;
+            other.device_allocated_ = false;
+            other.state_.store(memory_state::clean);
+            other.host_epoch_.fetch_add(1, std::memory_order_release);
+        }
         return *this;
     }
     
-    const_unified_iterator operator--(int) {
-        const_unified_iterator temp = *this;
-        --index_;
-        return temp;
+    /**
+     * @brief Get current memory state
+     * @return Current memory state
+     */
+    memory_state get_memory_state() const noexcept {
+        return state_.load(std::memory_order_acquire);
     }
     
-    // ==================== Arithmetic ====================
-    
-    const_unified_iterator& operator+=(difference_type n) {
-        index_ += n;
-        return *this;
+    /**
+     * @brief Check if device memory is dirty
+     * @return True if device has modifications
+     */
+    bool is_device_dirty() const noexcept {
+        return get_memory_state() == memory_state::device_dirty;
     }
     
-    const_unified_iterator& operator-=(difference_type n) {
-        index_ -= n;
-        return *this;
+    /**
+     * @brief Check if host memory is dirty
+     * @return True if host has modifications
+     */
+    bool is_host_dirty() const noexcept {
+        return get_memory_state() == memory_state::host_dirty;
     }
     
-    const_unified_iterator operator+(difference_type n) const {
-        return const_unified_iterator(container_, index_ + n);
+    /**
+     * @brief Check if memory is clean
+     * @return True if host and device are synchronized
+     */
+    bool is_clean() const noexcept {
+        return get_memory_state() == memory_state::clean;
     }
     
-    const_unified_iterator operator-(difference_type n) const {
-        return const_unified_iterator(container_, index_ - n);
+    /**
+     * @brief Mark memory as host dirty
+     * @param start Start index of dirty region
+     * @param end End index of dirty region
+     */
+    void mark_host_dirty(size_type start, size_type end) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        mark_host_dirty_impl(lock, start, end);
+    }
+    
+    /**
+     * @brief Mark memory as device dirty
+     */
+    void mark_device_dirty() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        mark_device_dirty_impl(lock);
+    }
+    
+    /**
+     * @brief Synchronize host modifications to device
+     */
+    void sync_to_device() const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+    }
+    
+    /**
+     * @brief Synchronize device modifications to host
+     * 
+     * Returns without locking unless the engine is device dirty, so readers
+     * of up-to-date host data (including every empty vector sharing one
+     * engine) do not contend.
+     */
+    void sync_to_host() const {
+        if (get_memory_state() != memory_state::device_dirty) return;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_host_impl(lock);
+    }
+    
+    /**
+     * @brief Make the host copy current without downloading the device copy
+     * 
+     * For callers about to overwrite every element in use on the host. A
+     * device-dirty copy is dropped instead of transferred; the caller marks
+     * what it writes dirty, and later uploads are ordered after pending
+     * kernels. Kernels writing host memory in place (zero-copy) are waited
+     * for.
+     */
+    void discard_device_copy() {
+        if (get_memory_state() != memory_state::device_dirty) return;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (zero_copy_ || !device_allocated_) {
+            sync_to_host_impl(lock);
+            return;
+        }
+        if (get_memory_state() == memory_state::device_dirty) {
+            state_.store(memory_state::clean, std::memory_order_release);
+        }
+#else
+        sync_to_host_impl(lock);
+#endif
+    }
+    
+    /**
+     * @brief Resize storage capacity
+     * @param new_capacity New capacity
+     */
+    void resize(size_type new_capacity) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        resize_impl(lock, new_capacity);
+    }
+    
+    /**
+     * @brief Use a file mapping as host storage, replacing current contents
+     * 
+     * Host and device start clean: the device copy, if any, is dropped and
+     * the next device use uploads straight from the mapping.
+     * 
+     * @param path File to map
+     * @param mode Whether modifications reach the file
+     * @param offset Byte offset of the first element (multiple of alignof(T))
+     * @param length Bytes to map (default: to the end of the file)
+     */
+    void map_file(const std::string& path, map_mode mode, size_t offset = 0,
+                  size_t length = static_cast<size_t>(-1)) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // Before the old storage is freed: a zero-copy buffer aliases it and
+        // pending uploads may still read from it
+        release_device_buffer();
+#endif
+        host_data_.map_file(path, mode, offset, length);
+        capacity_ = host_data_.capacity();
+        dirty_ranges_.clear();
+        undefined_ranges_.clear();
+        state_.store(memory_state::clean, std::memory_order_release);
+        host_epoch_.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Check whether host storage is a file mapping
+     * @return True for storage set up by map_file()
+     */
+    bool is_file_mapped() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return host_data_.is_file_mapped();
+    }
+    
+    /**
+     * @brief Bring the host copy up to date and msync a read_write mapping
+     */
+    void flush_file() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_host_impl(lock);
+        host_data_.flush();
+    }
+    
+    /**
+     * @brief Write back device data and unmap the file
+     * @param count Number of elements in use; a read_write file is trimmed to this
+     */
+    void close_file(size_type count) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_host_impl(lock);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        release_device_buffer();
+#endif
+        host_data_.close_file(count * sizeof(T));
+        capacity_ = 0;
+        dirty_ranges_.clear();
+        undefined_ranges_.clear();
+        state_.store(memory_state::clean, std::memory_order_release);
+        host_epoch_.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Declare the contents of [start, end) dead
+     * 
+     * The caller will overwrite the whole range before reading it, so no
+     * pending host modification inside it is uploaded. Without a device
+     * allocation the range is also skipped by the upload that follows the
+     * next allocation, except for parts the host writes and marks dirty.
+     * 
+     * @param start First element
+     * @param end One past the last element
+     */
+    void discard_range(size_type start, size_type end) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        discard_range_impl(lock, start, end);
+    }
+    
+    /**
+     * @brief Set elements [start, end) to value on the device
+     * 
+     * Other pending host modifications are uploaded first; the range itself
+     * is neither written on the host nor transferred, and the engine
+     * becomes device-dirty. Without SYCL the host storage is filled.
+     * 
+     * @param start First element
+     * @param end One past the last element
+     * @param value Fill value
+     */
+    void fill_device(size_type start, size_type end, const T& value) {
+        if (start == end) return;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        discard_range_impl(lock, start, end);
+        sync_to_device_impl(lock);
+        
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_USE_USM
+        sycl::event filled = queue.fill(device_ptr_ + start, value, end - start, device_events_);
+        device_events_.assign(1, filled);
+#else
+        queue.submit([&](sycl::handler& cgh) {
+            auto acc = device_buffer_->template get_access<sycl::access::mode::write>(
+                cgh, sycl::range<1>(end - start), sycl::id<1>(start));
+            cgh.fill(acc, value);
+        });
+#endif
+        mark_device_dirty_impl(lock);
+#else
+        std::fill(host_data_.data() + start, host_data_.data() + end, value);
+        mark_host_dirty_impl(lock, start, end);
+#endif
+    }
+    
+    /**
+     * @brief Check whether the newest data lives only in device memory
+     * 
+     * True when the engine is device-dirty and the device copy is a
+     * separate allocation rather than a zero-copy view of host storage.
+     * Inserts and copies use this to keep such data on the device.
+     * 
+     * @return True if the device copy is newer than host storage
+     */
+    bool is_device_resident() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        return get_memory_state() == memory_state::device_dirty && device_allocated_ && !zero_copy_;
+#else
+        return false;
+#endif
+    }
+    
+    /**
+     * @brief Copy elements from another engine's device copy
+     * 
+     * If source is device-resident, its elements [source_offset,
+     * source_offset + count) are copied device to device, asynchronously,
+     * to [offset, offset + count) of this engine's device copy, and this
+     * engine becomes device-dirty. Neither host storage is touched. This
+     * engine must either be device-resident already or have no device
+     * allocation; in the latter case one is checked out and the rest of it
+     * is undefined until filled by further copies or upload_range().
+     * 
+     * @param source Engine to copy from (must not be this)
+     * @param count Elements to copy
+     * @param offset First element written in this engine
+     * @param source_offset First element read from source
+     * @return False if nothing was copied: the caller must copy through the
+     *         host (source not device-resident, this engine's device copy is
+     *         not newer than its host copy, or no device memory available)
+     */
+    bool copy_device_from(const versioning_engine& source, size_type count, size_type offset = 0,
+                          size_type source_offset = 0) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // Allocating below may evict; the pin keeps the source (locked here) out of that
+        auto source_pin = source.pin_device();
+        std::unique_lock<std::shared_mutex> lock1(mutex_, std::defer_lock);
+        std::unique_lock<std::shared_mutex> lock2(source.mutex_, std::defer_lock);
+        std::lock(lock1, lock2);
+        
+        if (count == 0 || source.get_memory_state() != memory_state::device_dirty ||
+            !source.device_allocated_ || source.zero_copy_) {
+            return false;
+        }
+        if (device_allocated_ && (zero_copy_ || get_memory_state() != memory_state::device_dirty)) {
+            return false;
+        }
+        assert(offset + count <= capacity_ && source_offset + count <= source.capacity_);
+        
+        if (!device_allocated_) {
+            try {
+                allocate_device_block(lock1);
+            } catch (const out_of_memory_exception&) {
+                return false;
+            }
+        }
+        
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_USE_USM
+        std::vector<sycl::event> after = source.device_events_;
+        after.insert(after.end(), device_events_.begin(), device_events_.end());
+        sycl::event copied = queue.memcpy(device_ptr_ + offset, source.device_ptr_ + source_offset,
+                                          count * sizeof(T), after);
+        device_events_.assign(1, copied);
+        // Later kernels writing the source must not overtake the copy
+        source.device_events_.push_back(copied);
+#else
+        queue.submit([&](sycl::handler& cgh) {
+            auto from = source.device_buffer_->template get_access<sycl::access::mode::read>(
+                cgh, sycl::range<1>(count), sycl::id<1>(source_offset));
+            auto to = device_buffer_->template get_access<sycl::access::mode::write>(
+                cgh, sycl::range<1>(count), sycl::id<1>(offset));
+            cgh.copy(from, to);
+        });
+#endif
+        mark_device_dirty_impl(lock1);
+        return true;
+#else
+        (void)source;
+        (void)count;
+        (void)offset;
+        (void)source_offset;
+        return false;
+#endif
+    }
+    
+    /**
+     * @brief Move device elements [first, last) to start at index to
+     * 
+     * Used to open a gap for an insert without downloading. The ranges may
+     * overlap; the elements go through a scratch block from the device
+     * cache, counted against the residency budget.
+     * Requires is_device_resident() and to + (last - first) <= capacity().
+     * 
+     * @param first First element to move
+     * @param last One past the last element to move
+     * @param to New index of first
+     */
+    void shift_device_range(size_type first, size_type last, size_type to) {
+        if (first == last || first == to) return;
+#ifdef VULKAN_STDPAR_USE_SYCL
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        assert(device_allocated_ && !zero_copy_ && to + (last - first) <= capacity_);
+        sycl::queue queue = get_default_queue();
+        size_type count = last - first;
+        memory::residency_manager::handle handle;
+        device_block block = checkout_device_block(count * sizeof(T), handle);
+#ifdef VULKAN_STDPAR_USE_USM
+        T* scratch = memory::view_device_block<T>(block, count);
+        sycl::event staged = queue.memcpy(scratch, device_ptr_ + first, count * sizeof(T),
+                                          device_events_);
+        queue.memcpy(device_ptr_ + to, scratch, count * sizeof(T), staged).wait();
+        device_events_.clear();
+#else
+        {
+            // The typed view must be gone before the block is checked in
+            sycl::buffer<T> scratch = memory::view_device_block<T>(block, count);
+            queue.submit([&](sycl::handler& cgh) {
+                auto from = device_buffer_->template get_access<sycl::access::mode::read>(
+                    cgh, sycl::range<1>(count), sycl::id<1>(first));
+                auto tmp = scratch.template get_access<sycl::access::mode::discard_write>(cgh);
+                cgh.copy(from, tmp);
+            });
+            queue.submit([&](sycl::handler& cgh) {
+                auto tmp = scratch.template get_access<sycl::access::mode::read>(cgh);
+                auto dest = device_buffer_->template get_access<sycl::access::mode::write>(
+                    cgh, sycl::range<1>(count), sycl::id<1>(to));
+                cgh.copy(tmp, dest);
+            });
+        }
+#endif
+        checkin_device_block(std::move(block), handle);
+#else
+        (void)to;
+#endif
+    }
+    
+    /**
+     * @brief Upload host elements [start, end) into a device-resident copy
+     * 
+     * Lets callers write new elements on the host and push just those to
+     * the device, keeping the engine device-dirty instead of downloading
+     * everything first. Requires is_device_resident().
+     * 
+     * @param start First element
+     * @param end One past the last element
+     */
+    void upload_range(size_type start, size_type end) {
+        if (start == end) return;
+#ifdef VULKAN_STDPAR_USE_SYCL
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        assert(device_allocated_ && !zero_copy_ && end <= capacity_);
+        sycl::queue queue = get_default_queue();
+        upload_spans(queue, {memory::upload_span{start, end}});
+#endif
+    }
+    
+    /**
+     * @brief Get current capacity
+     * @return Current capacity
+     */
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+    
+    /**
+     * @brief Get host storage configuration
+     * @return Storage options
+     */
+    const storage_options& get_storage_options() const noexcept {
+        return host_data_.options();
+    }
+    
+    /**
+     * @brief Get host storage allocator
+     * @return Copy of the allocator
+     */
+    Alloc get_allocator() const {
+        return host_data_.get_allocator();
+    }
+    
+    /**
+     * @brief Get host snapshot epoch
+     * 
+     * The epoch changes whenever previously obtained host pointers may no
+     * longer observe current data (reallocation or device-side writes).
+     * 
+     * @return Current host epoch
+     */
+    uint64_t host_epoch() const noexcept {
+        return host_epoch_.load(std::memory_order_acquire);
+    }
+    
+    /**
+     * @brief Get host data pointer (read-only access)
+     * @return Pointer to host data
+     */
+    const T* host_data() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return host_data_.data();
+    }
+    
+    /**
+     * @brief Get host data pointer (write access)
+     * @return Pointer to host data
+     */
+    T* host_data() {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return host_data_.data();
+    }
+    
+#ifdef VULKAN_STDPAR_USE_SYCL
+#ifdef VULKAN_STDPAR_USE_USM
+    /**
+     * @brief Get device pointer, allocating and uploading host data if needed
+     * 
+     * The upload may still be in flight: kernels using the pointer must
+     * depend on get_device_events().
+     * 
+     * @return Device pointer to capacity() elements
+     */
+    T* get_device_pointer() const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+        return device_ptr_;
+    }
+    
+    /**
+     * @brief Get events that work on the device pointer must wait for
+     * @return Outstanding upload events
+     */
+    std::vector<sycl::event> get_device_events() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return device_events_;
+    }
+    
+    /**
+     * @brief Replace outstanding events with one that depends on them all
+     * @param event Event of work submitted against the device pointer
+     */
+    void set_device_event(sycl::event event) const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        device_events_.assign(1, std::move(event));
+    }
+#else
+    /**
+     * @brief Get device buffer, allocating and uploading host data if needed
+     * @return Reference to device buffer
+     */
+    sycl::buffer<T>& get_device_buffer() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+        return *device_buffer_;
+    }
+    
+    /**
+     * @brief Get device buffer (const)
+     * @return Const reference to device buffer
+     */
+    const sycl::buffer<T>& get_device_buffer() const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+        return *device_buffer_;
+    }
+#endif
+    
+    /**
+     * @brief Check whether a device allocation is currently held
+     * @return True if a device buffer is allocated
+     */
+    bool has_device_buffer() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return device_allocated_;
+    }
+    
+    /**
+     * @brief RAII guard that keeps the device copy resident
+     * 
+     * Held across a kernel launch so the residency manager cannot evict
+     * the buffer between upload and mark_device_dirty().
+     */
+    class device_pin {
+    private:
+        const versioning_engine* engine_;
+        
+    public:
+        explicit device_pin(const versioning_engine& engine) : engine_(&engine) {
+            engine_->device_pins_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        
+        ~device_pin() {
+            if (engine_) engine_->device_pins_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        
+        device_pin(device_pin&& other) noexcept : engine_(other.engine_) {
+            other.engine_ = nullptr;
+        }
+        
+        device_pin(const device_pin&) = delete;
+        device_pin& operator=(const device_pin&) = delete;
+        device_pin& operator=(device_pin&&) = delete;
+    };
+    
+    /**
+     * @brief Pin the device copy for the lifetime of the returned guard
+     * @return Pin guard
+     */
+    device_pin pin_device() const {
+        return device_pin(*this);
+    }
+#endif
+    
+    /**
+     * @brief Register a writable host view on the storage
+     * 
+     * While any are open, copy-on-write copies duplicate the storage
+     * instead of sharing it, so writes made through the view stay private.
+     */
+    void retain_host_writer() const noexcept {
+        host_writers_.fetch_add(1, std::memory_order_acq_rel);
+    }
+    
+    /**
+     * @brief Unregister a writable host view
+     */
+    void release_host_writer() const noexcept {
+        host_writers_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    
+    /**
+     * @brief Check whether writable host views are open
+     * @return True if any retain_host_writer() is outstanding
+     */
+    bool has_host_writers() const noexcept {
+        return host_writers_.load(std::memory_order_acquire) != 0;
+    }
+    
+    /**
+     * @brief Clear all dirty ranges
+     */
+    void clear_dirty_ranges() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        dirty_ranges_.clear();
+    }
+    
+    /**
+     * @brief Get dirty ranges
+     * @return Copy of dirty ranges
+     */
+    std::vector<dirty_range> get_dirty_ranges() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return dirty_ranges_;
+    }
+    
+private:
+    /**
+     * @brief Implementation of mark_host_dirty with lock held
+     */
+    void mark_host_dirty_impl(std::unique_lock<std::shared_mutex>& lock, size_type start, size_type end) {
+        // Validate range
+        assert(start <= end);
+        assert(end <= capacity_);
+        
+        if (start == end) return;
+        
+        dirty_range new_range(start, end);
+        
+        // Merge with existing ranges
+        bool merged = false;
+        for (auto& existing : dirty_ranges_) {
+            if (existing.overlaps(new_range) || existing.adjacent(new_range)) {
+                existing = existing.merge(new_range);
+                merged = true;
+                break;
+            }
+        }
+        
+        if (!merged) {
+            dirty_ranges_.push_back(new_range);
+        }
+        
+        // Merge overlapping ranges
+        for (size_t i = 0; i < dirty_ranges_.size(); ++i) {
+            for (size_t j = i + 1; j < dirty_ranges_.size(); ++j) {
+                if (dirty_ranges_[i].overlaps(dirty_ranges_[j]) || 
+                    dirty_ranges_[i].adjacent(dirty_ranges_[j])) {
+                    dirty_ranges_[i] = dirty_ranges_[i].merge(dirty_ranges_[j]);
+                    dirty_ranges_.erase(dirty_ranges_.begin() + j);
+                    --j;
+                }
+            }
+        }
+        
+        // Update state
+        memory_state current = state_.load(std::memory_order_acquire);
+        if (current == memory_state::clean) {
+            state_.store(memory_state::host_dirty, std::memory_order_release);
+        }
+    }
+    
+    /**
+     * @brief Implementation of mark_device_dirty with lock held
+     */
+    void mark_device_dirty_impl(std::unique_lock<std::shared_mutex>& lock) {
+        dirty_ranges_.clear();
+        undefined_ranges_.clear();
+        state_.store(memory_state::device_dirty, std::memory_order_release);
+        host_epoch_.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Remove cut from a list of disjoint ranges
+     */
+    static void subtract_range(std::vector<dirty_range>& ranges, const dirty_range& cut) {
+        std::vector<dirty_range> kept;
+        kept.reserve(ranges.size() + 1);
+        for (const auto& range : ranges) {
+            if (!range.overlaps(cut)) {
+                kept.push_back(range);
+                continue;
+            }
+            if (range.start < cut.start) kept.emplace_back(range.start, cut.start);
+            if (cut.end < range.end) kept.emplace_back(cut.end, range.end);
+        }
+        ranges.swap(kept);
+    }
+    
+    /**
+     * @brief Implementation of discard_range with lock held
+     */
+    void discard_range_impl(std::unique_lock<std::shared_mutex>& /*lock*/, size_type start, size_type end) {
+        assert(start <= end && end <= capacity_);
+        if (start == end) return;
+        
+        subtract_range(dirty_ranges_, dirty_range(start, end));
+        if (dirty_ranges_.empty() && get_memory_state() == memory_state::host_dirty) {
+            state_.store(memory_state::clean, std::memory_order_release);
+        }
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (!device_allocated_) add_undefined_range(start, end);
+#endif
+    }
+    
+    /**
+     * @brief Record a discarded host range, merging it with the others
+     */
+    void add_undefined_range(size_type start, size_type end) {
+        undefined_ranges_.emplace_back(start, end);
+        auto spans = memory::coalesce_spans(undefined_ranges_, 0);
+        undefined_ranges_.clear();
+        for (const auto& span : spans) undefined_ranges_.emplace_back(span.start, span.end);
+    }
+    
+    /**
+     * @brief Implementation of sync_to_device with lock held
+     */
+    void sync_to_device_impl(std::unique_lock<std::shared_mutex>& lock) const {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        ensure_device_allocated(lock);
+#endif
+        if (get_memory_state() != memory_state::host_dirty) return;
+        
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (zero_copy_) {
+#ifndef VULKAN_STDPAR_USE_USM
+            // Host writes went straight into the buffer's memory; tell the runtime
+            sycl::host_accessor<T, 1, sycl::access_mode::write> acc(*device_buffer_, sycl::no_init);
+            (void)acc;
+#endif
+            dirty_ranges_.clear();
+            state_.store(memory_state::clean, std::memory_order_release);
+            return;
+        }
+        
+        // Join nearby dirty ranges into a few large spans
+        sycl::queue queue = get_default_queue();
+        auto spans = memory::coalesce_spans(
+            dirty_ranges_, VULKAN_STDPAR_STAGING_COALESCE_BYTES / sizeof(T));
+        
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        auto start_time = std::chrono::high_resolution_clock::now();
+#endif
+        upload_spans(queue, spans);
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        uint64_t bytes = 0;
+        for (const auto& span : spans) bytes += (span.end - span.start) * sizeof(T);
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_transfer_to_device(bytes, elapsed.count());
+#endif
+#endif
+        
+        dirty_ranges_.clear();
+        state_.store(memory_state::clean, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Implementation of sync_to_host with lock held
+     */
+    void sync_to_host_impl(std::unique_lock<std::shared_mutex>& lock) const {
+        if (get_memory_state() != memory_state::device_dirty) return;
+        
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (!device_allocated_) return;
+        
+        if (zero_copy_) {
+            // Kernels wrote host memory in place; only wait for them
+#ifdef VULKAN_STDPAR_USE_USM
+            sycl::event::wait(device_events_);
+            device_events_.clear();
+#else
+            sycl::host_accessor<T, 1, sycl::access_mode::read> acc(*device_buffer_);
+            (void)acc;
+#endif
+            state_.store(memory_state::clean, std::memory_order_release);
+            return;
+        }
+        
+        // Copy entire buffer from device to host
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        auto start_time = std::chrono::high_resolution_clock::now();
+#endif
+#ifdef VULKAN_STDPAR_USE_USM
+        queue.memcpy(host_data_.data(), device_ptr_, capacity_ * sizeof(T), device_events_).wait();
+        device_events_.clear();
+#else
+        queue.submit([&](sycl::handler& cgh) {
+            auto device_acc = device_buffer_->template get_access<sycl::access::mode::read>(cgh);
+            cgh.copy(device_acc, host_data_.data());
+        });
+        
+        queue.wait();
+#endif
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_transfer_from_device(capacity_ * sizeof(T), elapsed.count());
+#endif
+#endif
+        
+        state_.store(memory_state::clean, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Implementation of resize with lock held
+     */
+    void resize_impl(std::unique_lock<std::shared_mutex>& lock, size_type new_capacity) {
+        if (new_capacity <= capacity_) return;
+        
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (zero_copy_) {
+            // The device view aliases the storage about to grow; rebind on next use
+            sync_to_host_impl(lock);
+            release_device_buffer();
+        }
+#endif
+        
+        // Grow host storage, keeping every element written so far
+        const T* old_data = host_data_.data();
+        host_data_.reallocate(new_capacity, capacity_);
+        
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (device_allocated_) {
+            if (get_memory_state() == memory_state::device_dirty) {
+                // Device holds the only current copy; move it to a larger buffer
+                auto& residency = memory::residency_manager::instance();
+                auto new_residency =
+                    residency.admit(this, memory::device_bucket_size(new_capacity * sizeof(T)));
+                std::optional<device_block> new_block;
+                try {
+                    new_block = device_cache::instance().checkout(new_capacity * sizeof(T));
+                } catch (...) {
+                    residency.release(new_residency);
+                    throw;
+                }
+                copy_device_prefix(*new_block, new_capacity);
+                release_device_buffer();
+                device_block_ = std::move(new_block);
+                bind_device_view(new_capacity);
+                residency_ = new_residency;
+                device_allocated_ = true;
+            } else {
+                // Host is current: defer reallocation to the next device use, which
+                // uploads the old contents together with whatever is appended meanwhile
+                release_device_buffer();
+                dirty_ranges_.assign(1, dirty_range(0, capacity_));
+                state_.store(memory_state::host_dirty, std::memory_order_release);
+            }
+        }
+        
+        // The new tail holds nothing until written, which marks it dirty
+        if (!device_allocated_) add_undefined_range(capacity_, new_capacity);
+#endif
+        
+        capacity_ = new_capacity;
+        if (host_data_.data() != old_data) {
+            host_epoch_.fetch_add(1, std::memory_order_release);
+        }
+    }
+    
+#ifdef VULKAN_STDPAR_USE_SYCL
+    /**
+     * @brief Ensure a device buffer is allocated (unique lock held)
+     * 
+     * On devices that share host memory the host storage itself becomes
+     * the device copy. Otherwise the allocation comes from the process-wide
+     * buffer cache and may hold stale data, so the whole host copy is
+     * scheduled for upload, except ranges discarded since the last
+     * allocation.
+     */
+    void ensure_device_allocated(std::unique_lock<std::shared_mutex>& lock) const {
+        auto& residency = memory::residency_manager::instance();
+        if (device_allocated_) {
+            if (residency_) residency.touch(*residency_);
+            return;
+        }
+        
+        if (capacity_ > 0 && memory::supports_zero_copy(get_default_queue().get_device())) {
+            bind_host_view();
+            undefined_ranges_.clear();
+            return;
+        }
+        
+        allocate_device_block(lock);
+        
+        // Upload everything but discarded ranges; host writes to those are already dirty
+        std::vector<dirty_range> upload;
+        if (capacity_ > 0) upload.emplace_back(0, capacity_);
+        for (const auto& hole : undefined_ranges_) subtract_range(upload, hole);
+        upload.insert(upload.end(), dirty_ranges_.begin(), dirty_ranges_.end());
+        dirty_ranges_.clear();
+        for (const auto& span : memory::coalesce_spans(upload, 0)) {
+            dirty_ranges_.emplace_back(span.start, span.end);
+        }
+        undefined_ranges_.clear();
+        state_.store(dirty_ranges_.empty() ? memory_state::clean : memory_state::host_dirty,
+                     std::memory_order_release);
+    }
+    
+    /**
+     * @brief Check out a device allocation for capacity_ elements (unique lock held)
+     * @throws out_of_memory_exception if the device allocation fails
+     */
+    void allocate_device_block(std::unique_lock<std::shared_mutex>& lock) const {
+        auto& residency = memory::residency_manager::instance();
+        static const bool budget_initialized = [&residency] {
+            auto device = get_default_queue().get_device();
+            residency.init_budget(device.get_info<sycl::info::device::global_mem_size>() / 10 * 9);
+            return true;
+        }();
+        (void)budget_initialized;
+        
+        size_type count = std::max<size_type>(capacity_, 1);
+        memory::residency_manager::handle handle;
+        device_block_ = checkout_device_block(count * sizeof(T), handle);
+        residency_ = handle;
+        bind_device_view(count);
+        device_allocated_ = true;
+    }
+    
+    /**
+     * @brief Check out a cached device block counted against the residency budget
+     * 
+     * Other engines may be evicted to make room; this one is kept. Give the
+     * block back with checkin_device_block().
+     * 
+     * @param bytes Required size in bytes
+     * @param handle Set to the block's residency registration
+     * @throws out_of_memory_exception if the device allocation fails
+     */
+    device_block checkout_device_block(size_t bytes, memory::residency_manager::handle& handle) const {
+        auto& residency = memory::residency_manager::instance();
+        handle = residency.admit(this, memory::device_bucket_size(bytes));
+        try {
+            return device_cache::instance().checkout(bytes);
+        } catch (...) {
+            residency.release(handle);
+            throw;
+        }
+    }
+    
+    /**
+     * @brief Return a block from checkout_device_block() to the cache
+     */
+    static void checkin_device_block(device_block block, memory::residency_manager::handle handle) {
+        device_cache::instance().checkin(std::move(block));
+        memory::residency_manager::instance().release(handle);
+    }
+    
+    /**
+     * @brief Return the device allocation to the buffer cache (lock held)
+     */
+    void release_device_buffer() const {
+        if (zero_copy_) {
+            reset_device_view();
+            zero_copy_ = false;
+        }
+        if (residency_) {
+            memory::residency_manager::instance().release(*residency_);
+            residency_.reset();
+        }
+        if (device_block_) {
+            reset_device_view();
+            device_cache::instance().checkin(std::move(*device_block_));
+            device_block_.reset();
+        }
+        device_allocated_ = false;
+    }
+    
+    /**
+     * @brief Use host storage as the device copy (unique lock held)
+     * 
+     * Nothing is uploaded: pending host-dirty ranges are already in the
+     * memory kernels will read. The view takes no device memory, so it is
+     * not registered with the residency manager.
+     */
+    void bind_host_view() const {
+#ifdef VULKAN_STDPAR_USE_USM
+        device_ptr_ = host_data_.data();
+        device_events_.clear();
+#else
+        device_buffer_.emplace(host_data_.data(), sycl::range<1>(capacity_),
+                               sycl::property_list{sycl::property::buffer::use_host_ptr()});
+        // Host coherence is established by sync_to_host, not on destruction
+        device_buffer_->set_write_back(false);
+#endif
+        zero_copy_ = true;
+        device_allocated_ = true;
+    }
+    
+    /**
+     * @brief Point the typed view at the first count elements of device_block_
+     */
+    void bind_device_view(size_type count) const {
+#ifdef VULKAN_STDPAR_USE_USM
+        device_ptr_ = memory::view_device_block<T>(*device_block_, count);
+        device_events_.clear();
+#else
+        device_buffer_ = memory::view_device_block<T>(*device_block_, count);
+#endif
+    }
+    
+    /**
+     * @brief Drop the typed view once outstanding work on it has finished
+     */
+    void reset_device_view() const {
+#ifdef VULKAN_STDPAR_USE_USM
+        sycl::event::wait(device_events_);
+        device_events_.clear();
+        device_ptr_ = nullptr;
+#else
+        device_buffer_.reset();
+#endif
+    }
+    
+    /**
+     * @brief Copy the current capacity_ elements into a larger block
+     */
+    void copy_device_prefix(device_block& to, size_type new_capacity) const {
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_USE_USM
+        T* destination = memory::view_device_block<T>(to, new_capacity);
+        queue.memcpy(destination, device_ptr_, capacity_ * sizeof(T), device_events_).wait();
+        device_events_.clear();
+#else
+        sycl::buffer<T> destination = memory::view_device_block<T>(to, new_capacity);
+        queue.submit([&](sycl::handler& cgh) {
+            auto old_acc = device_buffer_->template get_access<sycl::access::mode::read>(
+                cgh, sycl::range<1>(capacity_));
+            auto new_acc = destination.template get_access<sycl::access::mode::write>(
+                cgh, sycl::range<1>(capacity_));
+            cgh.copy(old_acc, new_acc);
+        });
+        queue.wait();
+#endif
+    }
+    
+    /**
+     * @brief Upload host spans to the device buffer (unique lock held)
+     * 
+     * Trivially copyable data streams through the pinned staging ring and
+     * returns without waiting: the SYCL runtime orders later work on the
+     * buffer after the transfers, and the host copy may change meanwhile
+     * because it has already been staged. Other data is copied directly.
+     */
+    void upload_spans(sycl::queue& queue, const std::vector<memory::upload_span>& spans) const {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            auto& ring = memory::staging_ring::instance(queue);
+            if (ring.usable(queue) && sizeof(T) <= ring.slot_bytes()) {
+                for (const auto& span : spans) {
+#ifdef VULKAN_STDPAR_USE_USM
+                    ring.upload(queue, device_ptr_ + span.start, host_data_.data() + span.start,
+                                span.end - span.start, device_events_);
+#else
+                    ring.upload(queue, *device_buffer_, span.start,
+                                host_data_.data() + span.start, span.end - span.start);
+#endif
+                }
+                return;
+            }
+        }
+        
+#ifdef VULKAN_STDPAR_USE_USM
+        // Pageable source: copies must finish before the host may change it
+        std::vector<sycl::event> copies;
+        for (const auto& span : spans) {
+            copies.push_back(queue.memcpy(device_ptr_ + span.start, host_data_.data() + span.start,
+                                          (span.end - span.start) * sizeof(T), device_events_));
+        }
+        sycl::event::wait(copies);
+        device_events_.clear();
+#else
+        for (const auto& span : spans) {
+            const T* host_sub = host_data_.data() + span.start;
+            queue.submit([&](sycl::handler& cgh) {
+                auto device_acc = device_buffer_->template get_access<sycl::access::mode::write>(
+                    cgh, sycl::range<1>(span.end - span.start), sycl::id<1>(span.start));
+                cgh.copy(host_sub, device_acc);
+            });
+        }
+        queue.wait();
+#endif
+    }
+    
+    /**
+     * @brief Move other's device allocation into this engine (both locked)
+     */
+    void take_device_buffer(versioning_engine& other) {
+        device_block_ = std::move(other.device_block_);
+#ifdef VULKAN_STDPAR_USE_USM
+        device_ptr_ = other.device_ptr_;
+        device_events_ = std::move(other.device_events_);
+        other.device_ptr_ = nullptr;
+        other.device_events_.clear();
+#else
+        device_buffer_ = std::move(other.device_buffer_);
+        other.device_buffer_.reset();
+#endif
+        residency_ = other.residency_;
+        zero_copy_ = other.zero_copy_;
+        other.zero_copy_ = false;
+        other.device_block_.reset();
+        other.residency_.reset();
+        if (residency_) {
+            memory::residency_manager::instance().rebind(*residency_, this);
+        }
+    }
+    
+    /**
+     * @brief Get default SYCL queue
+     */
+    static sycl::queue get_default_queue() {
+        return queue::get_default_queue();
+    }
+#endif
+    
+    /**
+     * @brief Evict the device copy to host unless busy (called by the residency manager)
+     * @return Bytes freed
+     */
+    size_t try_evict() const override {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (device_pins_.load(std::memory_order_acquire) != 0) return 0;
+        std::unique_lock<std::shared_mutex> lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock() || !device_block_ ||
+            device_pins_.load(std::memory_order_acquire) != 0) {
+            return 0;
+        }
+        
+        // Write device-only modifications back; the host copy stays valid
+        sync_to_host_impl(lock);
+        
+        size_t bytes = device_block_->byte_size();
+        reset_device_view();
+        device_block_.reset();
+        residency_.reset();
+        device_allocated_ = false;
+        return bytes;
+#else
+        return 0;
+#endif
+    }
+};
+
+} // namespace vulkan_stdpar
+
+
+// ========== containers/fwd.hpp ==========
+
+/**
+ * @file fwd.hpp
+ * @brief Forward declarations for unified containers and iterators
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file declares the container, reference and iterator templates once,
+ * together with their default allocator arguments, so that headers which
+ * refer to each other can be included in any order.
+ */
+
+
+#include <memory>
+
+namespace vulkan_stdpar {
+
+template<typename T, typename Alloc = std::allocator<T>> class unified_vector;
+template<typename T, typename Alloc = std::allocator<T>> class unified_reference;
+template<typename T, typename Alloc = std::allocator<T>> class unified_iterator;
+template<typename T, typename Alloc = std::allocator<T>> class const_unified_iterator;
+
+} // namespace vulkan_stdpar
+
+
+// ========== containers/unified_reference.hpp ==========
+
+/**
+ * @file unified_reference.hpp
+ * @brief Proxy reference type for write detection in unified_vector
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ * 
+ * This file implements the unified_reference proxy that enables write detection
+ * for unified_vector elements while maintaining natural C++ syntax.
+ */
+
+
+#include <type_traits>
+#include <utility>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Proxy reference for unified_vector elements
+ * 
+ * This class acts as a proxy reference that detects writes to vector elements
+ * and triggers appropriate synchronization. It provides implicit conversion
+ * for reads while marking the host as dirty on writes.
+ * 
+ * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
+ */
+template<typename T, typename Alloc>
+class unified_reference {
+private:
+    unified_vector<T, Alloc>* container_;  ///< Parent container
+    size_t index_;                      ///< Element index
+    
+    // Friend declarations
+    template<typename U, typename A> friend class unified_vector;
+    template<typename U, typename A> friend class unified_iterator;
+    
+public:
+    /**
+     * @brief Construct reference to vector element
+     * @param container Parent container
+     * @param index Element index
+     */
+    unified_reference(unified_vector<T, Alloc>* container, size_t index)
+        : container_(container)
+        , index_(index)
+    {}
+    
+    /**
+     * @brief Copy constructor
+     */
+    unified_reference(const unified_reference& other) = default;
+    
+    /**
+     * @brief Implicit conversion to T for read access
+     * @return Element value
+     */
+    operator T() const {
+        return container_->at_impl(index_);
+    }
+    
+    /**
+     * @brief Assignment from value (triggers write detection)
+     * @param value Value to assign
+     * @return Reference to this
+     */
+    unified_reference& operator=(const T& value) {
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    /**
+     * @brief Assignment from another reference
+     * @param other Other reference
+     * @return Reference to this
+     */
+    unified_reference& operator=(const unified_reference& other) {
+        if (this != &other) {
+            container_->set_impl(index_, other.operator T());
+        }
+        return *this;
+    }
+    
+    /**
+     * @brief Move assignment
+     * @param value Value to move
+     * @return Reference to this
+     */
+    unified_reference& operator=(T&& value) {
+        container_->set_impl(index_, std::move(value));
+        return *this;
+    }
+    
+    // Address operator disabled to prevent pointer escape
+    T* operator&() = delete;
+    
+    // Compound assignment operators (trigger write detection)
+    
+    template<typename U>
+    unified_reference& operator+=(const U& rhs) {
+        T value = this->operator T();
+        value += rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator-=(const U& rhs) {
+        T value = this->operator T();
+        value -= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator*=(const U& rhs) {
+        T value = this->operator T();
+        value *= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator/=(const U& rhs) {
+        T value = this->operator T();
+        value /= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator%=(const U& rhs) {
+        T value = this->operator T();
+        value %= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator&=(const U& rhs) {
+        T value = this->operator T();
+        value &= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator|=(const U& rhs) {
+        T value = this->operator T();
+        value |= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator^=(const U& rhs) {
+        T value = this->operator T();
+        value ^= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator<<=(const U& rhs) {
+        T value = this->operator T();
+        value <<= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    template<typename U>
+    unified_reference& operator>>=(const U& rhs) {
+        T value = this->operator T();
+        value >>= rhs;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    // Increment/decrement operators
+    
+    unified_reference& operator++() {
+        T value = this->operator T();
+        ++value;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    T operator++(int) {
+        T old_value = this->operator T();
+        T new_value = old_value;
+        ++new_value;
+        container_->set_impl(index_, new_value);
+        return old_value;
+    }
+    
+    unified_reference& operator--() {
+        T value = this->operator T();
+        --value;
+        container_->set_impl(index_, value);
+        return *this;
+    }
+    
+    T operator--(int) {
+        T old_value = this->operator T();
+        T new_value = old_value;
+        --new_value;
+        container_->set_impl(index_, new_value);
+        return old_value;
+    }
+    
+    /**
+     * @brief Swap with another reference
+     * @param other Other reference
+     */
+    void swap(unified_reference& other) {
+        T temp = this->operator T();
+        container_->set_impl(index_, other.operator T());
+        other.container_->set_impl(other.index_, temp);
+    }
+    
+    /**
+     * @brief Get const pointer to element (read-only)
+     * @return Const pointer
+     */
+    const T* get_ptr() const {
+        return &container_->data_impl()[index_];
+    }
+};
+
+/**
+ * @brief Non-member swap for unified_reference
+ * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
+ * @param lhs Left reference
+ * @param rhs Right reference
+ */
+template<typename T, typename Alloc>
+void swap(unified_reference<T, Alloc> lhs, unified_reference<T, Alloc> rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace vulkan_stdpar
+
+
+// ========== containers/unified_vector.hpp ==========
+
+/**
+ * @file unified_vector.hpp
+ * @brief Drop-in replacement for std::vector with GPU acceleration
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ * 
+ * This file implements unified_vector, a container that provides 100% std::vector
+ * API compatibility while enabling transparent GPU acceleration for parallel algorithms.
+ */
+
+
+#include <vector>
+#include <initializer_list>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Tag selecting constructors and resize overloads that leave new elements uninitialized
+ */
+struct no_init_t {
+    explicit no_init_t() = default;
+};
+
+/**
+ * @brief Tag selecting constructors that initialize elements on the device
+ */
+struct on_device_t {
+    explicit on_device_t() = default;
+};
+
+/**
+ * @brief Leave new elements uninitialized; see unified_vector(size_type, no_init_t)
+ */
+inline constexpr no_init_t no_init{};
+
+/**
+ * @brief Initialize elements on the device; see unified_vector(size_type, const T&, on_device_t)
+ */
+inline constexpr on_device_t on_device{};
+
+/**
+ * @brief Unified vector with automatic GPU acceleration
+ * 
+ * This class provides a drop-in replacement for std::vector that automatically
+ * manages host/device memory synchronization and enables GPU acceleration for
+ * standard parallel algorithms.
+ * 
+ * @tparam T Element type (must be trivially copyable)
+ * @tparam Alloc Host storage allocator (std::allocator uses aligned/mmap storage)
+ */
+template<typename T, typename Alloc>
+class unified_vector {
+public:
+    // Type definitions (match std::vector)
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = unified_reference<T, Alloc>;
+    using const_reference = const T&;
+    using pointer = void;  // Disabled to prevent pointer escape
+    using const_pointer = const T*;
+    using iterator = unified_iterator<T, Alloc>;
+    using const_iterator = const_unified_iterator<T, Alloc>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+    using engine_type = versioning_engine<T, Alloc>;
+    
+    /// Empty vectors share one engine, so moving never allocates
+    static constexpr bool shares_empty_engine =
+        std::is_default_constructible<Alloc>::value && alloc_traits::is_always_equal::value;
+    
+    std::shared_ptr<engine_type> engine_;  ///< Memory state management (shared by copy-on-write copies)
+    size_type size_;                       ///< Current element count
+    
+    // Friend declarations
+    template<typename U, typename A> friend class unified_reference;
+    template<typename U, typename A> friend class unified_iterator;
+    template<typename U, typename A> friend class const_unified_iterator;
+    template<typename U, typename A, typename... Rest>
+    friend unified_vector<U, A> concat(const unified_vector<U, A>& first, const Rest&... rest);
+    
+public:
+    // ==================== Constructors ====================
+    
+    /**
+     * @brief Default constructor
+     */
+    unified_vector() : engine_(empty_engine(Alloc())), size_(0) {}
+    
+    /**
+     * @brief Construct empty vector with allocator
+     * @param alloc Host storage allocator
+     */
+    explicit unified_vector(const Alloc& alloc)
+        : engine_(make_engine(0, storage_options(), alloc)), size_(0) {}
+    
+    /**
+     * @brief Construct empty vector with host storage configuration
+     * @param options Host storage options (alignment, huge pages, copy-on-write)
+     * @param alloc Host storage allocator
+     */
+    explicit unified_vector(const storage_options& options, const Alloc& alloc = Alloc())
+        : engine_(make_engine(0, options, alloc)), size_(0) {}
+    
+    /**
+     * @brief Construct with size
+     * @param count Number of elements
+     * @param alloc Host storage allocator
+     */
+    explicit unified_vector(size_type count, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
+    {
+        initialize_fill(data_impl(), count, T());
+    }
+    
+    /**
+     * @brief Construct with size and value
+     * @param count Number of elements
+     * @param value Initial value
+     * @param alloc Host storage allocator
+     */
+    unified_vector(size_type count, const T& value, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
+    {
+        initialize_fill(data_impl(), count, value);
+    }
+    
+    /**
+     * @brief Construct with size, leaving elements uninitialized
+     * 
+     * Host memory is neither written nor uploaded: elements hold
+     * indeterminate values until written, on the host or by an algorithm.
+     * Use for outputs that are overwritten in full. Types that are not
+     * trivially default constructible are value-initialized instead.
+     * 
+     * @param count Number of elements
+     * @param tag no_init
+     * @param alloc Host storage allocator
+     */
+    unified_vector(size_type count, no_init_t tag, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
+    {
+        (void)tag;
+        if constexpr (std::is_trivially_default_constructible<T>::value) {
+            engine_->discard_range(0, count);
+        } else {
+            initialize_fill(data_impl(), count, T());
+        }
+    }
+    
+    /**
+     * @brief Construct with size and value, filled on the device
+     * 
+     * The elements are set by a device fill and start device-dirty; host
+     * memory is not written and nothing is transferred until host access.
+     * Without a device the host storage is filled instead.
+     * 
+     * @param count Number of elements
+     * @param value Initial value
+     * @param tag on_device
+     * @param alloc Host storage allocator
+     */
+    unified_vector(size_type count, const T& value, on_device_t tag, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
+    {
+        (void)tag;
+        engine_->fill_device(0, count, value);
+    }
+    
+    /**
+     * @brief Construct from range
+     * @tparam InputIt Iterator type
+     * @param first Beginning of range
+     * @param last End of range
+     * @param alloc Host storage allocator
+     */
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    unified_vector(InputIt first, InputIt last, const Alloc& alloc = Alloc())
+        : engine_(make_engine(std::distance(first, last), storage_options(), alloc))
+        , size_(std::distance(first, last))
+    {
+        initialize_copy(first, last, data_impl());
+    }
+    
+    /**
+     * @brief Construct from initializer list
+     * @param init Initializer list
+     * @param alloc Host storage allocator
+     */
+    unified_vector(std::initializer_list<T> init, const Alloc& alloc = Alloc())
+        : engine_(make_engine(init.size(), storage_options(), alloc))
+        , size_(init.size())
+    {
+        std::copy(init.begin(), init.end(), data_impl());
+    }
+    
+    /**
+     * @brief Copy constructor
+     * 
+     * If other was created with storage_options::copy_on_write, the copy
+     * shares its host and device storage until either vector is written.
+     * Sharers may then be used on different threads, but as with any
+     * container, copying a vector is a read of it and must not race with
+     * a write to that same vector.
+     * 
+     * @param other Vector to copy
+     */
+    unified_vector(const unified_vector& other)
+        : size_(other.size_)
+    {
+        Alloc alloc = alloc_traits::select_on_container_copy_construction(other.get_allocator());
+        if (other.shares_on_copy(alloc)) {
+            engine_ = other.engine_;
+            return;
+        }
+        engine_ = make_engine(size_, other.engine_->get_storage_options(), alloc);
+        copy_elements(*other.engine_, *engine_, size_);
+    }
+    
+    /**
+     * @brief Move constructor
+     * 
+     * Not noexcept for stateful allocators: the moved-from vector needs a
+     * new empty engine holding its allocator.
+     * 
+     * @param other Vector to move
+     */
+    unified_vector(unified_vector&& other) noexcept(shares_empty_engine)
+        : engine_(std::exchange(other.engine_, empty_engine(other.get_allocator())))
+        , size_(other.size_)
+    {
+        other.size_ = 0;
+    }
+    
+    /**
+     * @brief Map a file of raw elements into a vector
+     * 
+     * The vector holds the elements in [offset, offset + length) of the
+     * file. Pages are read on first access rather than copied up front,
+     * and device uploads read straight from the mapping. With
+     * map_mode::read_write, modifications and growth go to the file:
+     * flush() forces them to disk, and the file is trimmed to size() when
+     * the vector is destroyed.
+     * 
+     * @param path File to map
+     * @param mode Whether modifications reach the file
+     * @param offset Byte offset of the first element (multiple of alignof(T))
+     * @param length Bytes to map (default: to the end of the file)
+     * @return Vector backed by the mapping
+     * @throws io_exception if the file cannot be opened or mapped
+     */
+    static unified_vector map_file(const std::string& path, map_mode mode = map_mode::read_only,
+                                   size_t offset = 0, size_t length = static_cast<size_t>(-1)) {
+        unified_vector vec{storage_options()};
+        vec.engine_->map_file(path, mode, offset, length);
+        vec.size_ = vec.engine_->capacity();
+        return vec;
+    }
+    
+    /**
+     * @brief Destructor
+     */
+    ~unified_vector() {
+        close_mapping();
+    }
+    
+    // ==================== Assignment ====================
+    
+    /**
+     * @brief Copy assignment
+     * 
+     * Shares other's storage under the same conditions as the copy
+     * constructor; otherwise copies into storage configured like this
+     * vector's.
+     * 
+     * @param other Vector to copy
+     * @return Reference to this
+     */
+    unified_vector& operator=(const unified_vector& other) {
+        if (this != &other) {
+            close_mapping();
+            Alloc alloc = alloc_traits::propagate_on_container_copy_assignment::value
+                              ? other.get_allocator() : get_allocator();
+            if (other.shares_on_copy(alloc)) {
+                engine_ = other.engine_;
+                size_ = other.size_;
+                return *this;
+            }
+            auto copy = make_engine(other.size_, engine_->get_storage_options(), alloc);
+            copy_elements(*other.engine_, *copy, other.size_);
+            engine_ = std::move(copy);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+    
+    /**
+     * @brief Move assignment
+     * @param other Vector to move
+     * @return Reference to this
+     */
+    unified_vector& operator=(unified_vector&& other) noexcept(shares_empty_engine) {
+        if (this != &other) {
+            close_mapping();
+            if (!alloc_traits::propagate_on_container_move_assignment::value &&
+                get_allocator() != other.get_allocator()) {
+                // Storage cannot change hands; copy into memory from our allocator
+                auto copy = make_engine(other.size_, engine_->get_storage_options(), get_allocator());
+                copy_elements(*other.engine_, *copy, other.size_);
+                engine_ = std::move(copy);
+                size_ = other.size_;
+                return *this;
+            }
+            engine_ = std::exchange(other.engine_, empty_engine(other.get_allocator()));
+            size_ = other.size_;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+    
+    /**
+     * @brief Assign from initializer list
+     * @param init Initializer list
+     * @return Reference to this
+     */
+    unified_vector& operator=(std::initializer_list<T> init) {
+        assign(init);
+        return *this;
+    }
+    
+    /**
+     * @brief Assign from range
+     * @tparam InputIt Iterator type
+     * @param first Beginning of range
+     * @param last End of range
+     */
+    template<typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        size_type new_size = std::distance(first, last);
+        detach(new_size, false);
+        if (new_size > capacity()) {
+            engine_->resize(new_size);
+        }
+        size_ = new_size;
+        initialize_copy(first, last, data_impl());
+        engine_->mark_host_dirty(0, size_);
+    }
+    
+    /**
+     * @brief Assign from count copies of value
+     * @param count Number of elements
+     * @param value Value to copy
+     */
+    void assign(size_type count, const T& value) {
+        detach(count, false);
+        if (count > capacity()) {
+            engine_->resize(count);
+        }
+        size_ = count;
+        initialize_fill(data_impl(), count, value);
+        engine_->mark_host_dirty(0, size_);
+    }
+    
+    /**
+     * @brief Assign from initializer list
+     * @param init Initializer list
+     */
+    void assign(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+    
+    /**
+     * @brief Get host storage allocator
+     * @return Copy of the allocator
+     */
+    allocator_type get_allocator() const {
+        return engine_->get_allocator();
+    }
+    
+    // ==================== Element Access ====================
+    
+    /**
+     * @brief Access element with bounds checking
+     * @param pos Element index
+     * @return Reference to element
+     * @throws std::out_of_range if pos >= size
+*/
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("unified_vector::at: index out of range");
+        }
+        return reference(this, pos);
+    }
+    
+    /**
+     * @brief Access element with bounds checking (const)
+     * @param pos Element index
+     * @return Const reference to element
+     * @throws std::out_of_range if pos >= size
+     */
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("unified_vector::at: index out of range");
+        }
+        return at_impl(pos);
+    }
+    
+    /**
+     * @brief Access element without bounds checking
+     * @param pos Element index
+     * @return Reference to element
+     */
+    reference operator[](size_type pos) {
+        return reference(this, pos);
+    }
+    
+    /**
+     * @brief Access element without bounds checking (const)
+     * @param pos Element index
+     * @return Const reference to element
+     */
+    const_reference operator[](size_type pos) const {
+        return at_impl(pos);
+    }
+    
+    /**
+     * @brief Access first element
+     * @return Reference to first element
+     */
+    reference front() {
+        return reference(this, 0);
+    }
+    
+    /**
+     * @brief Access first element (const)
+     * @return Const reference to first element
+     */
+    const_reference front() const {
+        return at_impl(0);
+    }
+    
+    /**
+     * @brief Access last element
+     * @return Reference to last element
+     */
+    reference back() {
+        return reference(this, size_ - 1);
+    }
+    
+    /**
+     * @brief Access last element (const)
+     * @return Const reference to last element
+     */
+    const_reference back() const {
+        return at_impl(size_ - 1);
+    }
+    
+    /**
+     * @brief Get pointer to underlying data (const)
+     * @return Pointer to data
+     */
+    const T* data() const {
+        engine_->sync_to_host();
+        return data_impl();
+    }
+    
+    // ==================== Iterators ====================
+    
+    // Const iterators synchronize to host on construction and may throw
+    iterator begin() noexcept;
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    
+    iterator end() noexcept;
+    const_iterator end() const;
+    const_iterator cend() const;
+    
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(cend()); }
+    
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(cbegin()); }
+    
+    // ==================== Capacity ====================
+    
+    /**
+     * @brief Check if vector is empty
+     * @return True if size == 0
+     */
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+    
+    /**
+     * @brief Get number of elements
+     * @return Current size
+     */
+    size_type size() const noexcept {
+        return size_;
+    }
+    
+    /**
+     * @brief Get maximum possible size
+     * @return Maximum size
+     */
+    size_type max_size() const noexcept {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+    
+    /**
+     * @brief Reserve capacity
+     * @param new_cap New capacity
+     */
+    void reserve(size_type new_cap) {
+        if (new_cap > capacity()) {
+            detach(new_cap);
+            if (new_cap > capacity()) engine_->resize(new_cap);
+        }
+    }
+    
+    /**
+     * @brief Get current capacity
+     * @return Capacity
+     */
+    size_type capacity() const noexcept {
+        return engine_->capacity();
+    }
+    
+    /**
+     * @brief Reduce capacity to fit size
+     */
+    void shrink_to_fit() {
+        if (size_ < capacity()) {
+            engine_->resize(size_);
+        }
+    }
+    
+    // ==================== Modifiers ====================
+    
+    /**
+     * @brief Clear all elements
+     */
+    void clear() noexcept {
+        size_ = 0;
+        if (owns_engine()) engine_->clear_dirty_ranges();
+    }
+    
+    /**
+     * @brief Insert element at position
+     * 
+     * Every insert resolves pos to an index. A const_iterator has already
+     * synchronized the vector to host when it was created; pass an
+     * iterator (e.g. begin() + i) to keep device-resident data on the
+     * device.
+     * 
+     * @param pos Position to insert at
+     * @param value Value to insert
+     * @return Iterator to inserted element
+     */
+    iterator insert(const_iterator pos, const T& value) {
+        return insert_fill(pos.get_index(), 1, value);
+    }
+    
+    iterator insert(iterator pos, const T& value) {
+        return insert_fill(pos.get_index(), 1, value);
+    }
+    
+    /**
+     * @brief Insert element at position (move)
+     * @param pos Position to insert at
+     * @param value Value to insert
+     * @return Iterator to inserted element
+     */
+    iterator insert(const_iterator pos, T&& value) {
+        return insert_value(pos.get_index(), std::move(value));
+    }
+    
+    iterator insert(iterator pos, T&& value) {
+        return insert_value(pos.get_index(), std::move(value));
+    }
+    
+    /**
+     * @brief Insert count copies of value at position
+     * 
+     * Like the range overloads, this grows storage at most once and moves
+     * the tail once. If the newest data is on the device, the tail moves
+     * there and only the new elements are uploaded.
+     * 
+     * @param pos Position to insert at
+     * @param count Number of copies
+     * @param value Value to insert
+     * @return Iterator to the first inserted element
+     */
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        return insert_fill(pos.get_index(), count, value);
+    }
+    
+    iterator insert(iterator pos, size_type count, const T& value) {
+        return insert_fill(pos.get_index(), count, value);
+    }
+    
+    /**
+     * @brief Insert a range at position
+     * 
+     * Ranges of another unified_vector are copied device to device when
+     * both vectors' newest data is on the device.
+     * 
+     * @tparam InputIt Iterator type (must not point into this vector)
+     * @param pos Position to insert at
+     * @param first Beginning of range
+     * @param last End of range
+     * @return Iterator to the first inserted element
+     */
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        return insert_range(pos.get_index(), first, last);
+    }
+    
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    iterator insert(iterator pos, InputIt first, InputIt last) {
+        return insert_range(pos.get_index(), first, last);
+    }
+    
+    /**
+     * @brief Insert an initializer list at position
+     * @param pos Position to insert at
+     * @param init Elements to insert
+     * @return Iterator to the first inserted element
+     */
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert_range(pos.get_index(), init.begin(), init.end());
+    }
+    
+    iterator insert(iterator pos, std::initializer_list<T> init) {
+        return insert_range(pos.get_index(), init.begin(), init.end());
+    }
+    
+    /**
+     * @brief Append the elements of a range
+     * @tparam Range Type with std::begin/std::end, e.g. a container or unified_vector
+     * @param range Elements to append
+     */
+    template<typename Range>
+    void append_range(const Range& range) {
+        if constexpr (std::is_same<Range, unified_vector>::value) {
+            // Neither vector is synchronized to host unless the copy needs it
+            insert_from(size_, range, 0, range.size());
+        } else {
+            insert_range(size_, std::begin(range), std::end(range));
+        }
+    }
+    
+    /**
+     * @brief Erase element at position
+     * @param pos Position to erase
+     * @return Iterator to next element
+     */
+    iterator erase(const_iterator pos);
+    
+    /**
+     * @brief Erase range of elements
+     * @param first Beginning of range
+     * @param last End of range
+     * @return Iterator to next element
+     */
+    iterator erase(const_iterator first, const_iterator last);
+    
+    /**
+     * @brief Add element to end
+     * @param value Value to add
+     */
+    void push_back(const T& value) {
+        detach();
+        if (size_ >= capacity()) {
+            size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
+            reserve(new_cap);
+        }
+        data_impl()[size_] = value;
+        engine_->mark_host_dirty(size_, size_ + 1);
+        ++size_;
+    }
+    
+    /**
+     * @brief Add element to end (move)
+     * @param value Value to add
+     */
+    void push_back(T&& value) {
+        detach();
+        if (size_ >= capacity()) {
+            size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
+            reserve(new_cap);
+        }
+        data_impl()[size_] = std::move(value);
+        engine_->mark_host_dirty(size_, size_ + 1);
+        ++size_;
+    }
+    
+    /**
+     * @brief Construct element in place at end
+     * @tparam Args Constructor argument types
+     * @param args Constructor arguments
+     * @return Reference to constructed element
+     */
+    template<typename... Args>
+    reference emplace_back(Args&&... args) {
+        detach();
+        if (size_ >= capacity()) {
+            size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
+            reserve(new_cap);
+        }
+        new (&data_impl()[size_]) T(std::forward<Args>(args)...);
+        engine_->mark_host_dirty(size_, size_ + 1);
+        return reference(this, size_++);
+    }
+    
+    /**
+     * @brief Remove last element
+     */
+    void pop_back() {
+        if (size_ > 0) {
+            --size_;
+        }
+    }
+    
+    /**
+     * @brief Resize vector
+     * @param count New size
+     */
+    void resize(size_type count) {
+        resize(count, T());
+    }
+    
+    /**
+     * @brief Resize vector with value
+     * @param count New size
+     * @param value Value for new elements
+     */
+    void resize(size_type count, const T& value) {
+        if (count > size_) detach(count);
+        if (count > capacity()) {
+            reserve(count);
+        }
+        if (count > size_) {
+            initialize_fill(data_impl() + size_, count - size_, value);
+            engine_->mark_host_dirty(size_, count);
+        }
+        size_ = count;
+    }
+    
+    /**
+     * @brief Resize vector, leaving new elements uninitialized
+     * 
+     * New elements hold indeterminate values and are not uploaded to the
+     * device until written. Types that are not trivially default
+     * constructible are value-initialized instead.
+     * 
+     * @param count New size
+     * @param tag no_init
+     */
+    void resize(size_type count, no_init_t tag) {
+        (void)tag;
+        if constexpr (!std::is_trivially_default_constructible<T>::value) {
+            resize(count);
+            return;
+        }
+        if (count > size_) {
+            detach(count);
+            if (count > capacity()) reserve(count);
+            engine_->discard_range(size_, count);
+        }
+        size_ = count;
+    }
+    
+    /**
+     * @brief Swap with another vector
+     * @param other Other vector
+     */
+    void swap(unified_vector& other) noexcept {
+        std::swap(engine_, other.engine_);
+        std::swap(size_, other.size_);
+    }
+    
+    // ==================== Internal Implementation ====================
+    
+private:
+    /**
+     * @brief Adopt an engine holding size initialized elements
+     */
+    unified_vector(std::shared_ptr<engine_type> engine, size_type size) noexcept
+        : engine_(std::move(engine)), size_(size) {}
+    
+    /**
+     * @brief Get element value (implementation)
+     */
+    const T& at_impl(size_type index) const {
+        engine_->sync_to_host();
+        return data_impl()[index];
+    }
+    
+    /**
+     * @brief Set element value (implementation)
+     */
+    void set_impl(size_type index, const T& value) {
+        detach();
+        engine_->sync_to_host();
+        data_impl()[index] = value;
+        engine_->mark_host_dirty(index, index + 1);
+    }
+    
+    /**
+     * @brief Set element value (implementation, move)
+     */
+    void set_impl(size_type index, T&& value) {
+        detach();
+        engine_->sync_to_host();
+        data_impl()[index] = std::move(value);
+        engine_->mark_host_dirty(index, index + 1);
+    }
+    
+    /**
+     * @brief Get data pointer (mutable)
+     */
+    T* data_impl() {
+        return engine_->host_data();
+    }
+    
+    /**
+     * @brief Get data pointer (const)
+     */
+    const T* data_impl() const {
+        return engine_->host_data();
+    }
+    
+    /**
+     * @brief Create an engine owned by this vector
+     */
+    static std::shared_ptr<engine_type> make_engine(size_type capacity, const storage_options& options,
+                                                    const Alloc& alloc) {
+        // Create the shared empty engine before any vector can be moved from
+        if constexpr (shares_empty_engine) (void)shared_empty_engine();
+        return std::make_shared<engine_type>(capacity, options, alloc);
+    }
+    
+    /**
+     * @brief Get the engine shared by empty vectors
+     * 
+     * Created by the first vector constructed, so later calls (from the
+     * noexcept move operations) do not allocate.
+     */
+    static const std::shared_ptr<engine_type>& shared_empty_engine() {
+        // Never destroyed: vectors with static storage duration may still
+        // hold it after other statics have been torn down
+        static const std::shared_ptr<engine_type>* empty =
+            new std::shared_ptr<engine_type>(std::make_shared<engine_type>(0, storage_options(), Alloc()));
+        return *empty;
+    }
+    
+    /**
+     * @brief Get an empty engine for default-constructed and moved-from vectors
+     * 
+     * With stateless default-constructible allocators all such vectors share
+     * one engine, so neither default construction nor moving allocates; the
+     * first write gives a vector its own engine. Other allocators get a new
+     * empty engine, which is a small allocation.
+     */
+    static std::shared_ptr<engine_type> empty_engine(const Alloc& alloc) {
+        if constexpr (shares_empty_engine) {
+            (void)alloc;
+            return shared_empty_engine();
+        } else {
+            return make_engine(0, storage_options(), alloc);
+        }
+    }
+    
+    /**
+     * @brief Check whether no other vector shares this vector's engine
+     * 
+     * The reference count is read relaxed; the fence orders this vector's
+     * following writes after everything a sharer did before dropping its
+     * reference on another thread.
+     */
+    bool owns_engine() const noexcept {
+        if (engine_.use_count() != 1) return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+    
+    /**
+     * @brief Check whether a copy using alloc may share this vector's storage
+     */
+    bool shares_on_copy(const Alloc& alloc) const {
+        if constexpr (shares_empty_engine) {
+            // Placeholder for empty vectors: share it without touching its lock
+            if (engine_ == shared_empty_engine()) return true;
+        }
+        const engine_type& engine = *engine_;
+        return engine.get_storage_options().copy_on_write && !engine.is_file_mapped() &&
+               !engine.has_host_writers() && alloc == engine.get_allocator();
+    }
+    
+    /**
+     * @brief Give this vector its own storage before a write
+     * 
+     * A no-op unless the engine is shared with copy-on-write copies (or is
+     * the shared empty engine). The new engine has the same configuration.
+     * A device-dirty shared copy is copied on the device, leaving the
+     * other sharers' state alone.
+     * 
+     * @param min_capacity Capacity the new storage needs at least
+     * @param preserve Copy the current elements (false when all are overwritten)
+     */
+    void detach(size_type min_capacity = 0, bool preserve = true) {
+        if (owns_engine()) return;
+        const engine_type& shared = *engine_;
+        auto own = make_engine(std::max(min_capacity, preserve ? shared.capacity() : 0),
+                               shared.get_storage_options(), shared.get_allocator());
+        if (preserve) copy_elements(shared, *own, size_);
+        engine_ = std::move(own);
+    }
+    
+    /**
+     * @brief Copy the first count elements of from into the new engine to
+     * 
+     * A device-dirty source is copied device to device and the new engine
+     * starts device-dirty, so host memory is neither read nor written.
+     * Otherwise the elements are copied on the host.
+     */
+    static void copy_elements(const engine_type& from, engine_type& to, size_type count) {
+        if (count == 0 || to.copy_device_from(from, count)) return;
+        from.sync_to_host();
+        initialize_copy(from.host_data(), from.host_data() + count, to.host_data());
+    }
+    
+    /**
+     * @brief Run fn(begin, end) over [0, count), on the thread pool for large counts
+     * 
+     * Chunks match the partition of host::parallel_for, so with
+     * numa_placement::local the pages of fresh storage are first touched,
+     * and placed, by the threads that later run host algorithms on them.
+     */
+    template<typename Fn>
+    static void initialize_chunks(size_type count, Fn&& fn) {
+        if (host::should_parallelize(count)) {
+            host::parallel_for(count, fn);
+        } else {
+            fn(size_type(0), count);
+        }
+    }
+    
+    /**
+     * @brief Fill out[0, count) with value, in parallel for large counts
+     */
+    static void initialize_fill(T* out, size_type count, const T& value) {
+        initialize_chunks(count, [&](size_type begin, size_type end) {
+            std::fill(out + begin, out + end, value);
+        });
+    }
+    
+    /**
+     * @brief Copy [first, last) to out, in parallel for large random-access ranges
+     */
+    template<typename InputIt>
+    static void initialize_copy(InputIt first, InputIt last, T* out) {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of<std::random_access_iterator_tag, category>::value) {
+            initialize_chunks(static_cast<size_type>(last - first), [&](size_type begin, size_type end) {
+                std::copy(first + begin, first + end, out + begin);
+            });
+        } else {
+            std::copy(first, last, out);
+        }
+    }
+    
+    /**
+     * @brief Make room for count elements at pos
+     * 
+     * Grows at most once, then moves [pos, size()) up by count: on the
+     * device if the newest data is there, otherwise on the host, where the
+     * moved tail is marked dirty. size() includes the gap on return.
+     * 
+     * @return True if the gap was opened on the device; the caller then
+     *         writes the new elements on the host and calls upload_range()
+     */
+    bool open_gap(size_type pos, size_type count) {
+        size_type new_size = size_ + count;
+        detach(new_size);
+        if (new_size > capacity()) {
+            reserve(std::max(new_size, capacity() * 2));
+        }
+        bool on_device = engine_->is_device_resident();
+        if (on_device) {
+            engine_->shift_device_range(pos, size_, pos + count);
+        } else {
+            engine_->sync_to_host();
+            std::copy_backward(data_impl() + pos, data_impl() + size_, data_impl() + new_size);
+            engine_->mark_host_dirty(pos, new_size);
+        }
+        size_ = new_size;
+        return on_device;
+    }
+    
+    /**
+     * @brief Insert value at index pos (move)
+     */
+    iterator insert_value(size_type pos, T&& value);
+    
+    /**
+     * @brief Insert count copies of value at index pos
+     */
+    iterator insert_fill(size_type pos, size_type count, const T& value);
+    
+    /**
+     * @brief Insert [first, last) at index pos
+     */
+    template<typename InputIt>
+    iterator insert_range(size_type pos, InputIt first, InputIt last);
+    
+    /**
+     * @brief Insert count elements of source starting at index start
+     */
+    iterator insert_from(size_type pos, const unified_vector& source, size_type start, size_type count);
+    
+    /**
+     * @brief Unmap a file-backed vector, trimming the file to size()
+     */
+    void close_mapping() noexcept {
+        if (!owns_engine() || !engine_->is_file_mapped()) return;
+        try {
+            engine_->close_file(size_);
+        } catch (...) {
+            // Device write-back failed; the file keeps its last host contents
+        }
+        size_ = 0;
+    }
+    
+public:
+    // ==================== GPU Integration ====================
+    
+    /**
+     * @brief Prefetch data to device
+     */
+    void prefetch_to_device() {
+        engine_->sync_to_device();
+    }
+    
+    /**
+     * @brief Write device results back and msync a read_write file mapping
+     */
+    void flush() {
+        engine_->flush_file();
+    }
+    
+    /**
+     * @brief Get versioning engine for GPU operations
+     * 
+     * Callers may write through the engine, so a vector sharing storage
+     * with copy-on-write copies gets its own storage first.
+     * 
+     * @return Reference to versioning engine
+     */
+    versioning_engine<T, Alloc>& get_engine() {
+        detach();
+        return *engine_;
+    }
+    
+    /**
+     * @brief Get versioning engine for reading (const)
+     * 
+     * Does not detach: the engine may be shared with copy-on-write copies.
+     * 
+     * @return Const reference to versioning engine
+     */
+    const versioning_engine<T, Alloc>& get_engine() const {
+        return *engine_;
+    }
+    
+    /**
+     * @brief Check whether storage is shared with copy-on-write copies
+     * @return True if another vector references the same storage
+     */
+    bool shares_storage() const noexcept {
+        return engine_.use_count() > 1 && engine_->capacity() > 0;
+    }
+};
+
+// ==================== Non-member Functions ====================
+
+/**
+ * @brief Equality comparison
+ */
+template<typename T, typename Alloc>
+bool operator==(const unified_vector<T, Alloc>& lhs, const unified_vector<T, Alloc>& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/**
+ * @brief Inequality comparison
+ */
+template<typename T, typename Alloc>
+bool operator!=(const unified_vector<T, Alloc>& lhs, const unified_vector<T, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Less than comparison
+ */
+template<typename T, typename Alloc>
+bool operator<(const unified_vector<T, Alloc>& lhs, const unified_vector<T, Alloc>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/**
+ * @brief Swap specialization
+ */
+template<typename T, typename Alloc>
+void swap(unified_vector<T, Alloc>& lhs, unified_vector<T, Alloc>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief Concatenate vectors into a new vector
+ * 
+ * The result is allocated once. Parts whose newest data is on the device
+ * are copied there first, device to device; the remaining parts are then
+ * copied on the host and uploaded, so a result assembled from device data
+ * stays on the device. If no part is on the device, everything is copied
+ * on the host. The result uses the first vector's storage options and
+ * allocator.
+ * 
+ * @code
+ * auto all = concat(train, validation, test);
+ * @endcode
+ * 
+ * @param first First vector
+ * @param rest Further vectors of the same type
+ * @return Vector holding the elements of all arguments in order
+ */
+template<typename T, typename Alloc, typename... Rest>
+unified_vector<T, Alloc> concat(const unified_vector<T, Alloc>& first, const Rest&... rest) {
+    static_assert((std::is_same<Rest, unified_vector<T, Alloc>>::value && ...),
+                  "concat requires vectors of the same type");
+    using vector_type = unified_vector<T, Alloc>;
+    const vector_type* parts[] = {&first, &rest...};
+    
+    size_t total = 0;
+    for (const vector_type* part : parts) total += part->size_;
+    
+    vector_type result(vector_type::make_engine(
+                           total, first.engine_->get_storage_options(),
+                           std::allocator_traits<Alloc>::select_on_container_copy_construction(
+                               first.get_allocator())),
+                       total);
+    if (total == 0) return result;
+    
+    bool copied[sizeof...(Rest) + 1] = {};
+    bool on_device = false;
+    size_t offset = 0;
+    for (size_t i = 0; i <= sizeof...(Rest); ++i) {
+        copied[i] = result.engine_->copy_device_from(*parts[i]->engine_, parts[i]->size_, offset);
+        on_device = on_device || copied[i];
+        offset += parts[i]->size_;
+    }
+    
+    offset = 0;
+    for (size_t i = 0; i <= sizeof...(Rest); ++i) {
+        size_t count = parts[i]->size_;
+        if (!copied[i] && count > 0) {
+            parts[i]->engine_->sync_to_host();
+            std::copy_n(parts[i]->data_impl(), count, result.data_impl() + offset);
+            if (on_device) result.engine_->upload_range(offset, offset + count);
+        }
+        offset += count;
+    }
+    return result;
+}
+
+} // namespace vulkan_stdpar
+
+// Include iterator implementation
+
+
+// ========== containers/host_view.hpp ==========
+
+/**
+ * @file host_view.hpp
+ * @brief Scoped bulk host access to unified_vector storage
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file implements host_view, an RAII object that synchronizes a
+ * unified_vector to the host once and exposes a raw pointer range for
+ * vectorizable loops, marking the declared range dirty on destruction.
+ */
+
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Declared access intent for a host_view
+ */
+enum class access {
+    read,           ///< Elements are only read
+    write,          ///< Elements are written (declared range marked dirty)
+    read_write      ///< Elements are read and written (declared range marked dirty)
+};
+
+/**
+ * @brief Scoped raw-pointer view over a range of a unified_vector
+ *
+ * Construction synchronizes the vector to the host once; element access is
+ * then a plain pointer dereference with no locking or per-element dirty
+ * tracking. On destruction, views opened with access::write or
+ * access::read_write mark exactly [first, last) as host dirty. An
+ * access::write view of the whole vector drops a device-dirty copy instead
+ * of downloading it.
+ *
+ * Read-only views are host_view<const T>, deduced for const vectors and
+ * returned by read_view() for any vector, so their elements cannot be
+ * written through the view.
+ *
+ * The view does not hold the engine lock. Growing, shrinking or running a
+ * device algorithm on the vector while a view is alive invalidates it, as
+ * does writing to a copy-on-write vector that still shares its storage.
+ * Copies of a vector with a writable view open never share storage.
+ *
+ * @tparam T Element type (const-qualified for read-only views)
+ * @tparam Alloc Allocator of the viewed container
+ */
+template<typename T, typename Alloc = std::allocator<std::remove_cv_t<T>>>
+class host_view {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+    using container_type = std::conditional_t<std::is_const<T>::value,
+                                              const unified_vector<value_type, Alloc>,
+                                              unified_vector<value_type, Alloc>>;
+
+private:
+    container_type* container_;    ///< Viewed container (nullptr when moved-from)
+    pointer data_;                 ///< First element of the view
+    size_type first_;              ///< Start index in the container
+    size_type count_;              ///< Number of elements in the view
+    access mode_;                  ///< Declared access intent
+
+public:
+    /**
+     * @brief View the whole vector
+     * @param vec Vector to view
+     * @param mode Declared access intent
+     */
+    explicit host_view(container_type& vec, access mode = default_mode())
+        : host_view(vec, mode, 0, vec.size())
+    {}
+
+    /**
+     * @brief View the index range [first, last) of a vector
+     * @param vec Vector to view
+     * @param mode Declared access intent
+     * @param first Start index (inclusive)
+     * @param last End index (exclusive)
+     * @throws std::out_of_range if the range exceeds the vector size
+     * @throws invalid_argument_exception if mode is access::read for non-const T,
+     *         or not access::read for const T
+     */
+    host_view(container_type& vec, access mode, size_type first, size_type last)
+        : container_(&vec)
+        , data_(nullptr)
+        , first_(first)
+        , count_(0)
+        , mode_(mode)
+    {
+        if (first > last || last > vec.size()) {
+            throw std::out_of_range("host_view: range out of bounds");
+        }
+
+        // A single sync covers every access through the view
+        if constexpr (std::is_const<T>::value) {
+            if (mode != access::read) {
+                throw invalid_argument_exception("mode", "host_view<const T> only supports access::read");
+            }
+            const auto& engine = vec.get_engine();
+            engine.sync_to_host();
+            data_ = engine.host_data() + first;
+        } else {
+            if (mode == access::read) {
+                throw invalid_argument_exception("mode", "read-only views are host_view<const T>; see read_view()");
+            }
+            // Non-const get_engine() detaches copy-on-write storage
+            auto& engine = vec.get_engine();
+            if (mode == access::write && first == 0 && last == vec.size()) {
+                // Every element is overwritten; nothing on the device is worth downloading
+                engine.discard_device_copy();
+            } else {
+                // Device-dirty data outside the written range must not be lost
+                engine.sync_to_host();
+            }
+            engine.retain_host_writer();
+            data_ = engine.host_data() + first;
+        }
+        count_ = last - first;
+    }
+
+    /**
+     * @brief Destructor - marks the declared range dirty for writable views
+     */
+    ~host_view() {
+        release();
+    }
+
+    // Non-copyable but movable
+    host_view(const host_view&) = delete;
+    host_view& operator=(const host_view&) = delete;
+
+    host_view(host_view&& other) noexcept
+        : container_(other.container_)
+        , data_(other.data_)
+        , first_(other.first_)
+        , count_(other.count_)
+        , mode_(other.mode_)
+    {
+        other.container_ = nullptr;
+    }
+
+    host_view& operator=(host_view&& other) noexcept {
+        if (this != &other) {
+            release();
+            container_ = other.container_;
+            data_ = other.data_;
+            first_ = other.first_;
+            count_ = other.count_;
+            mode_ = other.mode_;
+            other.container_ = nullptr;
+        }
+        return *this;
+    }
+
+    // ==================== Span Interface ====================
+
+    pointer data() const noexcept { return data_; }
+    size_type size() const noexcept { return count_; }
+    size_type size_bytes() const noexcept { return count_ * sizeof(T); }
+    bool empty() const noexcept { return count_ == 0; }
+
+    iterator begin() const noexcept { return data_; }
+    iterator end() const noexcept { return data_ + count_; }
+
+    reference operator[](size_type pos) const noexcept { return data_[pos]; }
+    reference front() const noexcept { return data_[0]; }
+    reference back() const noexcept { return data_[count_ - 1]; }
+
+    /**
+     * @brief Get the container index of the first viewed element
+     * @return Start index
+     */
+    size_type offset() const noexcept { return first_; }
+
+    /**
+     * @brief Get the declared access intent
+     * @return Access mode
+     */
+    access mode() const noexcept { return mode_; }
+
+private:
+    static constexpr access default_mode() {
+        return std::is_const<T>::value ? access::read : access::read_write;
+    }
+
+    /**
+     * @brief Publish writes and detach from the container
+     */
+    void release() {
+        if constexpr (!std::is_const<T>::value) {
+            if (container_ && mode_ != access::read) {
+                auto& engine = container_->get_engine();
+                if (count_ > 0) engine.mark_host_dirty(first_, first_ + count_);
+                engine.release_host_writer();
+            }
+        }
+        container_ = nullptr;
+    }
+};
+
+// ==================== Factories ====================
+
+/**
+ * @brief Open a read-only view of a vector, whether or not it is const
+ * @param vec Vector to view
+ * @return View over const elements
+ */
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(const unified_vector<T, Alloc>& vec) {
+    return host_view<const T, Alloc>(vec);
+}
+
+/**
+ * @brief Open a read-only view of the index range [first, last) of a vector
+ * @param vec Vector to view
+ * @param first Start index (inclusive)
+ * @param last End index (exclusive)
+ * @return View over const elements
+ * @throws std::out_of_range if the range exceeds the vector size
+ */
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(const unified_vector<T, Alloc>& vec, size_t first, size_t last) {
+    return host_view<const T, Alloc>(vec, access::read, first, last);
+}
+
+// ==================== Deduction Guides ====================
+
+template<typename T, typename Alloc>
+host_view(unified_vector<T, Alloc>&) -> host_view<T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(unified_vector<T, Alloc>&, access) -> host_view<T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(unified_vector<T, Alloc>&, access, size_t, size_t) -> host_view<T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(const unified_vector<T, Alloc>&) -> host_view<const T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(const unified_vector<T, Alloc>&, access) -> host_view<const T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(const unified_vector<T, Alloc>&, access, size_t, size_t) -> host_view<const T, Alloc>;
+
+} // namespace vulkan_stdpar
+
+
+// ========== iterators/unified_iterator.hpp ==========
+
+/**
+ * @file unified_iterator.hpp
+ * @brief Iterator adaptors for unified_vector with sync-on-dereference
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ * 
+ * This file implements iterators for unified_vector that trigger synchronization
+ * on dereference to maintain data consistency between host and device.
+ */
+
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Mutable iterator for unified_vector
+ * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
+ */
+template<typename T, typename Alloc>
+class unified_iterator {
+public:
+    // Iterator traits
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = ptrdiff_t;
+    using pointer = void;  // Disabled to prevent pointer escape
+    using reference = unified_reference<T, Alloc>;
+    
+private:
+    unified_vector<T, Alloc>* container_;    ///< Parent container
+    size_t index_;                     ///< Current position
+    
+    // Friend declarations
+    template<typename U, typename A> friend class unified_vector;
+    template<typename U, typename A> friend class const_unified_iterator;
+    
+public:
+    /**
+     * @brief Default constructor
+     */
+    unified_iterator() : container_(nullptr), index_(0) {}
+    
+    /**
+     * @brief Construct iterator
+     * @param container Parent container
+     * @param index Start position
+     */
+    unified_iterator(unified_vector<T, Alloc>* container, size_t index)
+        : container_(container), index_(index)
+    {}
+    
+    /**
+     * @brief Copy constructor
+     */
+    unified_iterator(const unified_iterator&) = default;
+    
+    /**
+     * @brief Copy assignment
+     */
+    unified_iterator& operator=(const unified_iterator&) = default;
+    
+    /**
+     * @brief Dereference operator
+     * @return Reference to current element
+     */
+    reference operator*() const {
+        return reference(container_, index_);
+    }
+    
+    /**
+     * @brief Subscript operator
+     * @param n Offset
+     * @return Reference to element at offset
+     */
+    reference operator[](difference_type n) const {
+        return reference(container_, index_ + n);
+    }
+    
+    // ==================== Increment/Decrement ====================
+    
+    /**
+     * @brief Pre-increment
+     */
+    unified_iterator& operator++() {
+        ++index_;
+        return *this;
+    }
+    
+    /**
+     * @brief Post-increment
+     */
+    unified_iterator operator++(int) {
+        unified_iterator temp = *this;
+        ++index_;
+        return temp;
+    }
+    
+    /**
+     * @brief Pre-decrement
+     */
+    unified_iterator& operator--() {
+        --index_;
+        return *this;
+    }
+    
+    /**
+     * @brief Post-decrement
+     */
+    unified_iterator operator--(int) {
+        unified_iterator temp = *this;
+        --index_;
+        return temp;
+    }
+    
+    // ==================== Arithmetic ====================
+    
+    /**
+     * @brief Add offset
+     */
+    unified_iterator& operator+=(difference_type n) {
+        index_ += n;
+        return *this;
+    }
+    
+    /**
+     * @brief Subtract offset
+     */
+    unified_iterator& operator-=(difference_type n) {
+        index_ -= n;
+        return *this;
+    }
+    
+    /**
+     * @brief Add offset (non-modifying)
+     */
+    unified_iterator operator+(difference_type n) const {
+        return unified_iterator(container_, index_ + n);
+    }
+    
+    /**
+     * @brief Subtract offset (non-modifying)
+     */
+    unified_iterator operator-(difference_type n) const {
+        return unified_iterator(container_, index_ - n);
+    }
+    
+    /**
+     * @brief Distance between iterators
+     */
+    difference_type operator-(const unified_iterator& other) const {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+    
+    // ==================== Comparison ====================
+    
+    /**
+     * @brief Equality comparison
+     */
+    bool operator==(const unified_iterator& other) const {
+        return container_ == other.container_ && index_ == other.index_;
+    }
+    
+    /**
+     * @brief Inequality comparison
+     */
+    bool operator!=(const unified_iterator& other) const {
+        return !(*this == other);
+    }
+    
+    /**
+     * @brief Less than comparison
+     */
+    bool operator<(const unified_iterator& other) const {
+        return index_ < other.index_;
+    }
+    
+    /**
+     * @brief Less than or equal comparison
+     */
+    bool operator<=(const unified_iterator& other) const {
+        return index_ <= other.index_;
+    }
+    
+    /**
+     * @brief Greater than comparison
+     */
+    bool operator>(const unified_iterator& other) const {
+        return index_ > other.index_;
+    }
+    
+    /**
+     * @brief Greater than or equal comparison
+     */
+    bool operator>=(const unified_iterator& other) const {
+        return index_ >= other.index_;
+    }
+    
+    /**
+     * @brief Get current index
+     * @return Index into container
+     */
+    size_t get_index() const {
+        return index_;
+    }
+    
+    /**
+     * @brief Get container pointer
+     * @return Pointer to container
+     */
+    unified_vector<T, Alloc>* get_container() const {
+        return container_;
+    }
+};
+
+/**
+ * @brief Const iterator for unified_vector
+ * 
+ * Const iterators are snapshot iterators: the container is synchronized to
+ * the host once when the iterator is created, and dereferencing reads the
+ * host copy through a raw pointer with no locking. With VULKAN_STDPAR_DEBUG
+ * defined, dereferencing an iterator whose snapshot was invalidated (by
+ * reallocation or a device-side write) throws.
+ * 
+ * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
+ */
+template<typename T, typename Alloc>
+class const_unified_iterator {
+public:
+    // Iterator traits
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+    
+private:
+    const unified_vector<T, Alloc>* container_;    ///< Parent container
+    size_t index_;                           ///< Current position
+    const T* data_;                          ///< Host snapshot of container data
+#ifdef VULKAN_STDPAR_DEBUG
+    uint64_t epoch_;                         ///< Host epoch at snapshot time
+#endif
+    
+    // Friend declarations
+    template<typename U, typename A> friend class unified_vector;
+    
+public:
+    /**
+     * @brief Default constructor
+     */
+    const_unified_iterator()
+        : container_(nullptr), index_(0), data_(nullptr)
+#ifdef VULKAN_STDPAR_DEBUG
+        , epoch_(0)
+#endif
+    {}
+    
+    /**
+     * @brief Construct const iterator (synchronizes container to host)
+     * @param container Parent container
+     * @param index Start position
+     */
+    const_unified_iterator(const unified_vector<T, Alloc>* container, size_t index)
+        : container_(container), index_(index), data_(nullptr)
+#ifdef VULKAN_STDPAR_DEBUG
+        , epoch_(0)
+#endif
+    {
+        snapshot();
+    }
+    
+    /**
+     * @brief Construct from mutable iterator (synchronizes container to host)
+     * @param other Mutable iterator
+     */
+    const_unified_iterator(const unified_iterator<T, Alloc>& other)
+        : const_unified_iterator(other.get_container(), other.get_index())
+    {}
+    
+    /**
+     * @brief Copy constructor
+     */
+    const_unified_iterator(const const_unified_iterator&) = default;
+    
+    /**
+     * @brief Copy assignment
+     */
+    const_unified_iterator& operator=(const const_unified_iterator&) = default;
+    
+    /**
+     * @brief Dereference operator
+     * @return Const reference to current element
+     */
+    reference operator*() const {
+        check_snapshot();
+        return data_[index_];
+    }
+    
+    /**
+     * @brief Member access operator
+     * @return Const pointer to current element
+     */
+    pointer operator->() const {
+        check_snapshot();
+        return data_ + index_;
+    }
+    
+    /**
+     * @brief Subscript operator
+     * @param n Offset
+     * @return Const reference to element at offset
+     */
+    reference operator[](difference_type n) const {
+        check_snapshot();
+        return data_[index_ + n];
+    }
+    
+    // ==================== Increment/Decrement ====================
+    
+    const_unified_iterator& operator++() {
+        ++index_;
+        return *this;
+    }
+    
+    const_unified_iterator operator++(int) {
+        const_unified_iterator temp = *this;
+        ++index_;
+        return temp;
+    }
+    
+    const_unified_iterator& operator--() {
+        --index_;
+        return *this;
+    }
+    
+    const_unified_iterator operator--(int) {
+        const_unified_iterator temp = *this;
+        --index_;
+        return temp;
+    }
+    
+    // ==================== Arithmetic ====================
+    
+    const_unified_iterator& operator+=(difference_type n) {
+        index_ += n;
+        return *this;
+    }
+    
+    const_unified_iterator& operator-=(difference_type n) {
+        index_ -= n;
+        return *this;
+    }
+    
+    const_unified_iterator operator+(difference_type n) const {
+        const_unified_iterator result = *this;
+        result.index_ += n;
+        return result;
+    }
+    
+    const_unified_iterator operator-(difference_type n) const {
+        const_unified_iterator result = *this;
+        result.index_ -= n;
+        return result;
+    }
+    
+    difference_type operator-(const const_unified_iterator& other) const {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+    
+    // ==================== Comparison ====================
+    
+    bool operator==(const const_unified_iterator& other) const {
+        return container_ == other.container_ && index_ == other.index_;
+    }
+    
+    bool operator!=(const const_unified_iterator& other) const {
+        return !(*this == other);
+    }
+    
+    bool operator<(const const_unified_iterator& other) const {
+        return index_ < other.index_;
+    }
+    
+    bool operator<=(const const_unified_iterator& other) const {
+        return index_ <= other.index_;
+    }
+    
+    bool operator>(const const_unified_iterator& other) const {
+        return index_ > other.index_;
+    }
+    
+    bool operator>=(const const_unified_iterator& other) const {
+        return index_ >= other.index_;
+    }
+    
+    size_t get_index() const {
+        return index_;
+    }
+    
+    const unified_vector<T, Alloc>* get_container() const {
+        return container_;
+    }
+    
+private:
+    /**
+     * @brief Synchronize the container once and capture its host pointer
+     */
+    void snapshot() {
+        if (!container_) return;
+        const auto& engine = container_->get_engine();
+        // An empty range is never dereferenced; skip the engine lock
+        if (!container_->empty()) {
+            engine.sync_to_host();
+            data_ = engine.host_data();
+        }
+#ifdef VULKAN_STDPAR_DEBUG
+        epoch_ = engine.host_epoch();
+#endif
+    }
+    
+    /**
+     * @brief Verify the snapshot is still valid (debug builds only)
+     */
+    void check_snapshot() const {
+        VULKAN_STDPAR_ASSERT(container_ && epoch_ == container_->get_engine().host_epoch(),
+                             "const_unified_iterator used after its snapshot was invalidated");
+    }
+};
+
+// ==================== Non-member Operators ====================
+
+/**
+ * @brief Add offset to iterator (reversed operands)
+ */
+template<typename T, typename Alloc>
+unified_iterator<T, Alloc> operator+(typename unified_iterator<T, Alloc>::difference_type n, 
+                                     const unified_iterator<T, Alloc>& it) {
+    return it + n;
+}
+
+/**
+ * @brief Add offset to const iterator (reversed operands)
+ */
+template<typename T, typename Alloc>
+const_unified_iterator<T, Alloc> operator+(typename const_unified_iterator<T, Alloc>::difference_type n,
+                                           const const_unified_iterator<T, Alloc>& it) {
+    return it + n;
+}
+
+} // namespace vulkan_stdpar
+
+// Implementation of unified_vector iterator member functions
+namespace vulkan_stdpar {
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator unified_vector<T, Alloc>::begin() noexcept {
+    return iterator(this, 0);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::cbegin() const {
+    return const_iterator(this, 0);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator unified_vector<T, Alloc>::end() noexcept {
+    return iterator(this, size_);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::end() const {
+    return const_iterator(this, size_);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::cend() const {
+    return const_iterator(this, size_);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_value(size_type pos, T&& value) {
+    bool on_device = open_gap(pos, 1);
+    data_impl()[pos] = std::move(value);
+    if (on_device) engine_->upload_range(pos, pos + 1);
+    
+    return iterator(this, pos);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_fill(size_type pos, size_type count, const T& value) {
+    if (count == 0) return iterator(this, pos);
+    
+    // value may refer into this vector; the gap can move or overwrite it
+    T copy = value;
+    bool on_device = open_gap(pos, count);
+    std::fill_n(data_impl() + pos, count, copy);
+    if (on_device) engine_->upload_range(pos, pos + count);
+    
+    return iterator(this, pos);
+}
+
+template<typename T, typename Alloc>
+template<typename InputIt>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_range(size_type pos, InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    
+    if constexpr (std::is_same<InputIt, iterator>::value || std::is_same<InputIt, const_iterator>::value) {
+        // Another unified_vector: bulk copy, on the device where possible
+        size_type count = static_cast<size_type>(last.get_index() - first.get_index());
+        return insert_from(pos, *first.get_container(), first.get_index(), count);
+    } else if constexpr (!std::is_base_of<std::forward_iterator_tag, category>::value) {
+        // Single pass: the length is only known after reading
+        std::vector<T> buffer(first, last);
+        return insert_range(pos, buffer.begin(), buffer.end());
+    } else {
+        size_type count = static_cast<size_type>(std::distance(first, last));
+        if (count == 0) return iterator(this, pos);
+        
+        bool on_device = open_gap(pos, count);
+        std::copy_n(first, count, data_impl() + pos);
+        if (on_device) engine_->upload_range(pos, pos + count);
+        
+        return iterator(this, pos);
+    }
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_from(size_type pos, const unified_vector& source,
+                                      size_type start, size_type count) {
+    if (count == 0) return iterator(this, pos);
+    if (&source == this) {
+        // The gap would move the source elements; copy them out first
+        engine_->sync_to_host();
+        std::vector<T> buffer(data_impl() + start, data_impl() + start + count);
+        return insert_range(pos, buffer.begin(), buffer.end());
+    }
+    
+    if (size_ == 0) {
+        // Nothing to keep: an empty vector can take device data as is
+        detach(count, false);
+        reserve(count);
+        if (engine_->copy_device_from(*source.engine_, count, 0, start)) {
+            size_ = count;
+            return iterator(this, 0);
+        }
+    }
+    
+    bool on_device = open_gap(pos, count);
+    if (on_device && engine_->copy_device_from(*source.engine_, count, pos, start)) {
+        return iterator(this, pos);
+    }
+    source.engine_->sync_to_host();
+    std::copy_n(source.data_impl() + start, count, data_impl() + pos);
+    if (on_device) engine_->upload_range(pos, pos + count);
+    
+    return iterator(this, pos);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::erase(const_iterator pos) {
+    size_type erase_pos = pos.get_index();
+    detach();
+    engine_->sync_to_host();
+    
+    // Shift elements left
+    std::copy(data_impl() + erase_pos + 1, data_impl() + size_,
+             data_impl() + erase_pos);
+    --size_;
+    engine_->mark_host_dirty(erase_pos, size_);
+    
+    return iterator(this, erase_pos);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::erase(const_iterator first, const_iterator last) {
+    size_type first_pos = first.get_index();
+    size_type last_pos = last.get_index();
+    size_type count = last_pos - first_pos;
+    
+    if (count == 0) return iterator(this, first_pos);
+    
+    detach();
+    engine_->sync_to_host();
+    
+    // Shift elements left
+    std::copy(data_impl() + last_pos, data_impl() + size_,
+             data_impl() + first_pos);
+    size_ -= count;
+    engine_->mark_host_dirty(first_pos, size_);
+    
+    return iterator(this, first_pos);
+}
+
+} // namespace vulkan_stdpar
+
+
+// ========== io/posix_file.hpp ==========
+
+/**
+ * @file posix_file.hpp
+ * @brief Small POSIX file helpers shared by the I/O headers
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains an owning file descriptor, a read-only whole-file
+ * mapping, and positioned read/write loops that retry short transfers and
+ * report failures as io_exception.
+ */
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Largest single pwrite issued by the I/O writers, in bytes
+ */
+#ifndef VULKAN_STDPAR_FILE_WRITE_BYTES
+#define VULKAN_STDPAR_FILE_WRITE_BYTES (size_t(64) * 1024 * 1024)
+#endif
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+namespace detail {
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+inline size_t file_page_size() {
+    static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/**
+ * @brief Write all bytes at offset, retrying short writes
+ */
+inline void pwrite_all(int fd, const void* data, size_t bytes, size_t offset, const std::string& path) {
+    const char* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        size_t chunk = std::min(bytes, VULKAN_STDPAR_FILE_WRITE_BYTES);
+        ssize_t written = ::pwrite(fd, p, chunk, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw io_exception(path, std::strerror(errno));
+        }
+        p += written;
+        offset += static_cast<size_t>(written);
+        bytes -= static_cast<size_t>(written);
+    }
+}
+
+/**
+ * @brief Read all bytes at offset, failing on a short file
+ */
+inline void pread_all(int fd, void* data, size_t bytes, size_t offset, const std::string& path) {
+    char* p = static_cast<char*>(data);
+    while (bytes > 0) {
+        ssize_t got = ::pread(fd, p, bytes, static_cast<off_t>(offset));
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            throw io_exception(path, std::strerror(errno));
+        }
+        if (got == 0) throw io_exception(path, "unexpected end of file");
+        p += got;
+        offset += static_cast<size_t>(got);
+        bytes -= static_cast<size_t>(got);
+    }
+}
+
+/**
+ * @brief File descriptor closed on scope exit
+ */
+class file_handle {
+private:
+    int fd_;
+
+public:
+    explicit file_handle(int fd) : fd_(fd) {}
+    ~file_handle() { if (fd_ >= 0) ::close(fd_); }
+    file_handle(const file_handle&) = delete;
+    file_handle& operator=(const file_handle&) = delete;
+    int get() const noexcept { return fd_; }
+
+    /**
+     * @brief Close now, reporting errors (deferred write failures surface here)
+     */
+    void close(const std::string& path) {
+        int fd = fd_;
+        fd_ = -1;
+        if (::close(fd) != 0) throw io_exception(path, std::strerror(errno));
+    }
+};
+
+/**
+ * @brief Read-only mapping of a whole file, unmapped on scope exit
+ */
+class mapped_file {
+private:
+    const char* data_;
+    size_t size_;
+
+public:
+    /**
+     * @brief Map a file for sequential reading
+     * @param path File to map
+     * @throws io_exception if the file cannot be opened or mapped
+     */
+    explicit mapped_file(const std::string& path) : data_(nullptr), size_(0) {
+        file_handle file(::open(path.c_str(), O_RDONLY));
+        if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+        struct stat info;
+        if (::fstat(file.get(), &info) != 0) throw io_exception(path, std::strerror(errno));
+        size_ = static_cast<size_t>(info.st_size);
+        if (size_ == 0) return;
+
+        void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+        if (ptr == MAP_FAILED) throw io_exception(path, std::strerror(errno));
+        ::madvise(ptr, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(ptr);
+    }
+
+    ~mapped_file() {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const char* data() const noexcept { return data_; }
+    size_t size() const noexcept { return size_; }
+};
+#endif
+
+} // namespace detail
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+
+// ========== io/snapshot.hpp ==========
+
+/**
+ * @file snapshot.hpp
+ * @brief Versioned binary snapshots of unified_vector with zero-copy reload
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains save_snapshot and load_snapshot. A snapshot is a
+ * fixed header followed, at a page-aligned offset, by the raw elements.
+ * Saving writes host data with a few large pwrite calls; loading maps the
+ * payload and adopts the mapping as the vector's host storage, so pages
+ * are read from disk on first use and never copied.
+ */
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+/**
+ * @brief Snapshot format version written by this library
+ */
+constexpr uint32_t snapshot_version = 1;
+
+/**
+ * @brief Element type tag stored in snapshot headers
+ *
+ * Arithmetic types get a tag from their kind and size, so a snapshot of
+ * int32_t is not loaded as float. Other types get 0, which only checks
+ * the element size; specialize this trait to give them a tag.
+ *
+ * @tparam T Element type
+ */
+template<typename T>
+struct snapshot_type_tag {
+    static constexpr uint32_t kind =
+        std::is_same<T, bool>::value ? 4u :
+        std::is_floating_point<T>::value ? 3u :
+        std::is_integral<T>::value && std::is_unsigned<T>::value ? 2u :
+        std::is_integral<T>::value ? 1u : 0u;
+    static constexpr uint32_t value = kind == 0 ? 0u : (kind << 16) | uint32_t(sizeof(T));
+};
+
+/**
+ * @brief On-disk snapshot header (little-endian host layout)
+ */
+struct snapshot_header {
+    char magic[8];              ///< "VKSPSNAP"
+    uint32_t version;           ///< Format version
+    uint32_t byte_order;        ///< 0x01020304 as written by the producer
+    uint64_t payload_offset;    ///< File offset of the first element
+    uint64_t element_count;     ///< Number of elements
+    uint32_t element_size;      ///< sizeof(T)
+    uint32_t type_tag;          ///< snapshot_type_tag<T>::value
+    uint64_t checksum;          ///< Payload checksum (valid if has_checksum)
+    uint32_t has_checksum;      ///< Nonzero if checksum was computed
+    uint32_t reserved[5];       ///< Zero
+
+    snapshot_header()
+        : magic{}, version(0), byte_order(0), payload_offset(0), element_count(0)
+        , element_size(0), type_tag(0), checksum(0), has_checksum(0), reserved{}
+    {}
+};
+
+static_assert(sizeof(snapshot_header) == 72, "snapshot_header layout changed");
+
+/**
+ * @brief Options for save_snapshot
+ */
+struct snapshot_options {
+    bool checksum;          ///< Store a payload checksum
+    bool sync;              ///< fsync before returning
+    size_t alignment;       ///< Payload alignment (0 uses the page size)
+
+    snapshot_options() : checksum(true), sync(false), alignment(0) {}
+};
+
+/**
+ * @brief Options for load_snapshot
+ */
+struct snapshot_load_options {
+    bool verify_checksum;   ///< Check the stored checksum (reads every page once)
+
+    snapshot_load_options() : verify_checksum(true) {}
+};
+
+namespace detail {
+
+constexpr char snapshot_magic[8] = {'V', 'K', 'S', 'P', 'S', 'N', 'A', 'P'};
+constexpr uint32_t snapshot_byte_order = 0x01020304u;
+
+/**
+ * @brief 64-bit FNV-1a over 8-byte words, then trailing bytes
+ *
+ * Word-at-a-time keeps the checksum well above disk bandwidth; it detects
+ * truncation and corruption, not tampering.
+ */
+inline uint64_t snapshot_checksum(const void* data, size_t bytes) {
+    const uint64_t prime = 0x100000001b3ull;
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    size_t words = bytes / 8;
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t word;
+        std::memcpy(&word, p + i * 8, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = words * 8; i < bytes; ++i) {
+        hash = (hash ^ p[i]) * prime;
+    }
+    return hash;
+}
+
+
+} // namespace detail
+
+/**
+ * @brief Read and validate a snapshot header
+ * @param path Snapshot file
+ * @return Header
+ * @throws io_exception if the file cannot be read or is not a valid snapshot
+ */
+inline snapshot_header read_snapshot_header(const std::string& path) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+
+    snapshot_header header;
+    detail::pread_all(file.get(), &header, sizeof(header), 0, path);
+    if (std::memcmp(header.magic, detail::snapshot_magic, sizeof(header.magic)) != 0) {
+        throw io_exception(path, "not a snapshot file");
+    }
+    if (header.version > snapshot_version) {
+        throw io_exception(path, "snapshot version " + std::to_string(header.version) +
+                                 " is newer than supported version " +
+                                 std::to_string(snapshot_version));
+    }
+    if (header.byte_order != detail::snapshot_byte_order) {
+        throw io_exception(path, "snapshot was written with a different byte order");
+    }
+
+    struct stat info;
+    if (::fstat(file.get(), &info) != 0) throw io_exception(path, std::strerror(errno));
+    uint64_t payload = header.element_count * header.element_size;
+    if (header.payload_offset < sizeof(header) ||
+        static_cast<uint64_t>(info.st_size) != header.payload_offset + payload) {
+        throw io_exception(path, "snapshot is truncated or has trailing data");
+    }
+    return header;
+#else
+    (void)path;
+    throw unsupported_operation_exception("read_snapshot_header without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Write a vector to a snapshot file, replacing it
+ *
+ * Device-side modifications are synchronized first. The payload starts at
+ * a page-aligned offset so load_snapshot can map it in place.
+ *
+ * @tparam T Trivially copyable element type
+ * @tparam Alloc Vector allocator
+ * @param vec Vector to save
+ * @param path Output file
+ * @param options Checksum, sync and alignment settings
+ * @throws io_exception on write failure
+ */
+template<typename T, typename Alloc>
+void save_snapshot(const unified_vector<T, Alloc>& vec, const std::string& path,
+                   const snapshot_options& options = snapshot_options()) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Snapshots require trivially copyable elements");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    const T* data = engine.host_data();
+    size_t bytes = vec.size() * sizeof(T);
+
+    size_t alignment = std::max(options.alignment, detail::file_page_size());
+    snapshot_header header;
+    std::memcpy(header.magic, detail::snapshot_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.byte_order = detail::snapshot_byte_order;
+    header.payload_offset = (sizeof(header) + alignment - 1) / alignment * alignment;
+    header.element_count = vec.size();
+    header.element_size = sizeof(T);
+    header.type_tag = snapshot_type_tag<T>::value;
+    if (options.checksum) {
+        header.checksum = detail::snapshot_checksum(data, bytes);
+        header.has_checksum = 1;
+    }
+
+    detail::file_handle file(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+
+    // Header block is zero padded up to the payload
+    std::vector<char> block(header.payload_offset, 0);
+    std::memcpy(block.data(), &header, sizeof(header));
+    detail::pwrite_all(file.get(), block.data(), block.size(), 0, path);
+    detail::pwrite_all(file.get(), data, bytes, header.payload_offset, path);
+
+    if (options.sync && ::fsync(file.get()) != 0) throw io_exception(path, std::strerror(errno));
+    file.close(path);
+#else
+    (void)vec;
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("save_snapshot without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Load a snapshot into a vector backed by the file
+ *
+ * The payload is mapped copy-on-write and adopted as host storage: the
+ * file is never modified and pages are read on first access.
+ *
+ * @tparam T Element type the snapshot was saved with
+ * @param path Snapshot file
+ * @param options Load settings
+ * @return Vector holding the snapshot's elements
+ * @throws io_exception if the file is invalid, of another element type,
+ *         or fails checksum verification
+ */
+template<typename T>
+unified_vector<T> load_snapshot(const std::string& path,
+                                const snapshot_load_options& options = snapshot_load_options()) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Snapshots require trivially copyable elements");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    snapshot_header header = read_snapshot_header(path);
+    if (header.element_size != sizeof(T) ||
+        (header.type_tag != 0 && snapshot_type_tag<T>::value != 0 &&
+         header.type_tag != snapshot_type_tag<T>::value)) {
+        throw io_exception(path, "snapshot element type does not match");
+    }
+
+    if (header.payload_offset % alignof(T) != 0) {
+        throw io_exception(path, "snapshot payload is not aligned for the element type");
+    }
+
+    size_t count = static_cast<size_t>(header.element_count);
+    auto vec = unified_vector<T>::map_file(path, map_mode::read_only,
+                                           static_cast<size_t>(header.payload_offset));
+
+    if (options.verify_checksum && header.has_checksum &&
+        detail::snapshot_checksum(vec.get_engine().host_data(), count * sizeof(T)) != header.checksum) {
+        throw io_exception(path, "snapshot checksum mismatch");
+    }
+    return vec;
+#else
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("load_snapshot without POSIX file I/O");
+#endif
+}
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+
+// ========== io/npy.hpp ==========
+
+/**
+ * @file npy.hpp
+ * @brief NumPy .npy and .npz interchange for unified_vector
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains load_npy, save_npy, load_npz and npz_writer. Loading
+ * parses the array header, checks the dtype against the element type and
+ * maps the payload in place as the vector's host storage, so arrays
+ * written by numpy.save or numpy.savez are usable without a copy. Only
+ * uncompressed archives can be mapped; numpy.savez_compressed output is
+ * rejected.
+ */
+
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+/**
+ * @brief Parsed .npy array header
+ */
+struct npy_header {
+    std::string descr;              ///< dtype string, e.g. "<f4"
+    bool fortran_order;             ///< Column-major layout
+    std::vector<size_t> shape;      ///< Array dimensions (empty for a scalar)
+    size_t data_offset;             ///< Offset of the payload from the start of the array
+
+    npy_header() : fortran_order(false), data_offset(0) {}
+
+    /**
+     * @brief Get the number of elements
+     * @return Product of the dimensions
+     */
+    size_t count() const {
+        size_t n = 1;
+        for (size_t dim : shape) n *= dim;
+        return n;
+    }
+};
+
+/**
+ * @brief Options for load_npy and load_npz
+ */
+struct npy_load_options {
+    bool upload_to_device;  ///< Read ahead and upload before returning
+
+    npy_load_options() : upload_to_device(false) {}
+};
+
+namespace detail {
+
+constexpr char npy_magic[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+inline char npy_native_order() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? '<' : '>';
+}
+
+inline uint32_t read_le(const unsigned char* p, size_t bytes) {
+    uint32_t value = 0;
+    for (size_t i = bytes; i-- > 0;) value = (value << 8) | p[i];
+    return value;
+}
+
+inline uint64_t read_le64(const unsigned char* p) {
+    return uint64_t(read_le(p, 4)) | (uint64_t(read_le(p + 4, 4)) << 32);
+}
+
+inline void put_le(std::vector<unsigned char>& out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+}
+
+/**
+ * @brief Minimal parser for the Python dict literal in a .npy header
+ *
+ * Accepts exactly what numpy writes: string keys, a string descr, a
+ * True/False fortran_order and a tuple of integers for shape. Structured
+ * dtypes (a list for descr) are rejected.
+ */
+class npy_dict_parser {
+private:
+    const std::string& text_;
+    const std::string& path_;
+    size_t pos_;
+
+public:
+    npy_dict_parser(const std::string& text, const std::string& path)
+        : text_(text), path_(path), pos_(0) {}
+
+    npy_header parse() {
+        npy_header header;
+        bool has_descr = false, has_order = false, has_shape = false;
+        expect('{');
+        while (!accept('}')) {
+            std::string key = parse_string();
+            expect(':');
+            if (key == "descr") {
+                header.descr = parse_string();
+                has_descr = true;
+            } else if (key == "fortran_order") {
+                header.fortran_order = parse_bool();
+                has_order = true;
+            } else if (key == "shape") {
+                header.shape = parse_shape();
+                has_shape = true;
+            } else {
+                fail("unexpected key '" + key + "'");
+            }
+            if (!accept(',')) {
+                expect('}');
+                break;
+            }
+        }
+        if (!has_descr || !has_order || !has_shape) fail("header is missing a required key");
+        return header;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& what) const {
+        throw io_exception(path_, "invalid .npy header: " + what);
+    }
+
+    void skip_space() {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t')) ++pos_;
+    }
+
+    bool accept(char c) {
+        skip_space();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!accept(c)) fail(std::string("expected '") + c + "'");
+    }
+
+    std::string parse_string() {
+        skip_space();
+        if (pos_ >= text_.size() || (text_[pos_] != '\'' && text_[pos_] != '"')) fail("expected a string");
+        char quote = text_[pos_++];
+        size_t end = text_.find(quote, pos_);
+        if (end == std::string::npos) fail("unterminated string");
+        std::string value = text_.substr(pos_, end - pos_);
+        pos_ = end + 1;
+        return value;
+    }
+
+    bool parse_bool() {
+        skip_space();
+        if (text_.compare(pos_, 4, "True") == 0) {
+            pos_ += 4;
+            return true;
+        }
+        if (text_.compare(pos_, 5, "False") == 0) {
+            pos_ += 5;
+            return false;
+        }
+        fail("expected True or False");
+    }
+
+    std::vector<size_t> parse_shape() {
+        std::vector<size_t> shape;
+        expect('(');
+        while (!accept(')')) {
+            skip_space();
+            size_t start = pos_;
+            size_t value = 0;
+            while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+                value = value * 10 + static_cast<size_t>(text_[pos_++] - '0');
+            }
+            // numpy 1.x may write long literals such as 3L
+            if (pos_ < text_.size() && text_[pos_] == 'L') ++pos_;
+            if (pos_ == start) fail("expected a dimension");
+            shape.push_back(value);
+            if (!accept(',')) {
+                expect(')');
+                break;
+            }
+        }
+        return shape;
+    }
+};
+
+/**
+ * @brief Parse a .npy header from its leading bytes
+ * @param data Start of the array
+ * @param available Bytes available at data
+ * @param path File name for errors
+ * @return Header, or data_offset > available if more bytes are needed
+ */
+inline npy_header parse_npy_header(const unsigned char* data, size_t available, const std::string& path) {
+    if (available < 10 || std::memcmp(data, npy_magic, sizeof(npy_magic)) != 0) {
+        throw io_exception(path, "not a .npy array");
+    }
+    unsigned major = data[6];
+    if (major < 1 || major > 3) {
+        throw io_exception(path, ".npy format version " + std::to_string(major) + " is not supported");
+    }
+    size_t length_bytes = major == 1 ? 2 : 4;
+    if (available < 8 + length_bytes) throw io_exception(path, "truncated .npy header");
+    size_t dict_start = 8 + length_bytes;
+    size_t header_end = dict_start + read_le(data + 8, length_bytes);
+    if (header_end > available) {
+        npy_header partial;
+        partial.data_offset = header_end;
+        return partial;
+    }
+
+    std::string dict(reinterpret_cast<const char*>(data) + dict_start, header_end - dict_start);
+    while (!dict.empty() && (dict.back() == '\n' || dict.back() == ' ' || dict.back() == '\0')) {
+        dict.pop_back();
+    }
+    npy_header header = npy_dict_parser(dict, path).parse();
+    header.data_offset = header_end;
+    return header;
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the NumPy dtype string for an element type
+ *
+ * Covers bool and the arithmetic types, in native byte order.
+ *
+ * @tparam T Element type
+ * @return dtype string such as "<f4" or "|u1"
+ */
+template<typename T>
+std::string npy_descr() {
+    static_assert(std::is_arithmetic<T>::value, "NumPy interchange requires arithmetic elements");
+    char kind = std::is_same<T, bool>::value ? 'b' :
+                std::is_floating_point<T>::value ? 'f' :
+                std::is_unsigned<T>::value ? 'u' : 'i';
+    char order = sizeof(T) == 1 ? '|' : detail::npy_native_order();
+    return std::string(1, order) + kind + std::to_string(sizeof(T));
+}
+
+namespace detail {
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+/**
+ * @brief Read and parse the .npy header of an array starting at offset
+ */
+inline npy_header read_npy_header_at(int fd, size_t offset, size_t file_bytes, const std::string& path) {
+    std::vector<unsigned char> buffer(std::min<size_t>(4096, file_bytes - std::min(offset, file_bytes)));
+    detail::pread_all(fd, buffer.data(), buffer.size(), offset, path);
+    npy_header header = parse_npy_header(buffer.data(), buffer.size(), path);
+    if (header.data_offset > buffer.size()) {
+        if (header.data_offset > file_bytes - offset) throw io_exception(path, "truncated .npy header");
+        buffer.resize(header.data_offset);
+        detail::pread_all(fd, buffer.data(), buffer.size(), offset, path);
+        header = parse_npy_header(buffer.data(), buffer.size(), path);
+    }
+    return header;
+}
+
+inline size_t file_size(int fd, const std::string& path) {
+    struct stat info;
+    if (::fstat(fd, &info) != 0) throw io_exception(path, std::strerror(errno));
+    return static_cast<size_t>(info.st_size);
+}
+#endif
+
+/**
+ * @brief Check a dtype string against an element type
+ *
+ * The kind and size must match and the byte order must be native or
+ * irrelevant ('|'); byte-swapped arrays cannot be mapped in place.
+ */
+template<typename T>
+void check_npy_dtype(const npy_header& header, const std::string& path) {
+    const std::string& descr = header.descr;
+    std::string expected = npy_descr<T>();
+    bool order_ok = descr.size() >= 2 &&
+        (descr[0] == '|' || descr[0] == '=' || descr[0] == npy_native_order());
+    if (!order_ok || descr.compare(1, std::string::npos, expected, 1, std::string::npos) != 0) {
+        throw io_exception(path, "dtype '" + descr + "' does not match element type '" + expected + "'");
+    }
+    if (header.fortran_order && header.shape.size() > 1) {
+        throw io_exception(path, "Fortran-ordered arrays are not supported");
+    }
+}
+
+/**
+ * @brief Serialize a version 1.0 (or 2.0 if large) .npy header
+ */
+template<typename T>
+std::vector<unsigned char> make_npy_header(const std::vector<size_t>& shape) {
+    std::string dict = "{'descr': '" + npy_descr<T>() + "', 'fortran_order': False, 'shape': (";
+    for (size_t i = 0; i < shape.size(); ++i) {
+        dict += (i > 0 ? ", " : "") + std::to_string(shape[i]);
+    }
+    if (shape.size() == 1) dict += ',';
+    dict += "), }";
+
+    // Pad with spaces and a newline so the payload is 64-byte aligned
+    bool large = dict.size() + 1 + 10 > 65535;
+    size_t preamble = large ? 12 : 10;
+    size_t total = (preamble + dict.size() + 1 + 63) / 64 * 64;
+    dict.append(total - preamble - dict.size() - 1, ' ');
+    dict += '\n';
+
+    std::vector<unsigned char> out(npy_magic, npy_magic + sizeof(npy_magic));
+    out.push_back(large ? 2 : 1);
+    out.push_back(0);
+    put_le(out, dict.size(), large ? 4 : 2);
+    out.insert(out.end(), dict.begin(), dict.end());
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief Read the header of a .npy file
+ * @param path .npy file
+ * @return Parsed header; data_offset is the payload's file offset
+ * @throws io_exception if the file cannot be read or is not a .npy array
+ */
+inline npy_header read_npy_header(const std::string& path) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    return detail::read_npy_header_at(file.get(), 0, detail::file_size(file.get(), path), path);
+#else
+    (void)path;
+    throw unsupported_operation_exception("read_npy_header without POSIX file I/O");
+#endif
+}
+
+namespace detail {
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+/**
+ * @brief Map the array at array_offset of an open file as a vector
+ *
+ * array_bytes bounds the array (header plus payload) so trailing archive
+ * data is not mapped.
+ */
+template<typename T>
+unified_vector<T> map_npy_array(int fd, const std::string& path, size_t array_offset,
+                                size_t array_bytes, const npy_load_options& options) {
+    size_t file_bytes = file_size(fd, path);
+    npy_header header = read_npy_header_at(fd, array_offset, file_bytes, path);
+    check_npy_dtype<T>(header, path);
+
+    size_t payload_offset = array_offset + header.data_offset;
+    size_t payload_bytes = header.count() * sizeof(T);
+    if (header.data_offset + payload_bytes != array_bytes) {
+        throw io_exception(path, "array size does not match its shape");
+    }
+    if (payload_bytes == 0) return unified_vector<T>();
+    if (payload_offset % alignof(T) != 0) {
+        // Cannot map in place (e.g. a numpy.savez entry); read a copy instead
+        unified_vector<T> vec(header.count(), no_init);
+        pread_all(fd, vec.get_engine().host_data(), payload_bytes, payload_offset, path);
+        vec.get_engine().mark_host_dirty(0, vec.size());
+        if (options.upload_to_device) vec.prefetch_to_device();
+        return vec;
+    }
+
+    if (options.upload_to_device) {
+        // Start readahead so the staged upload below overlaps with disk reads
+        ::posix_fadvise(fd, static_cast<off_t>(payload_offset), static_cast<off_t>(payload_bytes),
+                        POSIX_FADV_WILLNEED);
+    }
+    auto vec = unified_vector<T>::map_file(path, map_mode::read_only, payload_offset, payload_bytes);
+    if (options.upload_to_device) vec.prefetch_to_device();
+    return vec;
+}
+#endif
+
+/**
+ * @brief CRC-32 (IEEE) as required by zip entries
+ */
+inline uint32_t crc32_update(uint32_t crc, const void* data, size_t bytes) {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < bytes; ++i) crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+} // namespace detail
+
+/**
+ * @brief Load a .npy file into a vector backed by the file
+ *
+ * The payload is mapped copy-on-write and adopted as host storage, so
+ * pages are read on first access and the file is never modified.
+ * Multi-dimensional arrays load flattened in C order; use
+ * read_npy_header for the shape. With options.upload_to_device the
+ * kernel is asked to read the payload ahead and the vector is uploaded
+ * before returning, staged in slot-sized pieces that overlap with the
+ * remaining reads.
+ *
+ * @tparam T Element type matching the array's dtype
+ * @param path .npy file
+ * @param options Load settings
+ * @return Vector holding the array's elements
+ * @throws io_exception if the file is not a .npy array, its dtype does not
+ *         match T, or it is byte-swapped or Fortran-ordered
+ */
+template<typename T>
+unified_vector<T> load_npy(const std::string& path, const npy_load_options& options = npy_load_options()) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    size_t file_bytes = detail::file_size(file.get(), path);
+    return detail::map_npy_array<T>(file.get(), path, 0, file_bytes, options);
+#else
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("load_npy without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Write a vector to a .npy file, replacing it
+ *
+ * Device-side modifications are synchronized first. The header is padded
+ * so the payload is 64-byte aligned, as numpy does.
+ *
+ * @tparam T Arithmetic element type
+ * @tparam Alloc Vector allocator
+ * @param vec Vector to save
+ * @param path Output file
+ * @param shape Array dimensions (default: one dimension of vec.size())
+ * @throws invalid_argument_exception if shape does not cover vec.size() elements
+ * @throws io_exception on write failure
+ */
+template<typename T, typename Alloc>
+void save_npy(const unified_vector<T, Alloc>& vec, const std::string& path,
+              std::vector<size_t> shape = {}) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    if (shape.empty()) shape.push_back(vec.size());
+    npy_header check;
+    check.shape = shape;
+    if (check.count() != vec.size()) {
+        throw invalid_argument_exception("shape", "element count does not match vector size");
+    }
+
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    std::vector<unsigned char> header = detail::make_npy_header<T>(shape);
+
+    detail::file_handle file(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    detail::pwrite_all(file.get(), header.data(), header.size(), 0, path);
+    detail::pwrite_all(file.get(), engine.host_data(), vec.size() * sizeof(T), header.size(), path);
+    file.close(path);
+#else
+    (void)vec;
+    (void)path;
+    (void)shape;
+    throw unsupported_operation_exception("save_npy without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Writer for uncompressed .npz archives
+ *
+ * Each add() appends one array as "<name>.npy", stored without
+ * compression and padded so its payload is 64-byte aligned, which lets
+ * load_npz map it in place. close() writes the archive directory; an
+ * archive not closed is incomplete. Archives are limited to 4 GiB.
+ */
+class npz_writer {
+private:
+    struct entry {
+        std::string name;       ///< Entry name including ".npy"
+        uint32_t crc;           ///< CRC-32 of the entry data
+        uint32_t bytes;         ///< Entry data size
+        uint32_t offset;        ///< Local header offset
+    };
+
+    std::string path_;
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file_;
+#endif
+    std::vector<entry> entries_;
+    size_t offset_;
+    bool closed_;
+
+    static constexpr uint16_t padding_extra_id = 0xD935;  // zipalign's padding field
+
+public:
+    /**
+     * @brief Create or replace an archive
+     * @param path Output file
+     * @throws io_exception if the file cannot be created
+     */
+    explicit npz_writer(const std::string& path)
+        : path_(path)
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        , file_(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644))
+#endif
+        , offset_(0)
+        , closed_(false)
+    {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (file_.get() < 0) throw io_exception(path, std::strerror(errno));
+#else
+        throw unsupported_operation_exception("npz_writer without POSIX file I/O");
+#endif
+    }
+
+    npz_writer(const npz_writer&) = delete;
+    npz_writer& operator=(const npz_writer&) = delete;
+
+    /**
+     * @brief Finish the archive if close() was not called
+     */
+    ~npz_writer() {
+        if (!closed_) {
+            try {
+                close();
+            } catch (...) {
+            }
+        }
+    }
+
+    /**
+     * @brief Append an array
+     * @tparam T Arithmetic element type
+     * @tparam Alloc Vector allocator
+     * @param name Array name (".npy" is appended)
+     * @param vec Vector to store
+     * @param shape Array dimensions (default: one dimension of vec.size())
+     * @throws invalid_argument_exception if shape does not cover vec.size() elements
+     * @throws io_exception on write failure or if the archive would exceed 4 GiB
+     */
+    template<typename T, typename Alloc>
+    void add(const std::string& name, const unified_vector<T, Alloc>& vec, std::vector<size_t> shape = {}) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (closed_) throw unsupported_operation_exception("add to a closed npz_writer");
+        if (shape.empty()) shape.push_back(vec.size());
+        npy_header check;
+        check.shape = shape;
+        if (check.count() != vec.size()) {
+            throw invalid_argument_exception("shape", "element count does not match vector size");
+        }
+
+        auto& engine = vec.get_engine();
+        engine.sync_to_host();
+        std::vector<unsigned char> header = detail::make_npy_header<T>(shape);
+        size_t payload_bytes = vec.size() * sizeof(T);
+        size_t data_bytes = header.size() + payload_bytes;
+
+        entry e;
+        e.name = name + ".npy";
+        size_t extra = (64 - (offset_ + 30 + e.name.size()) % 64) % 64;
+        if (extra > 0 && extra < 4) extra += 64;
+        size_t data_offset = offset_ + 30 + e.name.size() + extra;
+        if (data_offset + data_bytes > 0xFFFFFFFFu) {
+            throw io_exception(path_, "npz archives above 4 GiB are not supported");
+        }
+        e.crc = detail::crc32_update(0, header.data(), header.size());
+        e.crc = detail::crc32_update(e.crc, engine.host_data(), payload_bytes);
+        e.bytes = static_cast<uint32_t>(data_bytes);
+        e.offset = static_cast<uint32_t>(offset_);
+
+        std::vector<unsigned char> local;
+        detail::put_le(local, 0x04034b50u, 4);     // local file header
+        detail::put_le(local, 20, 2);              // version needed
+        detail::put_le(local, 0, 2);               // flags
+        detail::put_le(local, 0, 2);               // stored
+        detail::put_le(local, 0, 2);               // time
+        detail::put_le(local, 0x21, 2);            // date: 1980-01-01
+        detail::put_le(local, e.crc, 4);
+        detail::put_le(local, e.bytes, 4);         // compressed size
+        detail::put_le(local, e.bytes, 4);         // uncompressed size
+        detail::put_le(local, e.name.size(), 2);
+        detail::put_le(local, extra, 2);
+        local.insert(local.end(), e.name.begin(), e.name.end());
+        if (extra > 0) {
+            detail::put_le(local, padding_extra_id, 2);
+            detail::put_le(local, extra - 4, 2);
+            local.resize(local.size() + extra - 4, 0);
+        }
+        local.insert(local.end(), header.begin(), header.end());
+
+        detail::pwrite_all(file_.get(), local.data(), local.size(), offset_, path_);
+        detail::pwrite_all(file_.get(), engine.host_data(), payload_bytes, offset_ + local.size(), path_);
+        offset_ = data_offset + data_bytes;
+        entries_.push_back(e);
+#else
+        (void)name;
+        (void)vec;
+        (void)shape;
+#endif
+    }
+
+    /**
+     * @brief Write the archive directory and close the file
+     * @throws io_exception on write failure
+     */
+    void close() {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (closed_) return;
+        closed_ = true;
+        std::vector<unsigned char> directory;
+        for (const entry& e : entries_) {
+            detail::put_le(directory, 0x02014b50u, 4);     // central directory header
+            detail::put_le(directory, 20, 2);              // version made by
+            detail::put_le(directory, 20, 2);              // version needed
+            detail::put_le(directory, 0, 2);               // flags
+            detail::put_le(directory, 0, 2);               // stored
+            detail::put_le(directory, 0, 2);               // time
+            detail::put_le(directory, 0x21, 2);            // date
+            detail::put_le(directory, e.crc, 4);
+            detail::put_le(directory, e.bytes, 4);
+            detail::put_le(directory, e.bytes, 4);
+            detail::put_le(directory, e.name.size(), 2);
+            detail::put_le(directory, 0, 2);               // extra
+            detail::put_le(directory, 0, 2);               // comment
+            detail::put_le(directory, 0, 2);               // disk
+            detail::put_le(directory, 0, 2);               // internal attributes
+            detail::put_le(directory, 0, 4);               // external attributes
+            detail::put_le(directory, e.offset, 4);
+            directory.insert(directory.end(), e.name.begin(), e.name.end());
+        }
+        if (offset_ + directory.size() > 0xFFFFFFFFu) {
+            throw io_exception(path_, "npz archives above 4 GiB are not supported");
+        }
+        size_t directory_size = directory.size();
+        detail::put_le(directory, 0x06054b50u, 4);         // end of central directory
+        detail::put_le(directory, 0, 2);
+        detail::put_le(directory, 0, 2);
+        detail::put_le(directory, entries_.size(), 2);
+        detail::put_le(directory, entries_.size(), 2);
+        detail::put_le(directory, directory_size, 4);
+        detail::put_le(directory, offset_, 4);
+        detail::put_le(directory, 0, 2);                   // comment length
+
+        detail::pwrite_all(file_.get(), directory.data(), directory.size(), offset_, path_);
+        file_.close(path_);
+#endif
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Location of one .npz entry
+ */
+struct npz_entry {
+    std::string name;           ///< Entry name as stored
+    uint16_t method;            ///< Compression method (0 = stored)
+    uint64_t bytes;             ///< Uncompressed size
+    uint64_t header_offset;     ///< Local header offset
+};
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+/**
+ * @brief Read the central directory of a zip archive (zip64 aware)
+ */
+inline std::vector<npz_entry> read_npz_directory(int fd, const std::string& path) {
+    size_t file_bytes = file_size(fd, path);
+    size_t tail_bytes = std::min<size_t>(file_bytes, 22 + 65535);
+    std::vector<unsigned char> tail(tail_bytes);
+    pread_all(fd, tail.data(), tail_bytes, file_bytes - tail_bytes, path);
+
+    size_t eocd = tail_bytes;
+    for (size_t i = tail_bytes >= 22 ? tail_bytes - 22 + 1 : 0; i-- > 0;) {
+        if (read_le(tail.data() + i, 4) == 0x06054b50u) {
+            eocd = i;
+            break;
+        }
+    }
+    if (eocd == tail_bytes) throw io_exception(path, "not a zip archive");
+
+    uint64_t count = read_le(tail.data() + eocd + 10, 2);
+    uint64_t directory_size = read_le(tail.data() + eocd + 12, 4);
+    uint64_t directory_offset = read_le(tail.data() + eocd + 16, 4);
+
+    // zip64 end-of-directory locator sits immediately before the classic record
+    if (eocd >= 20 && read_le(tail.data() + eocd - 20, 4) == 0x07064b50u) {
+        unsigned char record[56];
+        pread_all(fd, record, sizeof(record), static_cast<size_t>(read_le64(tail.data() + eocd - 12)), path);
+        if (read_le(record, 4) != 0x06064b50u) throw io_exception(path, "corrupt zip64 directory");
+        count = read_le64(record + 32);
+        directory_size = read_le64(record + 40);
+        directory_offset = read_le64(record + 48);
+    }
+    if (directory_offset + directory_size > file_bytes) throw io_exception(path, "corrupt zip directory");
+
+    std::vector<unsigned char> directory(static_cast<size_t>(directory_size));
+    pread_all(fd, directory.data(), directory.size(), static_cast<size_t>(directory_offset), path);
+
+    std::vector<npz_entry> entries;
+    size_t pos = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        if (pos + 46 > directory.size() || read_le(directory.data() + pos, 4) != 0x02014b50u) {
+            throw io_exception(path, "corrupt zip directory");
+        }
+        const unsigned char* h = directory.data() + pos;
+        size_t name_bytes = read_le(h + 28, 2);
+        size_t extra_bytes = read_le(h + 30, 2);
+        size_t comment_bytes = read_le(h + 32, 2);
+        if (pos + 46 + name_bytes + extra_bytes + comment_bytes > directory.size()) {
+            throw io_exception(path, "corrupt zip directory");
+        }
+
+        npz_entry e;
+        e.name.assign(reinterpret_cast<const char*>(h + 46), name_bytes);
+        e.method = static_cast<uint16_t>(read_le(h + 10, 2));
+        e.bytes = read_le(h + 24, 4);
+        uint64_t compressed = read_le(h + 20, 4);
+        e.header_offset = read_le(h + 42, 4);
+
+        // zip64 extra field holds the sizes and offset that overflowed, in order
+        const unsigned char* extra = h + 46 + name_bytes;
+        for (size_t x = 0; x + 4 <= extra_bytes;) {
+            size_t id = read_le(extra + x, 2);
+            size_t len = read_le(extra + x + 2, 2);
+            if (id == 0x0001) {
+                const unsigned char* field = extra + x + 4;
+                const unsigned char* field_end = field + std::min(len, extra_bytes - x - 4);
+                if (e.bytes == 0xFFFFFFFFu && field + 8 <= field_end) {
+                    e.bytes = read_le64(field);
+                    field += 8;
+                }
+                if (compressed == 0xFFFFFFFFu && field + 8 <= field_end) field += 8;
+                if (e.header_offset == 0xFFFFFFFFu && field + 8 <= field_end) {
+                    e.header_offset = read_le64(field);
+                }
+            }
+            x += 4 + len;
+        }
+        entries.push_back(e);
+        pos += 46 + name_bytes + extra_bytes + comment_bytes;
+    }
+    return entries;
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief List the arrays in an .npz archive
+ * @param path .npz file
+ * @return Array names without the ".npy" suffix
+ * @throws io_exception if the file is not a zip archive
+ */
+inline std::vector<std::string> npz_names(const std::string& path) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    std::vector<std::string> names;
+    for (const auto& e : detail::read_npz_directory(file.get(), path)) {
+        std::string name = e.name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".npy") == 0) name.resize(name.size() - 4);
+        names.push_back(name);
+    }
+    return names;
+#else
+    (void)path;
+    throw unsupported_operation_exception("npz_names without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Load one array of an uncompressed .npz archive
+ *
+ * The entry's payload is mapped in place like load_npy. numpy.savez
+ * stores entries without aligning them, so a payload misaligned for T is
+ * read into ordinary memory instead; npz_writer aligns every entry.
+ *
+ * @tparam T Element type matching the array's dtype
+ * @param path .npz file
+ * @param name Array name, with or without ".npy"
+ * @param options Load settings
+ * @return Vector holding the array's elements
+ * @throws io_exception if the array is missing, compressed or of another dtype
+ */
+template<typename T>
+unified_vector<T> load_npz(const std::string& path, const std::string& name,
+                           const npy_load_options& options = npy_load_options()) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+
+    for (const auto& e : detail::read_npz_directory(file.get(), path)) {
+        if (e.name != name && e.name != name + ".npy") continue;
+        if (e.method != 0) {
+            throw io_exception(path, "array '" + name + "' is compressed and cannot be mapped");
+        }
+        unsigned char local[30];
+        detail::pread_all(file.get(), local, sizeof(local), static_cast<size_t>(e.header_offset), path);
+        if (detail::read_le(local, 4) != 0x04034b50u) throw io_exception(path, "corrupt zip entry");
+        size_t data_offset = static_cast<size_t>(e.header_offset) + 30 +
+                             detail::read_le(local + 26, 2) + detail::read_le(local + 28, 2);
+        return detail::map_npy_array<T>(file.get(), path, data_offset, static_cast<size_t>(e.bytes), options);
+    }
+    throw io_exception(path, "no array named '" + name + "'");
+#else
+    (void)path;
+    (void)name;
+    (void)options;
+    throw unsupported_operation_exception("load_npz without POSIX file I/O");
+#endif
+}
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+
+// ========== io/csv.hpp ==========
+
+/**
+ * @file csv.hpp
+ * @brief Parallel ingestion of delimited text into numeric columns
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains read_columns, which maps a CSV (or other delimited
+ * text) file, splits it into chunks at record boundaries and parses the
+ * selected fields on the host thread pool straight into pre-sized
+ * unified_vector columns.
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Smallest piece of text parsed by one task, in bytes
+ */
+#ifndef VULKAN_STDPAR_CSV_CHUNK_BYTES
+#define VULKAN_STDPAR_CSV_CHUNK_BYTES (size_t(1) * 1024 * 1024)
+#endif
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+/**
+ * @brief Options for read_columns
+ */
+struct csv_options {
+    char delimiter;                 ///< Field separator
+    bool header;                    ///< Skip the first line
+    std::vector<size_t> columns;    ///< Field index for each output column (default 0, 1, ...)
+
+    csv_options() : delimiter(','), header(false) {}
+};
+
+namespace detail {
+
+/**
+ * @brief Call fn(first, last) for each non-blank line in [begin, end)
+ *
+ * Lines are found with memchr, which the C library vectorizes. A trailing
+ * carriage return is stripped.
+ */
+template<typename Fn>
+void for_each_record(const char* begin, const char* end, Fn&& fn) {
+    while (begin < end) {
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', size_t(end - begin)));
+        const char* line_end = newline ? newline : end;
+        const char* last = line_end;
+        if (last > begin && last[-1] == '\r') --last;
+        if (last > begin) fn(begin, last);
+        begin = newline ? newline + 1 : end;
     }
-    
-    difference_type operator-(const const_unified_iterator& other) const {
-        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+}
+
+/**
+ * @brief Parse one field into column[row]
+ * @return False if the field is not a number of type T
+ */
+template<typename T>
+bool parse_field(const char* first, const char* last, void* column, size_t row) {
+    while (first < last && (*first == ' ' || *first == '\t')) ++first;
+    while (last > first && (last[-1] == ' ' || last[-1] == '\t')) --last;
+    if (last - first >= 2 && *first == '"' && last[-1] == '"') {
+        ++first;
+        --last;
+    }
+    T& out = static_cast<T*>(column)[row];
+    if (first == last) {
+        // Missing values become NaN in floating-point columns
+        if constexpr (std::is_floating_point<T>::value) {
+            out = std::numeric_limits<T>::quiet_NaN();
+            return true;
+        }
+        return false;
     }
-    
-    // ==================== Comparison ====================
-    
-    bool operator==(const const_unified_iterator& other) const {
-        return container_ == other.container_ && index_ == other.index_;
+    if (*first == '+' && last - first > 1 && first[1] != '-') ++first;
+    auto result = std::from_chars(first, last, out);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+using field_parser = bool (*)(const char*, const char*, void*, size_t);
+
+/**
+ * @brief Parse the records in [begin, end) starting at output row
+ */
+template<size_t N>
+void parse_records(const char* begin, const char* end, size_t row, char delimiter,
+                   const std::vector<int>& field_to_column,
+                   const std::array<field_parser, N>& parsers,
+                   const std::array<void*, N>& columns, const std::string& path) {
+    for_each_record(begin, end, [&](const char* first, const char* last) {
+        size_t parsed = 0;
+        size_t field = 0;
+        const char* pos = first;
+        while (parsed < N) {
+            const char* next = static_cast<const char*>(std::memchr(pos, delimiter, size_t(last - pos)));
+            const char* field_end = next ? next : last;
+            int column = field_to_column[field];
+            if (column >= 0) {
+                if (!parsers[column](pos, field_end, columns[column], row)) {
+                    throw io_exception(path, "record " + std::to_string(row + 1) + ", field " +
+                                             std::to_string(field) + ": cannot parse '" +
+                                             std::string(pos, field_end) + "'");
+                }
+                ++parsed;
+            }
+            ++field;
+            if (parsed < N && !next) {
+                throw io_exception(path, "record " + std::to_string(row + 1) + " has too few fields");
+            }
+            pos = next ? next + 1 : last;
+        }
+        ++row;
+    });
+}
+
+} // namespace detail
+
+/**
+ * @brief Read numeric columns from a delimited text file
+ *
+ * The file is mapped and cut into chunks that end on line boundaries.
+ * The host thread pool counts the records in every chunk, the columns are
+ * sized once, and a second parallel pass parses each chunk's fields with
+ * std::from_chars into bulk host views at the chunk's row offset. Blank
+ * lines are skipped, surrounding spaces and double quotes are ignored,
+ * and empty fields read as NaN in floating-point columns. Quoted fields
+ * containing delimiters or newlines are not supported.
+ *
+ * @code
+ * io::csv_options opts;
+ * opts.header = true;
+ * opts.columns = {0, 3};       // fields 0 and 3
+ * auto [time, value] = io::read_columns<double, float>("trace.csv", opts);
+ * @endcode
+ *
+ * @tparam Ts Arithmetic element type of each output column
+ * @param path Text file
+ * @param options Delimiter, header and column selection
+ * @return Tuple of one vector per output column
+ * @throws invalid_argument_exception if options.columns does not name one field per column
+ * @throws io_exception if the file cannot be read or a field does not parse
+ */
+template<typename... Ts>
+std::tuple<unified_vector<Ts>...> read_columns(const std::string& path,
+                                               const csv_options& options = csv_options()) {
+    constexpr size_t N = sizeof...(Ts);
+    static_assert(N > 0, "read_columns needs at least one column type");
+    static_assert(((std::is_arithmetic<Ts>::value && !std::is_same<Ts, bool>::value) && ...),
+                  "read_columns parses arithmetic columns");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    std::vector<size_t> fields = options.columns;
+    if (fields.empty()) {
+        for (size_t i = 0; i < N; ++i) fields.push_back(i);
+    }
+    if (fields.size() != N) {
+        throw invalid_argument_exception("columns", "must name one field per output column");
+    }
+    std::vector<int> field_to_column(*std::max_element(fields.begin(), fields.end()) + 1, -1);
+    for (size_t i = 0; i < N; ++i) {
+        if (field_to_column[fields[i]] >= 0) {
+            throw invalid_argument_exception("columns", "field listed twice");
+        }
+        field_to_column[fields[i]] = static_cast<int>(i);
+    }
+
+    detail::mapped_file file(path);
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    if (options.header && begin < end) {
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', file.size()));
+        begin = newline ? newline + 1 : end;
+    }
+
+    // Chunk boundaries moved forward to the next line start
+    auto& pool = host::get_thread_pool();
+    size_t bytes = size_t(end - begin);
+    size_t chunks = std::max<size_t>(1, std::min(bytes / VULKAN_STDPAR_CSV_CHUNK_BYTES,
+                                                 pool.concurrency() * 4));
+    std::vector<const char*> bounds(chunks + 1, end);
+    bounds[0] = begin;
+    for (size_t i = 1; i < chunks; ++i) {
+        const char* pos = std::max(begin + bytes * i / chunks, bounds[i - 1]);
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', size_t(end - pos)));
+        bounds[i] = newline ? newline + 1 : end;
+    }
+
+    std::vector<size_t> rows(chunks + 1, 0);
+    pool.parallel_for(chunks, 1, [&](size_t first, size_t last) {
+        for (size_t c = first; c < last; ++c) {
+            size_t count = 0;
+            detail::for_each_record(bounds[c], bounds[c + 1], [&](const char*, const char*) { ++count; });
+            rows[c + 1] = count;
+        }
+    });
+    for (size_t c = 0; c < chunks; ++c) rows[c + 1] += rows[c];
+
+    std::tuple<unified_vector<Ts>...> result(unified_vector<Ts>(rows[chunks], no_init)...);
+    {
+        std::tuple<host_view<Ts>...> views = std::apply([](auto&... column) {
+            return std::tuple<host_view<Ts>...>(host_view<Ts>(column, access::write)...);
+        }, result);
+        std::array<void*, N> columns = std::apply([](auto&... view) {
+            return std::array<void*, N>{static_cast<void*>(view.data())...};
+        }, views);
+        const std::array<detail::field_parser, N> parsers = {&detail::parse_field<Ts>...};
+
+        pool.parallel_for(chunks, 1, [&](size_t first, size_t last) {
+            for (size_t c = first; c < last; ++c) {
+                detail::parse_records(bounds[c], bounds[c + 1], rows[c], options.delimiter,
+                                      field_to_column, parsers, columns, path);
+            }
+        });
     }
-    
-    bool operator!=(const const_unified_iterator& other) const {
-        return !(*this == other);
+    return result;
+#else
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("read_columns without POSIX file I/O");
+#endif
+}
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+
+// ========== algorithms/std_overloads.hpp ==========
+
+/**
+ * @file std_overloads.hpp
+ * @brief Pointer-unwrapping overloads of common std algorithms for unified_vector iterators
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * Calling std::sort, std::accumulate, std::copy, std::fill, std::find,
+ * std::count or std::equal without an execution policy on unified_vector
+ * iterators would otherwise go through unified_reference proxies, taking the
+ * engine lock on every element. The overloads in this file synchronize the
+ * range once, run on raw host pointers, and use the host thread pool above
+ * VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD elements.
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Trait identifying unified_vector iterators
+ */
+template<typename It>
+struct is_unified_iterator : std::false_type {};
+
+template<typename T, typename Alloc>
+struct is_unified_iterator<unified_iterator<T, Alloc>> : std::true_type {};
+
+template<typename T, typename Alloc>
+struct is_unified_iterator<const_unified_iterator<T, Alloc>> : std::true_type {};
+
+namespace detail {
+
+// ==================== Range Unwrapping ====================
+
+/**
+ * @brief Open a read-only host view over [first, last)
+ */
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(const_unified_iterator<T, Alloc> first, const_unified_iterator<T, Alloc> last) {
+    return host_view<const T, Alloc>(*first.get_container(), access::read, first.get_index(), last.get_index());
+}
+
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(unified_iterator<T, Alloc> first, unified_iterator<T, Alloc> last) {
+    const unified_vector<T, Alloc>& container = *first.get_container();
+    return host_view<const T, Alloc>(container, access::read, first.get_index(), last.get_index());
+}
+
+/**
+ * @brief Open a writable host view over [first, last)
+ */
+template<typename T, typename Alloc>
+host_view<T, Alloc> write_view(unified_iterator<T, Alloc> first, unified_iterator<T, Alloc> last, access mode) {
+    return host_view<T, Alloc>(*first.get_container(), mode, first.get_index(), last.get_index());
+}
+
+// ==================== Parallel Host Kernels ====================
+
+template<typename T, typename Compare>
+void host_sort(T* first, T* last, Compare comp) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        std::sort(first, last, comp);
+        return;
     }
-    
-    bool operator<(const const_unified_iterator& other) const {
-        return index_ < other.index_;
+
+    // Sort independent runs in parallel, then merge neighbouring runs pairwise
+    auto& pool = host::get_thread_pool();
+    size_t runs = pool.concurrency();
+    std::vector<size_t> bounds(runs + 1);
+    for (size_t i = 0; i <= runs; ++i) {
+        bounds[i] = n * i / runs;
     }
-    
-    bool operator<=(const const_unified_iterator& other) const {
-        return index_ <= other.index_;
+    pool.parallel_for(runs, 1, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r) {
+            std::sort(first + bounds[r], first + bounds[r + 1], comp);
+        }
+    });
+
+    for (size_t width = 1; width < runs; width *= 2) {
+        size_t merges = (runs + 2 * width - 1) / (2 * width);
+        pool.parallel_for(merges, 1, [&](size_t begin, size_t end) {
+            for (size_t m = begin; m < end; ++m) {
+                size_t lo = m * 2 * width;
+                size_t mid = std::min(lo + width, runs);
+                size_t hi = std::min(lo + 2 * width, runs);
+                if (mid < hi) {
+                    std::inplace_merge(first + bounds[lo], first + bounds[mid], first + bounds[hi], comp);
+                }
+            }
+        });
     }
-    
-    bool operator>(const const_unified_iterator& other) const {
-        return index_ > other.index_;
+}
+
+template<typename T, typename V>
+void host_fill(T* first, T* last, const V& value) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        std::fill(first, last, value);
+        return;
     }
-    
-    bool operator>=(const const_unified_iterator& other) const {
-        return index_ >= other.index_;
+    host::parallel_for(n, [&](size_t begin, size_t end) {
+        std::fill(first + begin, first + end, value);
+    });
+}
+
+/**
+ * @brief Check whether two pointer ranges share any byte
+ */
+template<typename T, typename U>
+bool ranges_overlap(const T* first, size_t n, const U* d_first) {
+    std::less<const void*> before;
+    const void* src_begin = first;
+    const void* src_end = first + n;
+    const void* dst_begin = d_first;
+    const void* dst_end = d_first + n;
+    return before(src_begin, dst_end) && before(dst_begin, src_end);
+}
+
+/**
+ * @brief Copy [first, last) to d_first
+ *
+ * Pointer destinations are filled in parallel chunks unless they overlap
+ * the source, e.g. when shifting elements within one vector. Overlapping
+ * ranges are copied sequentially in the direction that reads every element
+ * before it is overwritten.
+ */
+template<typename T, typename OutputIt>
+OutputIt host_copy(const T* first, const T* last, OutputIt d_first) {
+    size_t n = static_cast<size_t>(last - first);
+    if constexpr (std::is_pointer<OutputIt>::value) {
+        if (n > 0 && ranges_overlap(first, n, d_first)) {
+            using out_type = std::remove_pointer_t<OutputIt>;
+            if constexpr (std::is_same<std::remove_cv_t<out_type>, T>::value &&
+                          std::is_trivially_copyable<T>::value) {
+                std::memmove(d_first, first, n * sizeof(T));
+                return d_first + n;
+            } else {
+                if (std::less<const void*>()(first, d_first)) {
+                    return std::copy_backward(first, last, d_first + n) + n;
+                }
+                return std::copy(first, last, d_first);
+            }
+        }
+        if (host::should_parallelize(n)) {
+            host::parallel_for(n, [&](size_t begin, size_t end) {
+                std::copy(first + begin, first + end, d_first + begin);
+            });
+            return d_first + n;
+        }
     }
-    
-    size_t get_index() const {
-        return index_;
+    return std::copy(first, last, d_first);
+}
+
+template<typename T, typename V>
+const T* host_find(const T* first, const T* last, const V& value) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        return std::find(first, last, value);
+    }
+
+    // Chunks after the best match found so far skip their search
+    std::atomic<size_t> best(n);
+    host::parallel_for(n, [&](size_t begin, size_t end) {
+        if (begin >= best.load(std::memory_order_relaxed)) return;
+        const T* hit = std::find(first + begin, first + end, value);
+        size_t index = static_cast<size_t>(hit - first);
+        if (hit != first + end) {
+            size_t current = best.load(std::memory_order_relaxed);
+            while (index < current &&
+                   !best.compare_exchange_weak(current, index, std::memory_order_relaxed)) {}
+        }
+    });
+    return first + best.load();
+}
+
+template<typename T, typename V>
+ptrdiff_t host_count(const T* first, const T* last, const V& value) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        return std::count(first, last, value);
+    }
+    std::atomic<ptrdiff_t> total(0);
+    host::parallel_for(n, [&](size_t begin, size_t end) {
+        total.fetch_add(std::count(first + begin, first + end, value), std::memory_order_relaxed);
+    });
+    return total.load();
+}
+
+template<typename T, typename InputIt2>
+bool host_equal(const T* first1, const T* last1, InputIt2 first2) {
+    size_t n = static_cast<size_t>(last1 - first1);
+    if constexpr (std::is_pointer<InputIt2>::value) {
+        if (host::should_parallelize(n)) {
+            std::atomic<bool> equal(true);
+            host::parallel_for(n, [&](size_t begin, size_t end) {
+                if (!equal.load(std::memory_order_relaxed)) return;
+                if (!std::equal(first1 + begin, first1 + end, first2 + begin)) {
+                    equal.store(false, std::memory_order_relaxed);
+                }
+            });
+            return equal.load();
+        }
     }
-    
-    const unified_vector<T>* get_container() const {
-        return container_;
+    return std::equal(first1, last1, first2);
+}
+
+/**
+ * @brief Accumulate with the default operator
+ *
+ * Integral sums are reassociated across chunks; other types keep the
+ * strict left-to-right order std::accumulate guarantees.
+ */
+template<typename T, typename Init>
+Init host_accumulate(const T* first, const T* last, Init init) {
+    size_t n = static_cast<size_t>(last - first);
+    if constexpr (std::is_integral<T>::value && std::is_integral<Init>::value &&
+                  !std::is_same<Init, bool>::value) {
+        if (host::should_parallelize(n)) {
+            std::atomic<Init> total{Init()};
+            host::parallel_for(n, [&](size_t begin, size_t end) {
+                total.fetch_add(std::accumulate(first + begin, first + end, Init()),
+                                std::memory_order_relaxed);
+            });
+            return init + total.load();
+        }
     }
-};
+    return std::accumulate(first, last, init);
+}
 
-// ==================== Non-member Operators ====================
+// ==================== Output Unwrapping ====================
 
 /**
- * @brief Add offset to iterator (reversed operands)
+ * @brief Access mode for a destination that may lie in the source's vector
+ *
+ * A write-only view need not preserve its range, so a destination in the
+ * vector being read is opened read_write.
  */
-template<typename T>
-unified_iterator<T> operator+(typename unified_iterator<T>::difference_type n, 
-                              const unified_iterator<T>& it) {
-    return it + n;
+template<typename It, typename U, typename OutAlloc>
+access output_access(It first, unified_iterator<U, OutAlloc> d_first) {
+    const void* source = first.get_container();
+    const void* destination = d_first.get_container();
+    return source == destination ? access::read_write : access::write;
 }
 
 /**
- * @brief Add offset to const iterator (reversed operands)
+ * @brief Copy a raw host range into a unified_vector at d_first
+ *
+ * The source may overlap the destination; see host_copy().
  */
-template<typename T>
-const_unified_iterator<T> operator+(typename const_unified_iterator<T>::difference_type n,
-                                    const const_unified_iterator<T>& it) {
-    return it + n;
+template<typename T, typename U, typename OutAlloc>
+unified_iterator<U, OutAlloc> copy_into(const T* first, const T* last, unified_iterator<U, OutAlloc> d_first,
+                                        access mode = access::write) {
+    size_t n = static_cast<size_t>(last - first);
+    if (n == 0) return d_first;
+    auto out = write_view(d_first, d_first + n, mode);
+    host_copy(first, last, out.data());
+    return d_first + n;
+}
+
+/**
+ * @brief Compare a raw host range against any second range
+ */
+template<typename T, typename Alloc, typename InputIt2>
+bool equal_to(const host_view<const T, Alloc>& view, InputIt2 first2) {
+    if constexpr (is_unified_iterator<InputIt2>::value) {
+        if (view.empty()) return true;
+        auto other = read_view(first2, first2 + static_cast<ptrdiff_t>(view.size()));
+        return host_equal(view.begin(), view.end(), other.data());
+    } else {
+        return host_equal(view.begin(), view.end(), first2);
+    }
 }
 
+} // namespace detail
+
 } // namespace vulkan_stdpar
 
-// Implementation of unified_vector iterator member functions
-namespace vulkan_stdpar {
+// Inject into std namespace so policy-less calls on unified_vector
+// iterators resolve to these more specialized overloads
+namespace std {
 
-template<typename T>
-typename unified_vector<T>::iterator unified_vector<T>::begin() noexcept {
-    return iterator(this, 0);
+// ==================== sort ====================
+
+template<typename T, typename Alloc>
+void sort(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last) {
+    if (last - first <= 1) return;
+    auto view = vulkan_stdpar::detail::write_view(first, last, vulkan_stdpar::access::read_write);
+    vulkan_stdpar::detail::host_sort(view.begin(), view.end(), std::less<T>());
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::begin() const noexcept {
-    return const_iterator(this, 0);
+template<typename T, typename Alloc, typename Compare>
+void sort(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+          Compare comp) {
+    if (last - first <= 1) return;
+    auto view = vulkan_stdpar::detail::write_view(first, last, vulkan_stdpar::access::read_write);
+    vulkan_stdpar::detail::host_sort(view.begin(), view.end(), comp);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::cbegin() const noexcept {
-    return const_iterator(this, 0);
+// ==================== accumulate ====================
+
+template<typename T, typename Alloc, typename Init>
+Init accumulate(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                vulkan_stdpar::const_unified_iterator<T, Alloc> last, Init init) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_accumulate(view.begin(), view.end(), init);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator unified_vector<T>::end() noexcept {
-    return iterator(this, size_);
+template<typename T, typename Alloc, typename Init>
+Init accumulate(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                vulkan_stdpar::unified_iterator<T, Alloc> last, Init init) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_accumulate(view.begin(), view.end(), init);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::end() const noexcept {
-    return const_iterator(this, size_);
+template<typename T, typename Alloc, typename Init, typename BinaryOp>
+Init accumulate(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                vulkan_stdpar::const_unified_iterator<T, Alloc> last, Init init, BinaryOp op) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return std::accumulate(view.begin(), view.end(), std::move(init), op);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::cend() const noexcept {
-    return const_iterator(this, size_);
+template<typename T, typename Alloc, typename Init, typename BinaryOp>
+Init accumulate(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                vulkan_stdpar::unified_iterator<T, Alloc> last, Init init, BinaryOp op) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return std::accumulate(view.begin(), view.end(), std::move(init), op);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::insert(const_iterator pos, const T& value) {
-    size_type insert_pos = pos.get_index();
-    if (size_ >= capacity()) {
-        reserve(capacity() == 0 ? 1 : capacity() * 2);
-    }
-    
-    // Shift elements right
-    engine_.sync_to_host();
-    std::copy_backward(data_impl() + insert_pos, data_impl() + size_, 
-                      data_impl() + size_ + 1);
-    data_impl()[insert_pos] = value;
-    engine_.mark_host_dirty(insert_pos, size_ + 1);
-    ++size_;
-    
-    return iterator(this, insert_pos);
+// ==================== fill ====================
+
+template<typename T, typename Alloc, typename V>
+void fill(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+          const V& value) {
+    if (first == last) return;
+    auto view = vulkan_stdpar::detail::write_view(first, last, vulkan_stdpar::access::write);
+    vulkan_stdpar::detail::host_fill(view.begin(), view.end(), value);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::insert(const_iterator pos, T&& value) {
-    size_type insert_pos = pos.get_index();
-    if (size_ >= capacity()) {
-        reserve(capacity() == 0 ? 1 : capacity() * 2);
-    }
-    
-    // Shift elements right
-    engine_.sync_to_host();
-    std::copy_backward(data_impl() + insert_pos, data_impl() + size_,
-                      data_impl() + size_ + 1);
-    data_impl()[insert_pos] = std::move(value);
-    engine_.mark_host_dirty(insert_pos, size_ + 1);
-    ++size_;
-    
-    return iterator(this, insert_pos);
+// ==================== find ====================
+
+template<typename T, typename Alloc, typename V>
+vulkan_stdpar::unified_iterator<T, Alloc> find(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                                        vulkan_stdpar::unified_iterator<T, Alloc> last, const V& value) {
+    if (first == last) return last;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return first + (vulkan_stdpar::detail::host_find(view.begin(), view.end(), value) - view.begin());
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::erase(const_iterator pos) {
-    size_type erase_pos = pos.get_index();
-    engine_.sync_to_host();
-    
-    // Shift elements left
-    std::copy(data_impl() + erase_pos + 1, data_impl() + size_,
-             data_impl() + erase_pos);
-    --size_;
-    engine_.mark_host_dirty(erase_pos, size_);
-    
-    return iterator(this, erase_pos);
+template<typename T, typename Alloc, typename V>
+vulkan_stdpar::const_unified_iterator<T, Alloc> find(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                                              vulkan_stdpar::const_unified_iterator<T, Alloc> last,
+                                              const V& value) {
+    if (first == last) return last;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return first + (vulkan_stdpar::detail::host_find(view.begin(), view.end(), value) - view.begin());
+}
+
+// ==================== count ====================
+
+template<typename T, typename Alloc, typename V>
+ptrdiff_t count(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+                const V& value) {
+    if (first == last) return 0;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_count(view.begin(), view.end(), value);
+}
+
+template<typename T, typename Alloc, typename V>
+ptrdiff_t count(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                vulkan_stdpar::const_unified_iterator<T, Alloc> last, const V& value) {
+    if (first == last) return 0;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_count(view.begin(), view.end(), value);
+}
+
+// ==================== equal ====================
+
+template<typename T, typename Alloc, typename InputIt2>
+bool equal(vulkan_stdpar::unified_iterator<T, Alloc> first1, vulkan_stdpar::unified_iterator<T, Alloc> last1,
+           InputIt2 first2) {
+    if (first1 == last1) return true;
+    auto view = vulkan_stdpar::detail::read_view(first1, last1);
+    return vulkan_stdpar::detail::equal_to(view, first2);
+}
+
+template<typename T, typename Alloc, typename InputIt2>
+bool equal(vulkan_stdpar::const_unified_iterator<T, Alloc> first1,
+           vulkan_stdpar::const_unified_iterator<T, Alloc> last1, InputIt2 first2) {
+    if (first1 == last1) return true;
+    auto view = vulkan_stdpar::detail::read_view(first1, last1);
+    return vulkan_stdpar::detail::equal_to(view, first2);
+}
+
+// ==================== copy ====================
+
+template<typename T, typename Alloc, typename OutputIt>
+OutputIt copy(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+              OutputIt d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_copy(view.begin(), view.end(), d_first);
+}
+
+template<typename T, typename Alloc, typename OutputIt>
+OutputIt copy(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+              vulkan_stdpar::const_unified_iterator<T, Alloc> last, OutputIt d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_copy(view.begin(), view.end(), d_first);
+}
+
+template<typename T, typename Alloc, typename U, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> copy(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                                        vulkan_stdpar::unified_iterator<T, Alloc> last,
+                                        vulkan_stdpar::unified_iterator<U, OutAlloc> d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::copy_into(view.begin(), view.end(), d_first,
+                                            vulkan_stdpar::detail::output_access(first, d_first));
+}
+
+template<typename T, typename Alloc, typename U, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> copy(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                                        vulkan_stdpar::const_unified_iterator<T, Alloc> last,
+                                        vulkan_stdpar::unified_iterator<U, OutAlloc> d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::copy_into(view.begin(), view.end(), d_first,
+                                            vulkan_stdpar::detail::output_access(first, d_first));
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::erase(const_iterator first, const_iterator last) {
-    size_type first_pos = first.get_index();
-    size_type last_pos = last.get_index();
-    size_type count = last_pos - first_pos;
-    
-    if (count == 0) return iterator(this, first_pos);
-    
-    engine_.sync_to_host();
-    
-    // Shift elements left
-    std::copy(data_impl() + last_pos, data_impl() + size_,
-             data_impl() + first_pos);
-    size_ -= count;
-    engine_.mark_host_dirty(first_pos, size_);
-    
-    return iterator(this, first_pos);
+template<typename InputIt, typename U, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> copy(InputIt first, InputIt last,
+                                        vulkan_stdpar::unified_iterator<U, OutAlloc> d_first) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_pointer<InputIt>::value) {
+        return vulkan_stdpar::detail::copy_into(first, last, d_first);
+    } else if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+        auto n = std::distance(first, last);
+        if (n <= 0) return d_first;
+        auto out = vulkan_stdpar::detail::write_view(d_first, d_first + n, vulkan_stdpar::access::write);
+        std::copy(first, last, out.data());
+        return d_first + n;
+    } else {
+        // Single-pass input: length unknown up front, write through proxies
+        for (; first != last; ++first, ++d_first) {
+            *d_first = *first;
+        }
+        return d_first;
+    }
 }
 
-} // namespace vulkan_stdpar
+} // namespace std
 
 
 // ========== algorithms/parallel_invoker.hpp ==========
@@ -2910,7 +10317,16 @@ unified_vector<T>::erase(const_iterator first, const_iterator last) {
 #include <type_traits>
 
 #ifdef VULKAN_STDPAR_USE_SYCL
+#include <optional>
 #include <sycl/sycl.hpp>
+#endif
+
+/**
+ * @brief Upper bound on one streaming chunk in bytes
+ */
+#ifndef VULKAN_STDPAR_STREAM_CHUNK_BYTES
+#define VULKAN_STDPAR_STREAM_CHUNK_BYTES (size_t(64) * 1024 * 1024)
+#endif
 
 namespace vulkan_stdpar {
 
@@ -2974,9 +10390,257 @@ namespace detail {
 
 #ifdef VULKAN_STDPAR_USE_SYCL
 
+/**
+ * @brief Get the device bytes an algorithm may use on a queue
+ * @param q Execution queue
+ * @return Smaller of device memory and the residency budget
+ */
+inline size_t device_memory_limit(sycl::queue& q) {
+    size_t limit = q.get_device().get_info<sycl::info::device::global_mem_size>();
+    size_t budget = memory::residency_manager::instance().budget();
+    return budget != 0 ? std::min(limit, budget) : limit;
+}
+
+/**
+ * @brief Choose a streaming chunk size for an out-of-core range
+ * @param q Execution queue
+ * @param count Number of elements
+ * @param element_bytes Device bytes per element across all buffers involved
+ * @return Elements per chunk, or 0 if the range fits on the device
+ */
+inline size_t stream_chunk_size(sycl::queue& q, size_t count, size_t element_bytes) {
+    size_t limit = device_memory_limit(q);
+    if (count * element_bytes <= limit / 2) return 0;
+    
+    // Two chunks in flight must fit with room to spare
+    size_t chunk_bytes = std::min<size_t>(VULKAN_STDPAR_STREAM_CHUNK_BYTES, limit / 8);
+    return std::max<size_t>(1, chunk_bytes / element_bytes);
+}
+
+/**
+ * @brief Check whether engine device memory can be used by kernels on a queue
+ * 
+ * The USM backend allocates every engine's device memory against the
+ * default queue's context, and those pointers are meaningless on a queue
+ * of another context. Buffers are not tied to a context.
+ * 
+ * @param q Execution queue
+ * @return True if kernels on q may access engine device memory directly
+ */
+inline bool shares_device_memory(const sycl::queue& q) {
+#ifdef VULKAN_STDPAR_USE_USM
+    return q.get_context() == queue::get_default_queue().get_context();
+#else
+    (void)q;
+    return true;
+#endif
+}
+
+/**
+ * @brief Choose how an algorithm reaches its data on a queue
+ * @param q Execution queue
+ * @param count Number of elements
+ * @param element_bytes Device bytes per element across all buffers involved
+ * @return Elements per streaming chunk, or 0 to run on engine device memory
+ */
+inline size_t stream_chunk_size_for(sycl::queue& q, size_t count, size_t element_bytes) {
+    size_t chunk = stream_chunk_size(q, count, element_bytes);
+    // Foreign context: stage through buffers on q in a single chunk
+    if (chunk == 0 && count > 0 && !shares_device_memory(q)) chunk = count;
+    return chunk;
+}
+
+/**
+ * @brief Pair of device staging buffers used for double-buffered streaming
+ * @tparam T Element type
+ */
+template<typename T>
+class stream_slots {
+private:
+    memory::device_buffer_cache::block_type blocks_[2];
+    std::optional<sycl::buffer<T>> views_[2];
+    
+public:
+    explicit stream_slots(size_t chunk)
+        : blocks_{memory::device_buffer_cache::instance().checkout(chunk * sizeof(T)),
+                  memory::device_buffer_cache::instance().checkout(chunk * sizeof(T))}
+    {
+        views_[0] = memory::view_device_block<T>(blocks_[0], chunk);
+        views_[1] = memory::view_device_block<T>(blocks_[1], chunk);
+    }
+    
+    ~stream_slots() {
+        for (int i = 0; i < 2; ++i) {
+            views_[i].reset();
+            memory::device_buffer_cache::instance().checkin(std::move(blocks_[i]));
+        }
+    }
+    
+    stream_slots(const stream_slots&) = delete;
+    stream_slots& operator=(const stream_slots&) = delete;
+    
+    sycl::buffer<T>& operator[](size_t k) { return *views_[k % 2]; }
+};
+
+/**
+ * @brief Apply func to a range larger than device memory, chunk by chunk
+ * 
+ * Each chunk is uploaded into one of two staging buffers, processed and
+ * downloaded. The queue orders work per buffer only, so the upload of
+ * chunk k + 1 proceeds while chunk k computes. Results land in host
+ * memory, which becomes the current copy.
+ */
+template<typename T, typename Alloc, typename Func>
+void stream_kernel(sycl::queue& q, unified_vector<T, Alloc>& vec,
+                   size_t start, size_t count, size_t chunk, Func func)
+{
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    T* data = engine.host_data() + start;
+    
+    {
+        stream_slots<T> slots(chunk);
+        for (size_t offset = 0, k = 0; offset < count; offset += chunk, ++k) {
+            size_t n = std::min(chunk, count - offset);
+            T* host = data + offset;
+            sycl::buffer<T>& slot = slots[k];
+            
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                cgh.copy(host, acc);
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = slot.template get_access<sycl::access::mode::read_write>(cgh, sycl::range<1>(n));
+                cgh.parallel_for(sycl::range<1>(n), [=](sycl::id<1> idx) {
+                    func(acc[idx]);
+                });
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                cgh.copy(acc, host);
+            });
+        }
+        q.wait();
+    }
+    
+    engine.mark_host_dirty(start, start + count);
+}
+
+/**
+ * @brief Transform a range larger than device memory, chunk by chunk
+ */
+template<typename T, typename InAlloc, typename U, typename OutAlloc, typename Func>
+void stream_transform(sycl::queue& q, const unified_vector<T, InAlloc>& input,
+                      unified_vector<U, OutAlloc>& output,
+                      size_t start, size_t out_start, size_t count, size_t chunk, Func func)
+{
+    auto& input_engine = input.get_engine();
+    auto& output_engine = output.get_engine();
+    input_engine.sync_to_host();
+    output_engine.sync_to_host();
+    const T* in_data = input_engine.host_data() + start;
+    U* out_data = output_engine.host_data() + out_start;
+    
+    {
+        stream_slots<T> in_slots(chunk);
+        stream_slots<U> out_slots(chunk);
+        for (size_t offset = 0, k = 0; offset < count; offset += chunk, ++k) {
+            size_t n = std::min(chunk, count - offset);
+            const T* in_host = in_data + offset;
+            U* out_host = out_data + offset;
+            sycl::buffer<T>& in_slot = in_slots[k];
+            sycl::buffer<U>& out_slot = out_slots[k];
+            
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = in_slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                cgh.copy(in_host, acc);
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto in_acc = in_slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                auto out_acc = out_slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                cgh.parallel_for(sycl::range<1>(n), [=](sycl::id<1> idx) {
+                    out_acc[idx] = func(in_acc[idx]);
+                });
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = out_slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                cgh.copy(acc, out_host);
+            });
+        }
+        q.wait();
+    }
+    
+    output_engine.mark_host_dirty(out_start, out_start + count);
+}
+
+/**
+ * @brief Reduce a range larger than device memory, chunk by chunk
+ * 
+ * Each chunk reduces into its own partial seeded with the chunk's first
+ * element; the partials are combined with init on the host in chunk
+ * order. Device reductions are only used when SYCL knows op's identity;
+ * for other operations the range, already in host memory, is reduced on
+ * the host.
+ */
+template<typename T, typename Alloc, typename BinaryOp>
+T stream_reduce(sycl::queue& q, const unified_vector<T, Alloc>& vec,
+                size_t start, size_t count, size_t chunk, T init, BinaryOp op)
+{
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    const T* data = engine.host_data() + start;
+    
+    if constexpr (!sycl::has_known_identity_v<BinaryOp, T>) {
+        return std::accumulate(data, data + count, init, op);
+    } else {
+        size_t num_chunks = (count + chunk - 1) / chunk;
+        T* partials = sycl::malloc_shared<T>(num_chunks, q);
+        if (!partials) throw out_of_memory_exception(num_chunks * sizeof(T));
+        
+        // Seed every partial before the first kernel; the host does not
+        // touch partials again until the final wait
+        for (size_t k = 0; k < num_chunks; ++k) {
+            partials[k] = data[k * chunk];
+        }
+        
+        {
+            stream_slots<T> slots(chunk);
+            for (size_t offset = 0, k = 0; offset < count; offset += chunk, ++k) {
+                size_t n = std::min(chunk, count - offset);
+                if (n == 1) continue;
+                const T* host = data + offset;
+                sycl::buffer<T>& slot = slots[k];
+                T* partial = partials + k;
+                
+                q.submit([&](sycl::handler& cgh) {
+                    auto acc = slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                    cgh.copy(host, acc);
+                });
+                q.submit([&](sycl::handler& cgh) {
+                    auto acc = slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                    auto reduction = sycl::reduction(partial, sycl::known_identity_v<BinaryOp, T>, op);
+                    cgh.parallel_for(sycl::range<1>(n - 1), reduction,
+                                     [=](sycl::id<1> idx, auto& sum) {
+                        sum.combine(acc[idx[0] + 1]);
+                    });
+                });
+            }
+            q.wait();
+        }
+        
+        T result = init;
+        for (size_t k = 0; k < num_chunks; ++k) {
+            result = op(result, partials[k]);
+        }
+        sycl::free(partials, q);
+        return result;
+    }
+}
+
 /**
  * @brief Execute functor on unified_vector range
  * @tparam T Element type
+ * @tparam Alloc Allocator type
  * @tparam Func Functor type
  * @param policy Execution policy
  * @param vec Vector to operate on
@@ -2984,9 +10648,9 @@ namespace detail {
  * @param count Number of elements
  * @param func Functor to apply
  */
-template<typename T, typename Func>
+template<typename T, typename Alloc, typename Func>
 void execute_kernel(const vulkan_parallel_policy& policy,
-                   unified_vector<T>& vec,
+                   unified_vector<T, Alloc>& vec,
                    size_t start,
                    size_t count,
                    Func func)
@@ -2994,12 +10658,6 @@ void execute_kernel(const vulkan_parallel_policy& policy,
     static_assert(is_device_executable<Func>(), 
                   "Functor must be trivially copyable for device execution");
     
-    // Get versioning engine
-    auto& engine = vec.get_engine();
-    
-    // Sync to device before execution
-    engine.sync_to_device();
-    
     // Get SYCL queue
     sycl::queue& q = policy.get_queue();
     
@@ -3007,7 +10665,36 @@ void execute_kernel(const vulkan_parallel_policy& policy,
     auto start_time = std::chrono::high_resolution_clock::now();
 #endif
     
+    // Stream ranges that do not fit on the device or whose memory q cannot reach
+    if (size_t chunk = stream_chunk_size_for(q, count, sizeof(T))) {
+        stream_kernel(q, vec, start, count, chunk, func);
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_kernel_launch(elapsed.count());
+#endif
+        return;
+    }
+    
+    // Get versioning engine
+    auto& engine = vec.get_engine();
+    
+    // Keep the device copy resident until the result is marked, then sync
+    auto pin = engine.pin_device();
+    engine.sync_to_device();
+    
     // Launch kernel
+#ifdef VULKAN_STDPAR_USE_USM
+    T* data = engine.get_device_pointer();
+    auto deps = engine.get_device_events();
+    sycl::event done = q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+            func(data[idx[0] + start]);
+        });
+    });
+    engine.set_device_event(done);
+    done.wait();
+#else
     q.submit([&](sycl::handler& cgh) {
         auto buf = engine.get_device_buffer();
         auto acc = buf.template get_access<sycl::access::mode::read_write>(cgh);
@@ -3017,6 +10704,7 @@ void execute_kernel(const vulkan_parallel_policy& policy,
             func(acc[i]);
         });
     }).wait();
+#endif
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -3030,42 +10718,78 @@ void execute_kernel(const vulkan_parallel_policy& policy,
 
 /**
  * @brief Execute transform on unified_vector
+ * 
+ * Every element of output[out_start, out_start + count) is written, so the
+ * range is discarded before the output is synchronized: pending host
+ * writes there are dropped instead of being uploaded only to be
+ * overwritten.
  */
-template<typename T, typename U, typename Func>
+template<typename T, typename InAlloc, typename U, typename OutAlloc, typename Func>
 void execute_transform(const vulkan_parallel_policy& policy,
-                      unified_vector<T>& input,
-                      unified_vector<U>& output,
+                      const unified_vector<T, InAlloc>& input,
+                      unified_vector<U, OutAlloc>& output,
                       size_t start,
+                      size_t out_start,
                       size_t count,
                       Func func)
 {
     static_assert(is_device_executable<Func>(),
                   "Functor must be trivially copyable for device execution");
     
-    auto& input_engine = input.get_engine();
-    auto& output_engine = output.get_engine();
-    
-    // Sync input to device
-    input_engine.sync_to_device();
-    
     sycl::queue& q = policy.get_queue();
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto start_time = std::chrono::high_resolution_clock::now();
 #endif
     
+    // Stream ranges that do not fit on the device or whose memory q cannot reach
+    if (size_t chunk = stream_chunk_size_for(q, count, sizeof(T) + sizeof(U))) {
+        stream_transform(q, input, output, start, out_start, count, chunk, func);
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_kernel_launch(elapsed.count());
+#endif
+        return;
+    }
+    
+    auto& input_engine = input.get_engine();
+    auto& output_engine = output.get_engine();
+    auto input_pin = input_engine.pin_device();
+    auto output_pin = output_engine.pin_device();
+    
+    // Sync input to device; the output range is write-only
+    input_engine.sync_to_device();
+    output_engine.discard_range(out_start, out_start + count);
+    
     // Launch transform kernel
+#ifdef VULKAN_STDPAR_USE_USM
+    const T* in_data = input_engine.get_device_pointer();
+    U* out_data = output_engine.get_device_pointer();
+    auto deps = input_engine.get_device_events();
+    auto out_deps = output_engine.get_device_events();
+    deps.insert(deps.end(), out_deps.begin(), out_deps.end());
+    sycl::event done = q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+            out_data[out_start + idx[0]] = func(in_data[start + idx[0]]);
+        });
+    });
+    input_engine.set_device_event(done);
+    output_engine.set_device_event(done);
+    done.wait();
+#else
     q.submit([&](sycl::handler& cgh) {
         auto in_buf = input_engine.get_device_buffer();
         auto out_buf = output_engine.get_device_buffer();
         auto in_acc = in_buf.template get_access<sycl::access::mode::read>(cgh);
-        auto out_acc = out_buf.template get_access<sycl::access::mode::write>(cgh);
+        auto out_acc = out_buf.template get_access<sycl::access::mode::discard_write>(
+            cgh, sycl::range<1>(count), sycl::id<1>(out_start));
         
         cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
-            size_t i = idx[0] + start;
-            out_acc[i] = func(in_acc[i]);
+            out_acc[idx] = func(in_acc[start + idx[0]]);
         });
     }).wait();
+#endif
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -3079,9 +10803,9 @@ void execute_transform(const vulkan_parallel_policy& policy,
 /**
  * @brief Execute reduction on unified_vector
  */
-template<typename T, typename BinaryOp>
+template<typename T, typename Alloc, typename BinaryOp>
 T execute_reduce(const vulkan_parallel_policy& policy,
-                unified_vector<T>& vec,
+                const unified_vector<T, Alloc>& vec,
                 size_t start,
                 size_t count,
                 T init,
@@ -3090,11 +10814,18 @@ T execute_reduce(const vulkan_parallel_policy& policy,
     static_assert(is_device_executable<BinaryOp>(),
                   "Binary operation must be trivially copyable for device execution");
     
+    sycl::queue& q = policy.get_queue();
+    
+    // Stream ranges that do not fit on the device or whose memory q cannot
+    // reach, combining per-chunk partials
+    if (size_t chunk = stream_chunk_size_for(q, count, sizeof(T))) {
+        return stream_reduce(q, vec, start, count, chunk, init, op);
+    }
+    
     auto& engine = vec.get_engine();
+    auto pin = engine.pin_device();
     engine.sync_to_device();
     
-    sycl::queue& q = policy.get_queue();
-    
     // Use SYCL reduction
     T* result = sycl::malloc_shared<T>(1, q);
     *result = init;
@@ -3103,6 +10834,19 @@ T execute_reduce(const vulkan_parallel_policy& policy,
     auto start_time = std::chrono::high_resolution_clock::now();
 #endif
     
+#ifdef VULKAN_STDPAR_USE_USM
+    const T* data = engine.get_device_pointer();
+    auto deps = engine.get_device_events();
+    q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        auto reduction = sycl::reduction(result, op);
+        
+        cgh.parallel_for(sycl::range<1>(count), reduction,
+                        [=](sycl::id<1> idx, auto& sum) {
+            sum.combine(data[idx[0] + start]);
+        });
+    }).wait();
+#else
     q.submit([&](sycl::handler& cgh) {
         auto buf = engine.get_device_buffer();
         auto acc = buf.template get_access<sycl::access::mode::read>(cgh);
@@ -3114,6 +10858,7 @@ T execute_reduce(const vulkan_parallel_policy& policy,
             sum.combine(acc[i]);
         });
     }).wait();
+#endif
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -3137,15 +10882,16 @@ T execute_reduce(const vulkan_parallel_policy& policy,
  * @brief Parallel for_each implementation
  * @tparam T Element type
  * @tparam Func Functor type
+ * @tparam Alloc Allocator type
  * @param policy Execution policy
  * @param first Beginning of range
  * @param last End of range
  * @param func Unary function to apply
  */
-template<typename T, typename Func>
+template<typename T, typename Func, typename Alloc>
 void for_each(const vulkan_parallel_policy& policy,
-              typename unified_vector<T>::iterator first,
-              typename unified_vector<T>::iterator last,
+              unified_iterator<T, Alloc> first,
+              unified_iterator<T, Alloc> last,
               Func func)
 {
 #ifdef VULKAN_STDPAR_USE_SYCL
@@ -3157,30 +10903,31 @@ void for_each(const vulkan_parallel_policy& policy,
     
     detail::execute_kernel(policy, *container, start, count, func);
 #else
-    // Fallback to CPU execution
-    std::for_each(first, last, func);
+    // Fallback to the host thread pool; chunk k lands on the same worker every call
+    (void)policy;
+    if (first == last) return;
+    auto view = detail::write_view(first, last, access::read_write);
+    T* data = view.data();
+    if (!host::should_parallelize(view.size())) {
+        std::for_each(data, data + view.size(), func);
+        return;
+    }
+    host::parallel_for(view.size(), [&](size_t begin, size_t end) {
+        std::for_each(data + begin, data + end, func);
+    });
 #endif
 }
 
+namespace detail {
+
 /**
- * @brief Parallel transform implementation
- * @tparam T Input element type
- * @tparam U Output element type
- * @tparam Func Functor type
- * @param policy Execution policy
- * @param first Beginning of input range
- * @param last End of input range
- * @param d_first Beginning of output range
- * @param func Unary transformation function
- * @return Iterator to end of output range
+ * @brief Transform [first, last) of either iterator kind into d_first
  */
-template<typename T, typename U, typename Func>
-typename unified_vector<U>::iterator transform(
-    const vulkan_parallel_policy& policy,
-    typename unified_vector<T>::const_iterator first,
-    typename unified_vector<T>::const_iterator last,
-    typename unified_vector<U>::iterator d_first,
-    Func func)
+template<typename T, typename U, typename InputIt, typename OutAlloc, typename Func>
+unified_iterator<U, OutAlloc> transform_range(const vulkan_parallel_policy& policy,
+                                              InputIt first, InputIt last,
+                                              unified_iterator<U, OutAlloc> d_first,
+                                              Func func)
 {
 #ifdef VULKAN_STDPAR_USE_SYCL
     auto* input_container = first.get_container();
@@ -3191,26 +10938,129 @@ typename unified_vector<U>::iterator transform(
     
     if (count == 0) return d_first;
     
-    // Ensure output has enough space
+    // Ensure output has enough space; the new tail is written by the kernel
     if (output_container->size() < out_start + count) {
-        output_container->resize(out_start + count);
+        output_container->resize(out_start + count, no_init);
     }
     
-    detail::execute_transform(policy, 
-                             const_cast<unified_vector<T>&>(*input_container),
-                             *output_container, start, count, func);
+    execute_transform(policy, *input_container, *output_container, start, out_start, count, func);
     
-    return typename unified_vector<U>::iterator(output_container, out_start + count);
+    return unified_iterator<U, OutAlloc>(output_container, out_start + count);
 #else
-    // Fallback to CPU execution
-    return std::transform(first, last, d_first, func);
+    // Fallback to the host thread pool, partitioned like for_each
+    (void)policy;
+    auto* output_container = d_first.get_container();
+    size_t count = last.get_index() - first.get_index();
+    size_t out_start = d_first.get_index();
+    if (count == 0) return d_first;
+    if (output_container->size() < out_start + count) {
+        output_container->resize(out_start + count, no_init);
+    }
+    
+    unified_iterator<U, OutAlloc> out_first(output_container, out_start);
+    unified_iterator<U, OutAlloc> out_last(output_container, out_start + count);
+    auto out_view = write_view(out_first, out_last, output_access(first, out_first));
+    auto in_view = read_view(first, last);
+    const T* in = in_view.data();
+    U* out = out_view.data();
+    if (!host::should_parallelize(count)) {
+        std::transform(in, in + count, out, func);
+    } else {
+        host::parallel_for(count, [&](size_t begin, size_t end) {
+            std::transform(in + begin, in + end, out + begin, func);
+        });
+    }
+    return out_last;
+#endif
+}
+
+/**
+ * @brief Reduce [first, last) of either iterator kind
+ */
+template<typename T, typename InputIt, typename BinaryOp>
+T reduce_range(const vulkan_parallel_policy& policy, InputIt first, InputIt last, T init, BinaryOp op)
+{
+#ifdef VULKAN_STDPAR_USE_SYCL
+    auto* container = first.get_container();
+    size_t start = first.get_index();
+    size_t count = last.get_index() - start;
+    
+    if (count == 0) return init;
+    
+    return execute_reduce(policy, *container, start, count, init, op);
+#else
+    // Fallback to the host thread pool: one partial per chunk, combined in order
+    (void)policy;
+    if (first == last) return init;
+    auto view = read_view(first, last);
+    const T* data = view.data();
+    size_t count = view.size();
+    if (!host::should_parallelize(count)) {
+        return std::accumulate(data, data + count, init, op);
+    }
+    
+    auto& pool = host::get_thread_pool();
+    // Same split as host::parallel_for(count, ...), so chunk c stays on one worker
+    size_t grain = VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD / 4;
+    size_t chunks = std::min(pool.concurrency(), std::max<size_t>(1, count / grain));
+    std::vector<T> partials(chunks, init);
+    pool.parallel_for(chunks, 1, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            size_t lo = count * c / chunks;
+            size_t hi = count * (c + 1) / chunks;
+            partials[c] = std::accumulate(data + lo + 1, data + hi, data[lo], op);
+        }
+    });
+    return std::accumulate(partials.begin(), partials.end(), init, op);
 #endif
 }
 
+} // namespace detail
+
+/**
+ * @brief Parallel transform implementation
+ * @tparam T Input element type
+ * @tparam U Output element type
+ * @tparam Func Functor type
+ * @tparam InAlloc Input allocator type
+ * @tparam OutAlloc Output allocator type
+ * @param policy Execution policy
+ * @param first Beginning of input range
+ * @param last End of input range
+ * @param d_first Beginning of output range
+ * @param func Unary transformation function
+ * @return Iterator to end of output range
+ */
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+unified_iterator<U, OutAlloc> transform(
+    const vulkan_parallel_policy& policy,
+    const_unified_iterator<T, InAlloc> first,
+    const_unified_iterator<T, InAlloc> last,
+    unified_iterator<U, OutAlloc> d_first,
+    Func func)
+{
+    return detail::transform_range<T, U>(policy, first, last, d_first, func);
+}
+
+/**
+ * @brief Parallel transform over a mutable input range
+ */
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+unified_iterator<U, OutAlloc> transform(
+    const vulkan_parallel_policy& policy,
+    unified_iterator<T, InAlloc> first,
+    unified_iterator<T, InAlloc> last,
+    unified_iterator<U, OutAlloc> d_first,
+    Func func)
+{
+    return detail::transform_range<T, U>(policy, first, last, d_first, func);
+}
+
 /**
  * @brief Parallel reduce implementation
  * @tparam T Element type
  * @tparam BinaryOp Binary operation type
+ * @tparam Alloc Allocator type
  * @param policy Execution policy
  * @param first Beginning of range
  * @param last End of range
@@ -3218,42 +11068,43 @@ typename unified_vector<U>::iterator transform(
  * @param op Binary operation
  * @return Reduction result
  */
-template<typename T, typename BinaryOp = std::plus<T>>
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
 T reduce(const vulkan_parallel_policy& policy,
-        typename unified_vector<T>::const_iterator first,
-        typename unified_vector<T>::const_iterator last,
+        const_unified_iterator<T, Alloc> first,
+        const_unified_iterator<T, Alloc> last,
         T init = T(),
         BinaryOp op = BinaryOp())
 {
-#ifdef VULKAN_STDPAR_USE_SYCL
-    auto* container = first.get_container();
-    size_t start = first.get_index();
-    size_t count = last.get_index() - start;
-    
-    if (count == 0) return init;
-    
-    return detail::execute_reduce(policy,
-                                  const_cast<unified_vector<T>&>(*container),
-                                  start, count, init, op);
-#else
-    // Fallback to CPU execution
-    return std::accumulate(first, last, init, op);
-#endif
+    return detail::reduce_range(policy, first, last, init, op);
+}
+
+/**
+ * @brief Parallel reduce over a mutable range
+ */
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
+T reduce(const vulkan_parallel_policy& policy,
+        unified_iterator<T, Alloc> first,
+        unified_iterator<T, Alloc> last,
+        T init = T(),
+        BinaryOp op = BinaryOp())
+{
+    return detail::reduce_range(policy, first, last, init, op);
 }
 
 /**
  * @brief Parallel sort implementation (uses GPU-optimized sorting)
  * @tparam T Element type
  * @tparam Compare Comparison function type
+ * @tparam Alloc Allocator type
  * @param policy Execution policy
  * @param first Beginning of range
  * @param last End of range
  * @param comp Comparison function
  */
-template<typename T, typename Compare = std::less<T>>
+template<typename T, typename Compare = std::less<T>, typename Alloc>
 void sort(const vulkan_parallel_policy& policy,
-         typename unified_vector<T>::iterator first,
-         typename unified_vector<T>::iterator last,
+         unified_iterator<T, Alloc> first,
+         unified_iterator<T, Alloc> last,
          Compare comp = Compare())
 {
 #ifdef VULKAN_STDPAR_USE_SYCL
@@ -3271,6 +11122,7 @@ void sort(const vulkan_parallel_policy& policy,
     container->get_engine().mark_host_dirty(start, start + count);
 #else
     // Fallback to CPU execution
+    (void)policy;
     std::sort(first, last, comp);
 #endif
 }
@@ -3283,10 +11135,10 @@ namespace std {
 /**
  * @brief std::for_each overload for vulkan_parallel_policy
  */
-template<typename T, typename Func>
+template<typename T, typename Func, typename Alloc>
 void for_each(const vulkan_stdpar::vulkan_parallel_policy& policy,
-              typename vulkan_stdpar::unified_vector<T>::iterator first,
-              typename vulkan_stdpar::unified_vector<T>::iterator last,
+              vulkan_stdpar::unified_iterator<T, Alloc> first,
+              vulkan_stdpar::unified_iterator<T, Alloc> last,
               Func func)
 {
     vulkan_stdpar::for_each(policy, first, last, func);
@@ -3295,12 +11147,23 @@ void for_each(const vulkan_stdpar::vulkan_parallel_policy& policy,
 /**
  * @brief std::transform overload for vulkan_parallel_policy
  */
-template<typename T, typename U, typename Func>
-typename vulkan_stdpar::unified_vector<U>::iterator transform(
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> transform(
+    const vulkan_stdpar::vulkan_parallel_policy& policy,
+    vulkan_stdpar::const_unified_iterator<T, InAlloc> first,
+    vulkan_stdpar::const_unified_iterator<T, InAlloc> last,
+    vulkan_stdpar::unified_iterator<U, OutAlloc> d_first,
+    Func func)
+{
+    return vulkan_stdpar::transform(policy, first, last, d_first, func);
+}
+
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> transform(
     const vulkan_stdpar::vulkan_parallel_policy& policy,
-    typename vulkan_stdpar::unified_vector<T>::const_iterator first,
-    typename vulkan_stdpar::unified_vector<T>::const_iterator last,
-    typename vulkan_stdpar::unified_vector<U>::iterator d_first,
+    vulkan_stdpar::unified_iterator<T, InAlloc> first,
+    vulkan_stdpar::unified_iterator<T, InAlloc> last,
+    vulkan_stdpar::unified_iterator<U, OutAlloc> d_first,
     Func func)
 {
     return vulkan_stdpar::transform(policy, first, last, d_first, func);
@@ -3309,10 +11172,20 @@ typename vulkan_stdpar::unified_vector<U>::iterator transform(
 /**
  * @brief std::reduce overload for vulkan_parallel_policy
  */
-template<typename T, typename BinaryOp = std::plus<T>>
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
+T reduce(const vulkan_stdpar::vulkan_parallel_policy& policy,
+        vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+        vulkan_stdpar::const_unified_iterator<T, Alloc> last,
+        T init = T(),
+        BinaryOp op = BinaryOp())
+{
+    return vulkan_stdpar::reduce(policy, first, last, init, op);
+}
+
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
 T reduce(const vulkan_stdpar::vulkan_parallel_policy& policy,
-        typename vulkan_stdpar::unified_vector<T>::const_iterator first,
-        typename vulkan_stdpar::unified_vector<T>::const_iterator last,
+        vulkan_stdpar::unified_iterator<T, Alloc> first,
+        vulkan_stdpar::unified_iterator<T, Alloc> last,
         T init = T(),
         BinaryOp op = BinaryOp())
 {
@@ -3322,10 +11195,10 @@ T reduce(const vulkan_stdpar::vulkan_parallel_policy& policy,
 /**
  * @brief std::sort overload for vulkan_parallel_policy
  */
-template<typename T, typename Compare = std::less<T>>
+template<typename T, typename Compare = std::less<T>, typename Alloc>
 void sort(const vulkan_stdpar::vulkan_parallel_policy& policy,
-         typename vulkan_stdpar::unified_vector<T>::iterator first,
-         typename vulkan_stdpar::unified_vector<T>::iterator last,
+         vulkan_stdpar::unified_iterator<T, Alloc> first,
+         vulkan_stdpar::unified_iterator<T, Alloc> last,
          Compare comp = Compare())
 {
     vulkan_stdpar::sort(policy, first, last, comp);
@@ -3333,6 +11206,5 @@ void sort(const vulkan_stdpar::vulkan_parallel_policy& policy,
 
 } // namespace std
 
-#endif // VULKAN_STDPAR_ALGORITHMS_PARALLEL_INVOKER_HPP
 
 #endif // VULKAN_STDPAR_VULKAN_STDPAR_HPP
@@ -13,19 +13,30 @@
 #define VULKAN_STDPAR_ALGORITHMS_PARALLEL_INVOKER_HPP
 
 #include "../core/versioning_engine.hpp"
+#include "../core/device_cache.hpp"
+#include "../core/residency.hpp"
 #include "../core/device_selection.hpp"
 #include "../core/profiling.hpp"
 #include "../core/exceptions.hpp"
 #include "../containers/unified_vector.hpp"
+#include "std_overloads.hpp"
 #include <algorithm>
 #include <numeric>
 #include <functional>
 #include <type_traits>
 
 #ifdef VULKAN_STDPAR_USE_SYCL
+#include <optional>
 #include <sycl/sycl.hpp>
 #endif
 
+/**
+ * @brief Upper bound on one streaming chunk in bytes
+ */
+#ifndef VULKAN_STDPAR_STREAM_CHUNK_BYTES
+#define VULKAN_STDPAR_STREAM_CHUNK_BYTES (size_t(64) * 1024 * 1024)
+#endif
+
 namespace vulkan_stdpar {
 
 /**
@@ -88,9 +99,257 @@ namespace detail {
 
 #ifdef VULKAN_STDPAR_USE_SYCL
 
+/**
+ * @brief Get the device bytes an algorithm may use on a queue
+ * @param q Execution queue
+ * @return Smaller of device memory and the residency budget
+ */
+inline size_t device_memory_limit(sycl::queue& q) {
+    size_t limit = q.get_device().get_info<sycl::info::device::global_mem_size>();
+    size_t budget = memory::residency_manager::instance().budget();
+    return budget != 0 ? std::min(limit, budget) : limit;
+}
+
+/**
+ * @brief Choose a streaming chunk size for an out-of-core range
+ * @param q Execution queue
+ * @param count Number of elements
+ * @param element_bytes Device bytes per element across all buffers involved
+ * @return Elements per chunk, or 0 if the range fits on the device
+ */
+inline size_t stream_chunk_size(sycl::queue& q, size_t count, size_t element_bytes) {
+    size_t limit = device_memory_limit(q);
+    if (count * element_bytes <= limit / 2) return 0;
+    
+    // Two chunks in flight must fit with room to spare
+    size_t chunk_bytes = std::min<size_t>(VULKAN_STDPAR_STREAM_CHUNK_BYTES, limit / 8);
+    return std::max<size_t>(1, chunk_bytes / element_bytes);
+}
+
+/**
+ * @brief Check whether engine device memory can be used by kernels on a queue
+ * 
+ * The USM backend allocates every engine's device memory against the
+ * default queue's context, and those pointers are meaningless on a queue
+ * of another context. Buffers are not tied to a context.
+ * 
+ * @param q Execution queue
+ * @return True if kernels on q may access engine device memory directly
+ */
+inline bool shares_device_memory(const sycl::queue& q) {
+#ifdef VULKAN_STDPAR_USE_USM
+    return q.get_context() == queue::get_default_queue().get_context();
+#else
+    (void)q;
+    return true;
+#endif
+}
+
+/**
+ * @brief Choose how an algorithm reaches its data on a queue
+ * @param q Execution queue
+ * @param count Number of elements
+ * @param element_bytes Device bytes per element across all buffers involved
+ * @return Elements per streaming chunk, or 0 to run on engine device memory
+ */
+inline size_t stream_chunk_size_for(sycl::queue& q, size_t count, size_t element_bytes) {
+    size_t chunk = stream_chunk_size(q, count, element_bytes);
+    // Foreign context: stage through buffers on q in a single chunk
+    if (chunk == 0 && count > 0 && !shares_device_memory(q)) chunk = count;
+    return chunk;
+}
+
+/**
+ * @brief Pair of device staging buffers used for double-buffered streaming
+ * @tparam T Element type
+ */
+template<typename T>
+class stream_slots {
+private:
+    memory::device_buffer_cache::block_type blocks_[2];
+    std::optional<sycl::buffer<T>> views_[2];
+    
+public:
+    explicit stream_slots(size_t chunk)
+        : blocks_{memory::device_buffer_cache::instance().checkout(chunk * sizeof(T)),
+                  memory::device_buffer_cache::instance().checkout(chunk * sizeof(T))}
+    {
+        views_[0] = memory::view_device_block<T>(blocks_[0], chunk);
+        views_[1] = memory::view_device_block<T>(blocks_[1], chunk);
+    }
+    
+    ~stream_slots() {
+        for (int i = 0; i < 2; ++i) {
+            views_[i].reset();
+            memory::device_buffer_cache::instance().checkin(std::move(blocks_[i]));
+        }
+    }
+    
+    stream_slots(const stream_slots&) = delete;
+    stream_slots& operator=(const stream_slots&) = delete;
+    
+    sycl::buffer<T>& operator[](size_t k) { return *views_[k % 2]; }
+};
+
+/**
+ * @brief Apply func to a range larger than device memory, chunk by chunk
+ * 
+ * Each chunk is uploaded into one of two staging buffers, processed and
+ * downloaded. The queue orders work per buffer only, so the upload of
+ * chunk k + 1 proceeds while chunk k computes. Results land in host
+ * memory, which becomes the current copy.
+ */
+template<typename T, typename Alloc, typename Func>
+void stream_kernel(sycl::queue& q, unified_vector<T, Alloc>& vec,
+                   size_t start, size_t count, size_t chunk, Func func)
+{
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    T* data = engine.host_data() + start;
+    
+    {
+        stream_slots<T> slots(chunk);
+        for (size_t offset = 0, k = 0; offset < count; offset += chunk, ++k) {
+            size_t n = std::min(chunk, count - offset);
+            T* host = data + offset;
+            sycl::buffer<T>& slot = slots[k];
+            
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                cgh.copy(host, acc);
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = slot.template get_access<sycl::access::mode::read_write>(cgh, sycl::range<1>(n));
+                cgh.parallel_for(sycl::range<1>(n), [=](sycl::id<1> idx) {
+                    func(acc[idx]);
+                });
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                cgh.copy(acc, host);
+            });
+        }
+        q.wait();
+    }
+    
+    engine.mark_host_dirty(start, start + count);
+}
+
+/**
+ * @brief Transform a range larger than device memory, chunk by chunk
+ */
+template<typename T, typename InAlloc, typename U, typename OutAlloc, typename Func>
+void stream_transform(sycl::queue& q, const unified_vector<T, InAlloc>& input,
+                      unified_vector<U, OutAlloc>& output,
+                      size_t start, size_t out_start, size_t count, size_t chunk, Func func)
+{
+    auto& input_engine = input.get_engine();
+    auto& output_engine = output.get_engine();
+    input_engine.sync_to_host();
+    output_engine.sync_to_host();
+    const T* in_data = input_engine.host_data() + start;
+    U* out_data = output_engine.host_data() + out_start;
+    
+    {
+        stream_slots<T> in_slots(chunk);
+        stream_slots<U> out_slots(chunk);
+        for (size_t offset = 0, k = 0; offset < count; offset += chunk, ++k) {
+            size_t n = std::min(chunk, count - offset);
+            const T* in_host = in_data + offset;
+            U* out_host = out_data + offset;
+            sycl::buffer<T>& in_slot = in_slots[k];
+            sycl::buffer<U>& out_slot = out_slots[k];
+            
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = in_slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                cgh.copy(in_host, acc);
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto in_acc = in_slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                auto out_acc = out_slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                cgh.parallel_for(sycl::range<1>(n), [=](sycl::id<1> idx) {
+                    out_acc[idx] = func(in_acc[idx]);
+                });
+            });
+            q.submit([&](sycl::handler& cgh) {
+                auto acc = out_slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                cgh.copy(acc, out_host);
+            });
+        }
+        q.wait();
+    }
+    
+    output_engine.mark_host_dirty(out_start, out_start + count);
+}
+
+/**
+ * @brief Reduce a range larger than device memory, chunk by chunk
+ * 
+ * Each chunk reduces into its own partial seeded with the chunk's first
+ * element; the partials are combined with init on the host in chunk
+ * order. Device reductions are only used when SYCL knows op's identity;
+ * for other operations the range, already in host memory, is reduced on
+ * the host.
+ */
+template<typename T, typename Alloc, typename BinaryOp>
+T stream_reduce(sycl::queue& q, const unified_vector<T, Alloc>& vec,
+                size_t start, size_t count, size_t chunk, T init, BinaryOp op)
+{
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    const T* data = engine.host_data() + start;
+    
+    if constexpr (!sycl::has_known_identity_v<BinaryOp, T>) {
+        return std::accumulate(data, data + count, init, op);
+    } else {
+        size_t num_chunks = (count + chunk - 1) / chunk;
+        T* partials = sycl::malloc_shared<T>(num_chunks, q);
+        if (!partials) throw out_of_memory_exception(num_chunks * sizeof(T));
+        
+        // Seed every partial before the first kernel; the host does not
+        // touch partials again until the final wait
+        for (size_t k = 0; k < num_chunks; ++k) {
+            partials[k] = data[k * chunk];
+        }
+        
+        {
+            stream_slots<T> slots(chunk);
+            for (size_t offset = 0, k = 0; offset < count; offset += chunk, ++k) {
+                size_t n = std::min(chunk, count - offset);
+                if (n == 1) continue;
+                const T* host = data + offset;
+                sycl::buffer<T>& slot = slots[k];
+                T* partial = partials + k;
+                
+                q.submit([&](sycl::handler& cgh) {
+                    auto acc = slot.template get_access<sycl::access::mode::discard_write>(cgh, sycl::range<1>(n));
+                    cgh.copy(host, acc);
+                });
+                q.submit([&](sycl::handler& cgh) {
+                    auto acc = slot.template get_access<sycl::access::mode::read>(cgh, sycl::range<1>(n));
+                    auto reduction = sycl::reduction(partial, sycl::known_identity_v<BinaryOp, T>, op);
+                    cgh.parallel_for(sycl::range<1>(n - 1), reduction,
+                                     [=](sycl::id<1> idx, auto& sum) {
+                        sum.combine(acc[idx[0] + 1]);
+                    });
+                });
+            }
+            q.wait();
+        }
+        
+        T result = init;
+        for (size_t k = 0; k < num_chunks; ++k) {
+            result = op(result, partials[k]);
+        }
+        sycl::free(partials, q);
+        return result;
+    }
+}
+
 /**
  * @brief Execute functor on unified_vector range
  * @tparam T Element type
+ * @tparam Alloc Allocator type
  * @tparam Func Functor type
  * @param policy Execution policy
  * @param vec Vector to operate on
@@ -98,9 +357,9 @@ namespace detail {
  * @param count Number of elements
  * @param func Functor to apply
  */
-template<typename T, typename Func>
+template<typename T, typename Alloc, typename Func>
 void execute_kernel(const vulkan_parallel_policy& policy,
-                   unified_vector<T>& vec,
+                   unified_vector<T, Alloc>& vec,
                    size_t start,
                    size_t count,
                    Func func)
@@ -108,12 +367,6 @@ void execute_kernel(const vulkan_parallel_policy& policy,
     static_assert(is_device_executable<Func>(), 
                   "Functor must be trivially copyable for device execution");
     
-    // Get versioning engine
-    auto& engine = vec.get_engine();
-    
-    // Sync to device before execution
-    engine.sync_to_device();
-    
     // Get SYCL queue
     sycl::queue& q = policy.get_queue();
     
@@ -121,7 +374,36 @@ void execute_kernel(const vulkan_parallel_policy& policy,
     auto start_time = std::chrono::high_resolution_clock::now();
 #endif
     
+    // Stream ranges that do not fit on the device or whose memory q cannot reach
+    if (size_t chunk = stream_chunk_size_for(q, count, sizeof(T))) {
+        stream_kernel(q, vec, start, count, chunk, func);
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_kernel_launch(elapsed.count());
+#endif
+        return;
+    }
+    
+    // Get versioning engine
+    auto& engine = vec.get_engine();
+    
+    // Keep the device copy resident until the result is marked, then sync
+    auto pin = engine.pin_device();
+    engine.sync_to_device();
+    
     // Launch kernel
+#ifdef VULKAN_STDPAR_USE_USM
+    T* data = engine.get_device_pointer();
+    auto deps = engine.get_device_events();
+    sycl::event done = q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+            func(data[idx[0] + start]);
+        });
+    });
+    engine.set_device_event(done);
+    done.wait();
+#else
     q.submit([&](sycl::handler& cgh) {
         auto buf = engine.get_device_buffer();
         auto acc = buf.template get_access<sycl::access::mode::read_write>(cgh);
@@ -131,6 +413,7 @@ void execute_kernel(const vulkan_parallel_policy& policy,
             func(acc[i]);
         });
     }).wait();
+#endif
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -144,42 +427,78 @@ void execute_kernel(const vulkan_parallel_policy& policy,
 
 /**
  * @brief Execute transform on unified_vector
+ * 
+ * Every element of output[out_start, out_start + count) is written, so the
+ * range is discarded before the output is synchronized: pending host
+ * writes there are dropped instead of being uploaded only to be
+ * overwritten.
  */
-template<typename T, typename U, typename Func>
+template<typename T, typename InAlloc, typename U, typename OutAlloc, typename Func>
 void execute_transform(const vulkan_parallel_policy& policy,
-                      unified_vector<T>& input,
-                      unified_vector<U>& output,
+                      const unified_vector<T, InAlloc>& input,
+                      unified_vector<U, OutAlloc>& output,
                       size_t start,
+                      size_t out_start,
                       size_t count,
                       Func func)
 {
     static_assert(is_device_executable<Func>(),
                   "Functor must be trivially copyable for device execution");
     
-    auto& input_engine = input.get_engine();
-    auto& output_engine = output.get_engine();
-    
-    // Sync input to device
-    input_engine.sync_to_device();
-    
     sycl::queue& q = policy.get_queue();
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto start_time = std::chrono::high_resolution_clock::now();
 #endif
     
+    // Stream ranges that do not fit on the device or whose memory q cannot reach
+    if (size_t chunk = stream_chunk_size_for(q, count, sizeof(T) + sizeof(U))) {
+        stream_transform(q, input, output, start, out_start, count, chunk, func);
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_kernel_launch(elapsed.count());
+#endif
+        return;
+    }
+    
+    auto& input_engine = input.get_engine();
+    auto& output_engine = output.get_engine();
+    auto input_pin = input_engine.pin_device();
+    auto output_pin = output_engine.pin_device();
+    
+    // Sync input to device; the output range is write-only
+    input_engine.sync_to_device();
+    output_engine.discard_range(out_start, out_start + count);
+    
     // Launch transform kernel
+#ifdef VULKAN_STDPAR_USE_USM
+    const T* in_data = input_engine.get_device_pointer();
+    U* out_data = output_engine.get_device_pointer();
+    auto deps = input_engine.get_device_events();
+    auto out_deps = output_engine.get_device_events();
+    deps.insert(deps.end(), out_deps.begin(), out_deps.end());
+    sycl::event done = q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+            out_data[out_start + idx[0]] = func(in_data[start + idx[0]]);
+        });
+    });
+    input_engine.set_device_event(done);
+    output_engine.set_device_event(done);
+    done.wait();
+#else
     q.submit([&](sycl::handler& cgh) {
         auto in_buf = input_engine.get_device_buffer();
         auto out_buf = output_engine.get_device_buffer();
         auto in_acc = in_buf.template get_access<sycl::access::mode::read>(cgh);
-        auto out_acc = out_buf.template get_access<sycl::access::mode::write>(cgh);
+        auto out_acc = out_buf.template get_access<sycl::access::mode::discard_write>(
+            cgh, sycl::range<1>(count), sycl::id<1>(out_start));
         
         cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
-            size_t i = idx[0] + start;
-            out_acc[i] = func(in_acc[i]);
+            out_acc[idx] = func(in_acc[start + idx[0]]);
         });
     }).wait();
+#endif
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -193,9 +512,9 @@ void execute_transform(const vulkan_parallel_policy& policy,
 /**
  * @brief Execute reduction on unified_vector
  */
-template<typename T, typename BinaryOp>
+template<typename T, typename Alloc, typename BinaryOp>
 T execute_reduce(const vulkan_parallel_policy& policy,
-                unified_vector<T>& vec,
+                const unified_vector<T, Alloc>& vec,
                 size_t start,
                 size_t count,
                 T init,
@@ -204,11 +523,18 @@ T execute_reduce(const vulkan_parallel_policy& policy,
     static_assert(is_device_executable<BinaryOp>(),
                   "Binary operation must be trivially copyable for device execution");
     
+    sycl::queue& q = policy.get_queue();
+    
+    // Stream ranges that do not fit on the device or whose memory q cannot
+    // reach, combining per-chunk partials
+    if (size_t chunk = stream_chunk_size_for(q, count, sizeof(T))) {
+        return stream_reduce(q, vec, start, count, chunk, init, op);
+    }
+    
     auto& engine = vec.get_engine();
+    auto pin = engine.pin_device();
     engine.sync_to_device();
     
-    sycl::queue& q = policy.get_queue();
-    
     // Use SYCL reduction
     T* result = sycl::malloc_shared<T>(1, q);
     *result = init;
@@ -217,6 +543,19 @@ T execute_reduce(const vulkan_parallel_policy& policy,
     auto start_time = std::chrono::high_resolution_clock::now();
 #endif
     
+#ifdef VULKAN_STDPAR_USE_USM
+    const T* data = engine.get_device_pointer();
+    auto deps = engine.get_device_events();
+    q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        auto reduction = sycl::reduction(result, op);
+        
+        cgh.parallel_for(sycl::range<1>(count), reduction,
+                        [=](sycl::id<1> idx, auto& sum) {
+            sum.combine(data[idx[0] + start]);
+        });
+    }).wait();
+#else
     q.submit([&](sycl::handler& cgh) {
         auto buf = engine.get_device_buffer();
         auto acc = buf.template get_access<sycl::access::mode::read>(cgh);
@@ -228,6 +567,7 @@ T execute_reduce(const vulkan_parallel_policy& policy,
             sum.combine(acc[i]);
         });
     }).wait();
+#endif
     
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -251,15 +591,16 @@ T execute_reduce(const vulkan_parallel_policy& policy,
  * @brief Parallel for_each implementation
  * @tparam T Element type
  * @tparam Func Functor type
+ * @tparam Alloc Allocator type
  * @param policy Execution policy
  * @param first Beginning of range
  * @param last End of range
  * @param func Unary function to apply
  */
-template<typename T, typename Func>
+template<typename T, typename Func, typename Alloc>
 void for_each(const vulkan_parallel_policy& policy,
-              typename unified_vector<T>::iterator first,
-              typename unified_vector<T>::iterator last,
+              unified_iterator<T, Alloc> first,
+              unified_iterator<T, Alloc> last,
               Func func)
 {
 #ifdef VULKAN_STDPAR_USE_SYCL
@@ -271,30 +612,31 @@ void for_each(const vulkan_parallel_policy& policy,
     
     detail::execute_kernel(policy, *container, start, count, func);
 #else
-    // Fallback to CPU execution
-    std::for_each(first, last, func);
+    // Fallback to the host thread pool; chunk k lands on the same worker every call
+    (void)policy;
+    if (first == last) return;
+    auto view = detail::write_view(first, last, access::read_write);
+    T* data = view.data();
+    if (!host::should_parallelize(view.size())) {
+        std::for_each(data, data + view.size(), func);
+        return;
+    }
+    host::parallel_for(view.size(), [&](size_t begin, size_t end) {
+        std::for_each(data + begin, data + end, func);
+    });
 #endif
 }
 
+namespace detail {
+
 /**
- * @brief Parallel transform implementation
- * @tparam T Input element type
- * @tparam U Output element type
- * @tparam Func Functor type
- * @param policy Execution policy
- * @param first Beginning of input range
- * @param last End of input range
- * @param d_first Beginning of output range
- * @param func Unary transformation function
- * @return Iterator to end of output range
+ * @brief Transform [first, last) of either iterator kind into d_first
  */
-template<typename T, typename U, typename Func>
-typename unified_vector<U>::iterator transform(
-    const vulkan_parallel_policy& policy,
-    typename unified_vector<T>::const_iterator first,
-    typename unified_vector<T>::const_iterator last,
-    typename unified_vector<U>::iterator d_first,
-    Func func)
+template<typename T, typename U, typename InputIt, typename OutAlloc, typename Func>
+unified_iterator<U, OutAlloc> transform_range(const vulkan_parallel_policy& policy,
+                                              InputIt first, InputIt last,
+                                              unified_iterator<U, OutAlloc> d_first,
+                                              Func func)
 {
 #ifdef VULKAN_STDPAR_USE_SYCL
     auto* input_container = first.get_container();
@@ -305,26 +647,129 @@ typename unified_vector<U>::iterator transform(
     
     if (count == 0) return d_first;
     
-    // Ensure output has enough space
+    // Ensure output has enough space; the new tail is written by the kernel
     if (output_container->size() < out_start + count) {
-        output_container->resize(out_start + count);
+        output_container->resize(out_start + count, no_init);
     }
     
-    detail::execute_transform(policy, 
-                             const_cast<unified_vector<T>&>(*input_container),
-                             *output_container, start, count, func);
+    execute_transform(policy, *input_container, *output_container, start, out_start, count, func);
     
-    return typename unified_vector<U>::iterator(output_container, out_start + count);
+    return unified_iterator<U, OutAlloc>(output_container, out_start + count);
 #else
-    // Fallback to CPU execution
-    return std::transform(first, last, d_first, func);
+    // Fallback to the host thread pool, partitioned like for_each
+    (void)policy;
+    auto* output_container = d_first.get_container();
+    size_t count = last.get_index() - first.get_index();
+    size_t out_start = d_first.get_index();
+    if (count == 0) return d_first;
+    if (output_container->size() < out_start + count) {
+        output_container->resize(out_start + count, no_init);
+    }
+    
+    unified_iterator<U, OutAlloc> out_first(output_container, out_start);
+    unified_iterator<U, OutAlloc> out_last(output_container, out_start + count);
+    auto out_view = write_view(out_first, out_last, output_access(first, out_first));
+    auto in_view = read_view(first, last);
+    const T* in = in_view.data();
+    U* out = out_view.data();
+    if (!host::should_parallelize(count)) {
+        std::transform(in, in + count, out, func);
+    } else {
+        host::parallel_for(count, [&](size_t begin, size_t end) {
+            std::transform(in + begin, in + end, out + begin, func);
+        });
+    }
+    return out_last;
 #endif
 }
 
+/**
+ * @brief Reduce [first, last) of either iterator kind
+ */
+template<typename T, typename InputIt, typename BinaryOp>
+T reduce_range(const vulkan_parallel_policy& policy, InputIt first, InputIt last, T init, BinaryOp op)
+{
+#ifdef VULKAN_STDPAR_USE_SYCL
+    auto* container = first.get_container();
+    size_t start = first.get_index();
+    size_t count = last.get_index() - start;
+    
+    if (count == 0) return init;
+    
+    return execute_reduce(policy, *container, start, count, init, op);
+#else
+    // Fallback to the host thread pool: one partial per chunk, combined in order
+    (void)policy;
+    if (first == last) return init;
+    auto view = read_view(first, last);
+    const T* data = view.data();
+    size_t count = view.size();
+    if (!host::should_parallelize(count)) {
+        return std::accumulate(data, data + count, init, op);
+    }
+    
+    auto& pool = host::get_thread_pool();
+    // Same split as host::parallel_for(count, ...), so chunk c stays on one worker
+    size_t grain = VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD / 4;
+    size_t chunks = std::min(pool.concurrency(), std::max<size_t>(1, count / grain));
+    std::vector<T> partials(chunks, init);
+    pool.parallel_for(chunks, 1, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            size_t lo = count * c / chunks;
+            size_t hi = count * (c + 1) / chunks;
+            partials[c] = std::accumulate(data + lo + 1, data + hi, data[lo], op);
+        }
+    });
+    return std::accumulate(partials.begin(), partials.end(), init, op);
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief Parallel transform implementation
+ * @tparam T Input element type
+ * @tparam U Output element type
+ * @tparam Func Functor type
+ * @tparam InAlloc Input allocator type
+ * @tparam OutAlloc Output allocator type
+ * @param policy Execution policy
+ * @param first Beginning of input range
+ * @param last End of input range
+ * @param d_first Beginning of output range
+ * @param func Unary transformation function
+ * @return Iterator to end of output range
+ */
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+unified_iterator<U, OutAlloc> transform(
+    const vulkan_parallel_policy& policy,
+    const_unified_iterator<T, InAlloc> first,
+    const_unified_iterator<T, InAlloc> last,
+    unified_iterator<U, OutAlloc> d_first,
+    Func func)
+{
+    return detail::transform_range<T, U>(policy, first, last, d_first, func);
+}
+
+/**
+ * @brief Parallel transform over a mutable input range
+ */
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+unified_iterator<U, OutAlloc> transform(
+    const vulkan_parallel_policy& policy,
+    unified_iterator<T, InAlloc> first,
+    unified_iterator<T, InAlloc> last,
+    unified_iterator<U, OutAlloc> d_first,
+    Func func)
+{
+    return detail::transform_range<T, U>(policy, first, last, d_first, func);
+}
+
 /**
  * @brief Parallel reduce implementation
  * @tparam T Element type
  * @tparam BinaryOp Binary operation type
+ * @tparam Alloc Allocator type
  * @param policy Execution policy
  * @param first Beginning of range
  * @param last End of range
@@ -332,42 +777,43 @@ typename unified_vector<U>::iterator transform(
  * @param op Binary operation
  * @return Reduction result
  */
-template<typename T, typename BinaryOp = std::plus<T>>
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
 T reduce(const vulkan_parallel_policy& policy,
-        typename unified_vector<T>::const_iterator first,
-        typename unified_vector<T>::const_iterator last,
+        const_unified_iterator<T, Alloc> first,
+        const_unified_iterator<T, Alloc> last,
         T init = T(),
         BinaryOp op = BinaryOp())
 {
-#ifdef VULKAN_STDPAR_USE_SYCL
-    auto* container = first.get_container();
-    size_t start = first.get_index();
-    size_t count = last.get_index() - start;
-    
-    if (count == 0) return init;
-    
-    return detail::execute_reduce(policy,
-                                  const_cast<unified_vector<T>&>(*container),
-                                  start, count, init, op);
-#else
-    // Fallback to CPU execution
-    return std::accumulate(first, last, init, op);
-#endif
+    return detail::reduce_range(policy, first, last, init, op);
+}
+
+/**
+ * @brief Parallel reduce over a mutable range
+ */
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
+T reduce(const vulkan_parallel_policy& policy,
+        unified_iterator<T, Alloc> first,
+        unified_iterator<T, Alloc> last,
+        T init = T(),
+        BinaryOp op = BinaryOp())
+{
+    return detail::reduce_range(policy, first, last, init, op);
 }
 
 /**
  * @brief Parallel sort implementation (uses GPU-optimized sorting)
  * @tparam T Element type
  * @tparam Compare Comparison function type
+ * @tparam Alloc Allocator type
  * @param policy Execution policy
  * @param first Beginning of range
  * @param last End of range
  * @param comp Comparison function
  */
-template<typename T, typename Compare = std::less<T>>
+template<typename T, typename Compare = std::less<T>, typename Alloc>
 void sort(const vulkan_parallel_policy& policy,
-         typename unified_vector<T>::iterator first,
-         typename unified_vector<T>::iterator last,
+         unified_iterator<T, Alloc> first,
+         unified_iterator<T, Alloc> last,
          Compare comp = Compare())
 {
 #ifdef VULKAN_STDPAR_USE_SYCL
@@ -385,6 +831,7 @@ void sort(const vulkan_parallel_policy& policy,
     container->get_engine().mark_host_dirty(start, start + count);
 #else
     // Fallback to CPU execution
+    (void)policy;
     std::sort(first, last, comp);
 #endif
 }
@@ -397,10 +844,10 @@ namespace std {
 /**
  * @brief std::for_each overload for vulkan_parallel_policy
  */
-template<typename T, typename Func>
+template<typename T, typename Func, typename Alloc>
 void for_each(const vulkan_stdpar::vulkan_parallel_policy& policy,
-              typename vulkan_stdpar::unified_vector<T>::iterator first,
-              typename vulkan_stdpar::unified_vector<T>::iterator last,
+              vulkan_stdpar::unified_iterator<T, Alloc> first,
+              vulkan_stdpar::unified_iterator<T, Alloc> last,
               Func func)
 {
     vulkan_stdpar::for_each(policy, first, last, func);
@@ -409,12 +856,23 @@ void for_each(const vulkan_stdpar::vulkan_parallel_policy& policy,
 /**
  * @brief std::transform overload for vulkan_parallel_policy
  */
-template<typename T, typename U, typename Func>
-typename vulkan_stdpar::unified_vector<U>::iterator transform(
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> transform(
     const vulkan_stdpar::vulkan_parallel_policy& policy,
-    typename vulkan_stdpar::unified_vector<T>::const_iterator first,
-    typename vulkan_stdpar::unified_vector<T>::const_iterator last,
-    typename vulkan_stdpar::unified_vector<U>::iterator d_first,
+    vulkan_stdpar::const_unified_iterator<T, InAlloc> first,
+    vulkan_stdpar::const_unified_iterator<T, InAlloc> last,
+    vulkan_stdpar::unified_iterator<U, OutAlloc> d_first,
+    Func func)
+{
+    return vulkan_stdpar::transform(policy, first, last, d_first, func);
+}
+
+template<typename T, typename U, typename Func, typename InAlloc, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> transform(
+    const vulkan_stdpar::vulkan_parallel_policy& policy,
+    vulkan_stdpar::unified_iterator<T, InAlloc> first,
+    vulkan_stdpar::unified_iterator<T, InAlloc> last,
+    vulkan_stdpar::unified_iterator<U, OutAlloc> d_first,
     Func func)
 {
     return vulkan_stdpar::transform(policy, first, last, d_first, func);
@@ -423,10 +881,20 @@ typename vulkan_stdpar::unified_vector<U>::iterator transform(
 /**
  * @brief std::reduce overload for vulkan_parallel_policy
  */
-template<typename T, typename BinaryOp = std::plus<T>>
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
+T reduce(const vulkan_stdpar::vulkan_parallel_policy& policy,
+        vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+        vulkan_stdpar::const_unified_iterator<T, Alloc> last,
+        T init = T(),
+        BinaryOp op = BinaryOp())
+{
+    return vulkan_stdpar::reduce(policy, first, last, init, op);
+}
+
+template<typename T, typename BinaryOp = std::plus<T>, typename Alloc>
 T reduce(const vulkan_stdpar::vulkan_parallel_policy& policy,
-        typename vulkan_stdpar::unified_vector<T>::const_iterator first,
-        typename vulkan_stdpar::unified_vector<T>::const_iterator last,
+        vulkan_stdpar::unified_iterator<T, Alloc> first,
+        vulkan_stdpar::unified_iterator<T, Alloc> last,
         T init = T(),
         BinaryOp op = BinaryOp())
 {
@@ -436,10 +904,10 @@ T reduce(const vulkan_stdpar::vulkan_parallel_policy& policy,
 /**
  * @brief std::sort overload for vulkan_parallel_policy
  */
-template<typename T, typename Compare = std::less<T>>
+template<typename T, typename Compare = std::less<T>, typename Alloc>
 void sort(const vulkan_stdpar::vulkan_parallel_policy& policy,
-         typename vulkan_stdpar::unified_vector<T>::iterator first,
-         typename vulkan_stdpar::unified_vector<T>::iterator last,
+         vulkan_stdpar::unified_iterator<T, Alloc> first,
+         vulkan_stdpar::unified_iterator<T, Alloc> last,
          Compare comp = Compare())
 {
     vulkan_stdpar::sort(policy, first, last, comp);
@@ -0,0 +1,474 @@
+/**
+ * @file std_overloads.hpp
+ * @brief Pointer-unwrapping overloads of common std algorithms for unified_vector iterators
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * Calling std::sort, std::accumulate, std::copy, std::fill, std::find,
+ * std::count or std::equal without an execution policy on unified_vector
+ * iterators would otherwise go through unified_reference proxies, taking the
+ * engine lock on every element. The overloads in this file synchronize the
+ * range once, run on raw host pointers, and use the host thread pool above
+ * VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD elements.
+ */
+
+#ifndef VULKAN_STDPAR_ALGORITHMS_STD_OVERLOADS_HPP
+#define VULKAN_STDPAR_ALGORITHMS_STD_OVERLOADS_HPP
+
+#include "../core/thread_pool.hpp"
+#include "../containers/unified_vector.hpp"
+#include "../containers/host_view.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Trait identifying unified_vector iterators
+ */
+template<typename It>
+struct is_unified_iterator : std::false_type {};
+
+template<typename T, typename Alloc>
+struct is_unified_iterator<unified_iterator<T, Alloc>> : std::true_type {};
+
+template<typename T, typename Alloc>
+struct is_unified_iterator<const_unified_iterator<T, Alloc>> : std::true_type {};
+
+namespace detail {
+
+// ==================== Range Unwrapping ====================
+
+/**
+ * @brief Open a read-only host view over [first, last)
+ */
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(const_unified_iterator<T, Alloc> first, const_unified_iterator<T, Alloc> last) {
+    return host_view<const T, Alloc>(*first.get_container(), access::read, first.get_index(), last.get_index());
+}
+
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(unified_iterator<T, Alloc> first, unified_iterator<T, Alloc> last) {
+    const unified_vector<T, Alloc>& container = *first.get_container();
+    return host_view<const T, Alloc>(container, access::read, first.get_index(), last.get_index());
+}
+
+/**
+ * @brief Open a writable host view over [first, last)
+ */
+template<typename T, typename Alloc>
+host_view<T, Alloc> write_view(unified_iterator<T, Alloc> first, unified_iterator<T, Alloc> last, access mode) {
+    return host_view<T, Alloc>(*first.get_container(), mode, first.get_index(), last.get_index());
+}
+
+// ==================== Parallel Host Kernels ====================
+
+template<typename T, typename Compare>
+void host_sort(T* first, T* last, Compare comp) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    // Sort independent runs in parallel, then merge neighbouring runs pairwise
+    auto& pool = host::get_thread_pool();
+    size_t runs = pool.concurrency();
+    std::vector<size_t> bounds(runs + 1);
+    for (size_t i = 0; i <= runs; ++i) {
+        bounds[i] = n * i / runs;
+    }
+    pool.parallel_for(runs, 1, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r) {
+            std::sort(first + bounds[r], first + bounds[r + 1], comp);
+        }
+    });
+
+    for (size_t width = 1; width < runs; width *= 2) {
+        size_t merges = (runs + 2 * width - 1) / (2 * width);
+        pool.parallel_for(merges, 1, [&](size_t begin, size_t end) {
+            for (size_t m = begin; m < end; ++m) {
+                size_t lo = m * 2 * width;
+                size_t mid = std::min(lo + width, runs);
+                size_t hi = std::min(lo + 2 * width, runs);
+                if (mid < hi) {
+                    std::inplace_merge(first + bounds[lo], first + bounds[mid], first + bounds[hi], comp);
+                }
+            }
+        });
+    }
+}
+
+template<typename T, typename V>
+void host_fill(T* first, T* last, const V& value) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        std::fill(first, last, value);
+        return;
+    }
+    host::parallel_for(n, [&](size_t begin, size_t end) {
+        std::fill(first + begin, first + end, value);
+    });
+}
+
+/**
+ * @brief Check whether two pointer ranges share any byte
+ */
+template<typename T, typename U>
+bool ranges_overlap(const T* first, size_t n, const U* d_first) {
+    std::less<const void*> before;
+    const void* src_begin = first;
+    const void* src_end = first + n;
+    const void* dst_begin = d_first;
+    const void* dst_end = d_first + n;
+    return before(src_begin, dst_end) && before(dst_begin, src_end);
+}
+
+/**
+ * @brief Copy [first, last) to d_first
+ *
+ * Pointer destinations are filled in parallel chunks unless they overlap
+ * the source, e.g. when shifting elements within one vector. Overlapping
+ * ranges are copied sequentially in the direction that reads every element
+ * before it is overwritten.
+ */
+template<typename T, typename OutputIt>
+OutputIt host_copy(const T* first, const T* last, OutputIt d_first) {
+    size_t n = static_cast<size_t>(last - first);
+    if constexpr (std::is_pointer<OutputIt>::value) {
+        if (n > 0 && ranges_overlap(first, n, d_first)) {
+            using out_type = std::remove_pointer_t<OutputIt>;
+            if constexpr (std::is_same<std::remove_cv_t<out_type>, T>::value &&
+                          std::is_trivially_copyable<T>::value) {
+                std::memmove(d_first, first, n * sizeof(T));
+                return d_first + n;
+            } else {
+                if (std::less<const void*>()(first, d_first)) {
+                    return std::copy_backward(first, last, d_first + n) + n;
+                }
+                return std::copy(first, last, d_first);
+            }
+        }
+        if (host::should_parallelize(n)) {
+            host::parallel_for(n, [&](size_t begin, size_t end) {
+                std::copy(first + begin, first + end, d_first + begin);
+            });
+            return d_first + n;
+        }
+    }
+    return std::copy(first, last, d_first);
+}
+
+template<typename T, typename V>
+const T* host_find(const T* first, const T* last, const V& value) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        return std::find(first, last, value);
+    }
+
+    // Chunks after the best match found so far skip their search
+    std::atomic<size_t> best(n);
+    host::parallel_for(n, [&](size_t begin, size_t end) {
+        if (begin >= best.load(std::memory_order_relaxed)) return;
+        const T* hit = std::find(first + begin, first + end, value);
+        size_t index = static_cast<size_t>(hit - first);
+        if (hit != first + end) {
+            size_t current = best.load(std::memory_order_relaxed);
+            while (index < current &&
+                   !best.compare_exchange_weak(current, index, std::memory_order_relaxed)) {}
+        }
+    });
+    return first + best.load();
+}
+
+template<typename T, typename V>
+ptrdiff_t host_count(const T* first, const T* last, const V& value) {
+    size_t n = static_cast<size_t>(last - first);
+    if (!host::should_parallelize(n)) {
+        return std::count(first, last, value);
+    }
+    std::atomic<ptrdiff_t> total(0);
+    host::parallel_for(n, [&](size_t begin, size_t end) {
+        total.fetch_add(std::count(first + begin, first + end, value), std::memory_order_relaxed);
+    });
+    return total.load();
+}
+
+template<typename T, typename InputIt2>
+bool host_equal(const T* first1, const T* last1, InputIt2 first2) {
+    size_t n = static_cast<size_t>(last1 - first1);
+    if constexpr (std::is_pointer<InputIt2>::value) {
+        if (host::should_parallelize(n)) {
+            std::atomic<bool> equal(true);
+            host::parallel_for(n, [&](size_t begin, size_t end) {
+                if (!equal.load(std::memory_order_relaxed)) return;
+                if (!std::equal(first1 + begin, first1 + end, first2 + begin)) {
+                    equal.store(false, std::memory_order_relaxed);
+                }
+            });
+            return equal.load();
+        }
+    }
+    return std::equal(first1, last1, first2);
+}
+
+/**
+ * @brief Accumulate with the default operator
+ *
+ * Integral sums are reassociated across chunks; other types keep the
+ * strict left-to-right order std::accumulate guarantees.
+ */
+template<typename T, typename Init>
+Init host_accumulate(const T* first, const T* last, Init init) {
+    size_t n = static_cast<size_t>(last - first);
+    if constexpr (std::is_integral<T>::value && std::is_integral<Init>::value &&
+                  !std::is_same<Init, bool>::value) {
+        if (host::should_parallelize(n)) {
+            std::atomic<Init> total{Init()};
+            host::parallel_for(n, [&](size_t begin, size_t end) {
+                total.fetch_add(std::accumulate(first + begin, first + end, Init()),
+                                std::memory_order_relaxed);
+            });
+            return init + total.load();
+        }
+    }
+    return std::accumulate(first, last, init);
+}
+
+// ==================== Output Unwrapping ====================
+
+/**
+ * @brief Access mode for a destination that may lie in the source's vector
+ *
+ * A write-only view need not preserve its range, so a destination in the
+ * vector being read is opened read_write.
+ */
+template<typename It, typename U, typename OutAlloc>
+access output_access(It first, unified_iterator<U, OutAlloc> d_first) {
+    const void* source = first.get_container();
+    const void* destination = d_first.get_container();
+    return source == destination ? access::read_write : access::write;
+}
+
+/**
+ * @brief Copy a raw host range into a unified_vector at d_first
+ *
+ * The source may overlap the destination; see host_copy().
+ */
+template<typename T, typename U, typename OutAlloc>
+unified_iterator<U, OutAlloc> copy_into(const T* first, const T* last, unified_iterator<U, OutAlloc> d_first,
+                                        access mode = access::write) {
+    size_t n = static_cast<size_t>(last - first);
+    if (n == 0) return d_first;
+    auto out = write_view(d_first, d_first + n, mode);
+    host_copy(first, last, out.data());
+    return d_first + n;
+}
+
+/**
+ * @brief Compare a raw host range against any second range
+ */
+template<typename T, typename Alloc, typename InputIt2>
+bool equal_to(const host_view<const T, Alloc>& view, InputIt2 first2) {
+    if constexpr (is_unified_iterator<InputIt2>::value) {
+        if (view.empty()) return true;
+        auto other = read_view(first2, first2 + static_cast<ptrdiff_t>(view.size()));
+        return host_equal(view.begin(), view.end(), other.data());
+    } else {
+        return host_equal(view.begin(), view.end(), first2);
+    }
+}
+
+} // namespace detail
+
+} // namespace vulkan_stdpar
+
+// Inject into std namespace so policy-less calls on unified_vector
+// iterators resolve to these more specialized overloads
+namespace std {
+
+// ==================== sort ====================
+
+template<typename T, typename Alloc>
+void sort(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last) {
+    if (last - first <= 1) return;
+    auto view = vulkan_stdpar::detail::write_view(first, last, vulkan_stdpar::access::read_write);
+    vulkan_stdpar::detail::host_sort(view.begin(), view.end(), std::less<T>());
+}
+
+template<typename T, typename Alloc, typename Compare>
+void sort(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+          Compare comp) {
+    if (last - first <= 1) return;
+    auto view = vulkan_stdpar::detail::write_view(first, last, vulkan_stdpar::access::read_write);
+    vulkan_stdpar::detail::host_sort(view.begin(), view.end(), comp);
+}
+
+// ==================== accumulate ====================
+
+template<typename T, typename Alloc, typename Init>
+Init accumulate(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                vulkan_stdpar::const_unified_iterator<T, Alloc> last, Init init) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_accumulate(view.begin(), view.end(), init);
+}
+
+template<typename T, typename Alloc, typename Init>
+Init accumulate(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                vulkan_stdpar::unified_iterator<T, Alloc> last, Init init) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_accumulate(view.begin(), view.end(), init);
+}
+
+template<typename T, typename Alloc, typename Init, typename BinaryOp>
+Init accumulate(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                vulkan_stdpar::const_unified_iterator<T, Alloc> last, Init init, BinaryOp op) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return std::accumulate(view.begin(), view.end(), std::move(init), op);
+}
+
+template<typename T, typename Alloc, typename Init, typename BinaryOp>
+Init accumulate(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                vulkan_stdpar::unified_iterator<T, Alloc> last, Init init, BinaryOp op) {
+    if (first == last) return init;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return std::accumulate(view.begin(), view.end(), std::move(init), op);
+}
+
+// ==================== fill ====================
+
+template<typename T, typename Alloc, typename V>
+void fill(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+          const V& value) {
+    if (first == last) return;
+    auto view = vulkan_stdpar::detail::write_view(first, last, vulkan_stdpar::access::write);
+    vulkan_stdpar::detail::host_fill(view.begin(), view.end(), value);
+}
+
+// ==================== find ====================
+
+template<typename T, typename Alloc, typename V>
+vulkan_stdpar::unified_iterator<T, Alloc> find(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                                        vulkan_stdpar::unified_iterator<T, Alloc> last, const V& value) {
+    if (first == last) return last;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return first + (vulkan_stdpar::detail::host_find(view.begin(), view.end(), value) - view.begin());
+}
+
+template<typename T, typename Alloc, typename V>
+vulkan_stdpar::const_unified_iterator<T, Alloc> find(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                                              vulkan_stdpar::const_unified_iterator<T, Alloc> last,
+                                              const V& value) {
+    if (first == last) return last;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return first + (vulkan_stdpar::detail::host_find(view.begin(), view.end(), value) - view.begin());
+}
+
+// ==================== count ====================
+
+template<typename T, typename Alloc, typename V>
+ptrdiff_t count(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+                const V& value) {
+    if (first == last) return 0;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_count(view.begin(), view.end(), value);
+}
+
+template<typename T, typename Alloc, typename V>
+ptrdiff_t count(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                vulkan_stdpar::const_unified_iterator<T, Alloc> last, const V& value) {
+    if (first == last) return 0;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_count(view.begin(), view.end(), value);
+}
+
+// ==================== equal ====================
+
+template<typename T, typename Alloc, typename InputIt2>
+bool equal(vulkan_stdpar::unified_iterator<T, Alloc> first1, vulkan_stdpar::unified_iterator<T, Alloc> last1,
+           InputIt2 first2) {
+    if (first1 == last1) return true;
+    auto view = vulkan_stdpar::detail::read_view(first1, last1);
+    return vulkan_stdpar::detail::equal_to(view, first2);
+}
+
+template<typename T, typename Alloc, typename InputIt2>
+bool equal(vulkan_stdpar::const_unified_iterator<T, Alloc> first1,
+           vulkan_stdpar::const_unified_iterator<T, Alloc> last1, InputIt2 first2) {
+    if (first1 == last1) return true;
+    auto view = vulkan_stdpar::detail::read_view(first1, last1);
+    return vulkan_stdpar::detail::equal_to(view, first2);
+}
+
+// ==================== copy ====================
+
+template<typename T, typename Alloc, typename OutputIt>
+OutputIt copy(vulkan_stdpar::unified_iterator<T, Alloc> first, vulkan_stdpar::unified_iterator<T, Alloc> last,
+              OutputIt d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_copy(view.begin(), view.end(), d_first);
+}
+
+template<typename T, typename Alloc, typename OutputIt>
+OutputIt copy(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+              vulkan_stdpar::const_unified_iterator<T, Alloc> last, OutputIt d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::host_copy(view.begin(), view.end(), d_first);
+}
+
+template<typename T, typename Alloc, typename U, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> copy(vulkan_stdpar::unified_iterator<T, Alloc> first,
+                                        vulkan_stdpar::unified_iterator<T, Alloc> last,
+                                        vulkan_stdpar::unified_iterator<U, OutAlloc> d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::copy_into(view.begin(), view.end(), d_first,
+                                            vulkan_stdpar::detail::output_access(first, d_first));
+}
+
+template<typename T, typename Alloc, typename U, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> copy(vulkan_stdpar::const_unified_iterator<T, Alloc> first,
+                                        vulkan_stdpar::const_unified_iterator<T, Alloc> last,
+                                        vulkan_stdpar::unified_iterator<U, OutAlloc> d_first) {
+    if (first == last) return d_first;
+    auto view = vulkan_stdpar::detail::read_view(first, last);
+    return vulkan_stdpar::detail::copy_into(view.begin(), view.end(), d_first,
+                                            vulkan_stdpar::detail::output_access(first, d_first));
+}
+
+template<typename InputIt, typename U, typename OutAlloc>
+vulkan_stdpar::unified_iterator<U, OutAlloc> copy(InputIt first, InputIt last,
+                                        vulkan_stdpar::unified_iterator<U, OutAlloc> d_first) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_pointer<InputIt>::value) {
+        return vulkan_stdpar::detail::copy_into(first, last, d_first);
+    } else if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+        auto n = std::distance(first, last);
+        if (n <= 0) return d_first;
+        auto out = vulkan_stdpar::detail::write_view(d_first, d_first + n, vulkan_stdpar::access::write);
+        std::copy(first, last, out.data());
+        return d_first + n;
+    } else {
+        // Single-pass input: length unknown up front, write through proxies
+        for (; first != last; ++first, ++d_first) {
+            *d_first = *first;
+        }
+        return d_first;
+    }
+}
+
+} // namespace std
+
+#endif // VULKAN_STDPAR_ALGORITHMS_STD_OVERLOADS_HPP
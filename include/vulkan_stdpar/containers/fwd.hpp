@@ -0,0 +1,27 @@
+/**
+ * @file fwd.hpp
+ * @brief Forward declarations for unified containers and iterators
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file declares the container, reference and iterator templates once,
+ * together with their default allocator arguments, so that headers which
+ * refer to each other can be included in any order.
+ */
+
+#ifndef VULKAN_STDPAR_CONTAINERS_FWD_HPP
+#define VULKAN_STDPAR_CONTAINERS_FWD_HPP
+
+#include <memory>
+
+namespace vulkan_stdpar {
+
+template<typename T, typename Alloc = std::allocator<T>> class unified_vector;
+template<typename T, typename Alloc = std::allocator<T>> class unified_reference;
+template<typename T, typename Alloc = std::allocator<T>> class unified_iterator;
+template<typename T, typename Alloc = std::allocator<T>> class const_unified_iterator;
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CONTAINERS_FWD_HPP
@@ -0,0 +1,262 @@
+/**
+ * @file host_view.hpp
+ * @brief Scoped bulk host access to unified_vector storage
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file implements host_view, an RAII object that synchronizes a
+ * unified_vector to the host once and exposes a raw pointer range for
+ * vectorizable loops, marking the declared range dirty on destruction.
+ */
+
+#ifndef VULKAN_STDPAR_CONTAINERS_HOST_VIEW_HPP
+#define VULKAN_STDPAR_CONTAINERS_HOST_VIEW_HPP
+
+#include "../core/exceptions.hpp"
+#include "unified_vector.hpp"
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Declared access intent for a host_view
+ */
+enum class access {
+    read,           ///< Elements are only read
+    write,          ///< Elements are written (declared range marked dirty)
+    read_write      ///< Elements are read and written (declared range marked dirty)
+};
+
+/**
+ * @brief Scoped raw-pointer view over a range of a unified_vector
+ *
+ * Construction synchronizes the vector to the host once; element access is
+ * then a plain pointer dereference with no locking or per-element dirty
+ * tracking. On destruction, views opened with access::write or
+ * access::read_write mark exactly [first, last) as host dirty. An
+ * access::write view of the whole vector drops a device-dirty copy instead
+ * of downloading it.
+ *
+ * Read-only views are host_view<const T>, deduced for const vectors and
+ * returned by read_view() for any vector, so their elements cannot be
+ * written through the view.
+ *
+ * The view does not hold the engine lock. Growing, shrinking or running a
+ * device algorithm on the vector while a view is alive invalidates it, as
+ * does writing to a copy-on-write vector that still shares its storage.
+ * Copies of a vector with a writable view open never share storage.
+ *
+ * @tparam T Element type (const-qualified for read-only views)
+ * @tparam Alloc Allocator of the viewed container
+ */
+template<typename T, typename Alloc = std::allocator<std::remove_cv_t<T>>>
+class host_view {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+    using container_type = std::conditional_t<std::is_const<T>::value,
+                                              const unified_vector<value_type, Alloc>,
+                                              unified_vector<value_type, Alloc>>;
+
+private:
+    container_type* container_;    ///< Viewed container (nullptr when moved-from)
+    pointer data_;                 ///< First element of the view
+    size_type first_;              ///< Start index in the container
+    size_type count_;              ///< Number of elements in the view
+    access mode_;                  ///< Declared access intent
+
+public:
+    /**
+     * @brief View the whole vector
+     * @param vec Vector to view
+     * @param mode Declared access intent
+     */
+    explicit host_view(container_type& vec, access mode = default_mode())
+        : host_view(vec, mode, 0, vec.size())
+    {}
+
+    /**
+     * @brief View the index range [first, last) of a vector
+     * @param vec Vector to view
+     * @param mode Declared access intent
+     * @param first Start index (inclusive)
+     * @param last End index (exclusive)
+     * @throws std::out_of_range if the range exceeds the vector size
+     * @throws invalid_argument_exception if mode is access::read for non-const T,
+     *         or not access::read for const T
+     */
+    host_view(container_type& vec, access mode, size_type first, size_type last)
+        : container_(&vec)
+        , data_(nullptr)
+        , first_(first)
+        , count_(0)
+        , mode_(mode)
+    {
+        if (first > last || last > vec.size()) {
+            throw std::out_of_range("host_view: range out of bounds");
+        }
+
+        // A single sync covers every access through the view
+        if constexpr (std::is_const<T>::value) {
+            if (mode != access::read) {
+                throw invalid_argument_exception("mode", "host_view<const T> only supports access::read");
+            }
+            const auto& engine = vec.get_engine();
+            engine.sync_to_host();
+            data_ = engine.host_data() + first;
+        } else {
+            if (mode == access::read) {
+                throw invalid_argument_exception("mode", "read-only views are host_view<const T>; see read_view()");
+            }
+            // Non-const get_engine() detaches copy-on-write storage
+            auto& engine = vec.get_engine();
+            if (mode == access::write && first == 0 && last == vec.size()) {
+                // Every element is overwritten; nothing on the device is worth downloading
+                engine.discard_device_copy();
+            } else {
+                // Device-dirty data outside the written range must not be lost
+                engine.sync_to_host();
+            }
+            engine.retain_host_writer();
+            data_ = engine.host_data() + first;
+        }
+        count_ = last - first;
+    }
+
+    /**
+     * @brief Destructor - marks the declared range dirty for writable views
+     */
+    ~host_view() {
+        release();
+    }
+
+    // Non-copyable but movable
+    host_view(const host_view&) = delete;
+    host_view& operator=(const host_view&) = delete;
+
+    host_view(host_view&& other) noexcept
+        : container_(other.container_)
+        , data_(other.data_)
+        , first_(other.first_)
+        , count_(other.count_)
+        , mode_(other.mode_)
+    {
+        other.container_ = nullptr;
+    }
+
+    host_view& operator=(host_view&& other) noexcept {
+        if (this != &other) {
+            release();
+            container_ = other.container_;
+            data_ = other.data_;
+            first_ = other.first_;
+            count_ = other.count_;
+            mode_ = other.mode_;
+            other.container_ = nullptr;
+        }
+        return *this;
+    }
+
+    // ==================== Span Interface ====================
+
+    pointer data() const noexcept { return data_; }
+    size_type size() const noexcept { return count_; }
+    size_type size_bytes() const noexcept { return count_ * sizeof(T); }
+    bool empty() const noexcept { return count_ == 0; }
+
+    iterator begin() const noexcept { return data_; }
+    iterator end() const noexcept { return data_ + count_; }
+
+    reference operator[](size_type pos) const noexcept { return data_[pos]; }
+    reference front() const noexcept { return data_[0]; }
+    reference back() const noexcept { return data_[count_ - 1]; }
+
+    /**
+     * @brief Get the container index of the first viewed element
+     * @return Start index
+     */
+    size_type offset() const noexcept { return first_; }
+
+    /**
+     * @brief Get the declared access intent
+     * @return Access mode
+     */
+    access mode() const noexcept { return mode_; }
+
+private:
+    static constexpr access default_mode() {
+        return std::is_const<T>::value ? access::read : access::read_write;
+    }
+
+    /**
+     * @brief Publish writes and detach from the container
+     */
+    void release() {
+        if constexpr (!std::is_const<T>::value) {
+            if (container_ && mode_ != access::read) {
+                auto& engine = container_->get_engine();
+                if (count_ > 0) engine.mark_host_dirty(first_, first_ + count_);
+                engine.release_host_writer();
+            }
+        }
+        container_ = nullptr;
+    }
+};
+
+// ==================== Factories ====================
+
+/**
+ * @brief Open a read-only view of a vector, whether or not it is const
+ * @param vec Vector to view
+ * @return View over const elements
+ */
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(const unified_vector<T, Alloc>& vec) {
+    return host_view<const T, Alloc>(vec);
+}
+
+/**
+ * @brief Open a read-only view of the index range [first, last) of a vector
+ * @param vec Vector to view
+ * @param first Start index (inclusive)
+ * @param last End index (exclusive)
+ * @return View over const elements
+ * @throws std::out_of_range if the range exceeds the vector size
+ */
+template<typename T, typename Alloc>
+host_view<const T, Alloc> read_view(const unified_vector<T, Alloc>& vec, size_t first, size_t last) {
+    return host_view<const T, Alloc>(vec, access::read, first, last);
+}
+
+// ==================== Deduction Guides ====================
+
+template<typename T, typename Alloc>
+host_view(unified_vector<T, Alloc>&) -> host_view<T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(unified_vector<T, Alloc>&, access) -> host_view<T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(unified_vector<T, Alloc>&, access, size_t, size_t) -> host_view<T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(const unified_vector<T, Alloc>&) -> host_view<const T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(const unified_vector<T, Alloc>&, access) -> host_view<const T, Alloc>;
+
+template<typename T, typename Alloc>
+host_view(const unified_vector<T, Alloc>&, access, size_t, size_t) -> host_view<const T, Alloc>;
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CONTAINERS_HOST_VIEW_HPP
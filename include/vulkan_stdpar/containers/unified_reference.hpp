@@ -12,14 +12,12 @@
 #ifndef VULKAN_STDPAR_CONTAINERS_UNIFIED_REFERENCE_HPP
 #define VULKAN_STDPAR_CONTAINERS_UNIFIED_REFERENCE_HPP
 
+#include "fwd.hpp"
 #include <type_traits>
 #include <utility>
 
 namespace vulkan_stdpar {
 
-// Forward declaration
-template<typename T> class unified_vector;
-
 /**
  * @brief Proxy reference for unified_vector elements
  * 
@@ -28,16 +26,17 @@ template<typename T> class unified_vector;
  * for reads while marking the host as dirty on writes.
  * 
  * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
  */
-template<typename T>
+template<typename T, typename Alloc>
 class unified_reference {
 private:
-    unified_vector<T>* container_;     ///< Parent container
+    unified_vector<T, Alloc>* container_;  ///< Parent container
     size_t index_;                      ///< Element index
     
     // Friend declarations
-    template<typename U> friend class unified_vector;
-    template<typename U> friend class unified_iterator;
+    template<typename U, typename A> friend class unified_vector;
+    template<typename U, typename A> friend class unified_iterator;
     
 public:
     /**
@@ -45,7 +44,7 @@ public:
      * @param container Parent container
      * @param index Element index
      */
-    unified_reference(unified_vector<T>* container, size_t index)
+    unified_reference(unified_vector<T, Alloc>* container, size_t index)
         : container_(container)
         , index_(index)
     {}
@@ -234,11 +233,12 @@ public:
 /**
  * @brief Non-member swap for unified_reference
  * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
  * @param lhs Left reference
  * @param rhs Right reference
  */
-template<typename T>
-void swap(unified_reference<T> lhs, unified_reference<T> rhs) noexcept {
+template<typename T, typename Alloc>
+void swap(unified_reference<T, Alloc> lhs, unified_reference<T, Alloc> rhs) noexcept {
     lhs.swap(rhs);
 }
 
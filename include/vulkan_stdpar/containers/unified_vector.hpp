@@ -14,17 +14,44 @@
 
 #include "../core/versioning_engine.hpp"
 #include "../core/exceptions.hpp"
+#include "../core/thread_pool.hpp"
+#include "fwd.hpp"
 #include "unified_reference.hpp"
 #include <vector>
 #include <initializer_list>
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 namespace vulkan_stdpar {
 
-// Forward declarations
-template<typename T> class unified_iterator;
-template<typename T> class const_unified_iterator;
+/**
+ * @brief Tag selecting constructors and resize overloads that leave new elements uninitialized
+ */
+struct no_init_t {
+    explicit no_init_t() = default;
+};
+
+/**
+ * @brief Tag selecting constructors that initialize elements on the device
+ */
+struct on_device_t {
+    explicit on_device_t() = default;
+};
+
+/**
+ * @brief Leave new elements uninitialized; see unified_vector(size_type, no_init_t)
+ */
+inline constexpr no_init_t no_init{};
+
+/**
+ * @brief Initialize elements on the device; see unified_vector(size_type, const T&, on_device_t)
+ */
+inline constexpr on_device_t on_device{};
 
 /**
  * @brief Unified vector with automatic GPU acceleration
@@ -34,31 +61,42 @@ template<typename T> class const_unified_iterator;
  * standard parallel algorithms.
  * 
  * @tparam T Element type (must be trivially copyable)
+ * @tparam Alloc Host storage allocator (std::allocator uses aligned/mmap storage)
  */
-template<typename T>
+template<typename T, typename Alloc>
 class unified_vector {
 public:
     // Type definitions (match std::vector)
     using value_type = T;
+    using allocator_type = Alloc;
     using size_type = size_t;
     using difference_type = ptrdiff_t;
-    using reference = unified_reference<T>;
+    using reference = unified_reference<T, Alloc>;
     using const_reference = const T&;
     using pointer = void;  // Disabled to prevent pointer escape
     using const_pointer = const T*;
-    using iterator = unified_iterator<T>;
-    using const_iterator = const_unified_iterator<T>;
+    using iterator = unified_iterator<T, Alloc>;
+    using const_iterator = const_unified_iterator<T, Alloc>;
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     
 private:
-    versioning_engine<T> engine_;     ///< Memory state management
-    size_type size_;                   ///< Current element count
+    using alloc_traits = std::allocator_traits<Alloc>;
+    using engine_type = versioning_engine<T, Alloc>;
+    
+    /// Empty vectors share one engine, so moving never allocates
+    static constexpr bool shares_empty_engine =
+        std::is_default_constructible<Alloc>::value && alloc_traits::is_always_equal::value;
+    
+    std::shared_ptr<engine_type> engine_;  ///< Memory state management (shared by copy-on-write copies)
+    size_type size_;                       ///< Current element count
     
     // Friend declarations
-    template<typename U> friend class unified_reference;
-    template<typename U> friend class unified_iterator;
-    template<typename U> friend class const_unified_iterator;
+    template<typename U, typename A> friend class unified_reference;
+    template<typename U, typename A> friend class unified_iterator;
+    template<typename U, typename A> friend class const_unified_iterator;
+    template<typename U, typename A, typename... Rest>
+    friend unified_vector<U, A> concat(const unified_vector<U, A>& first, const Rest&... rest);
     
 public:
     // ==================== Constructors ====================
@@ -66,27 +104,86 @@ public:
     /**
      * @brief Default constructor
      */
-    unified_vector() : engine_(0), size_(0) {}
+    unified_vector() : engine_(empty_engine(Alloc())), size_(0) {}
+    
+    /**
+     * @brief Construct empty vector with allocator
+     * @param alloc Host storage allocator
+     */
+    explicit unified_vector(const Alloc& alloc)
+        : engine_(make_engine(0, storage_options(), alloc)), size_(0) {}
+    
+    /**
+     * @brief Construct empty vector with host storage configuration
+     * @param options Host storage options (alignment, huge pages, copy-on-write)
+     * @param alloc Host storage allocator
+     */
+    explicit unified_vector(const storage_options& options, const Alloc& alloc = Alloc())
+        : engine_(make_engine(0, options, alloc)), size_(0) {}
     
     /**
      * @brief Construct with size
      * @param count Number of elements
+     * @param alloc Host storage allocator
      */
-    explicit unified_vector(size_type count)
-        : engine_(count), size_(count)
+    explicit unified_vector(size_type count, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
     {
-        std::fill_n(data_impl(), count, T());
+        initialize_fill(data_impl(), count, T());
     }
     
     /**
      * @brief Construct with size and value
      * @param count Number of elements
      * @param value Initial value
+     * @param alloc Host storage allocator
      */
-    unified_vector(size_type count, const T& value)
-        : engine_(count), size_(count)
+    unified_vector(size_type count, const T& value, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
     {
-        std::fill_n(data_impl(), count, value);
+        initialize_fill(data_impl(), count, value);
+    }
+    
+    /**
+     * @brief Construct with size, leaving elements uninitialized
+     * 
+     * Host memory is neither written nor uploaded: elements hold
+     * indeterminate values until written, on the host or by an algorithm.
+     * Use for outputs that are overwritten in full. Types that are not
+     * trivially default constructible are value-initialized instead.
+     * 
+     * @param count Number of elements
+     * @param tag no_init
+     * @param alloc Host storage allocator
+     */
+    unified_vector(size_type count, no_init_t tag, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
+    {
+        (void)tag;
+        if constexpr (std::is_trivially_default_constructible<T>::value) {
+            engine_->discard_range(0, count);
+        } else {
+            initialize_fill(data_impl(), count, T());
+        }
+    }
+    
+    /**
+     * @brief Construct with size and value, filled on the device
+     * 
+     * The elements are set by a device fill and start device-dirty; host
+     * memory is not written and nothing is transferred until host access.
+     * Without a device the host storage is filled instead.
+     * 
+     * @param count Number of elements
+     * @param value Initial value
+     * @param tag on_device
+     * @param alloc Host storage allocator
+     */
+    unified_vector(size_type count, const T& value, on_device_t tag, const Alloc& alloc = Alloc())
+        : engine_(make_engine(count, storage_options(), alloc)), size_(count)
+    {
+        (void)tag;
+        engine_->fill_device(0, count, value);
     }
     
     /**
@@ -94,21 +191,24 @@ public:
      * @tparam InputIt Iterator type
      * @param first Beginning of range
      * @param last End of range
+     * @param alloc Host storage allocator
      */
-    template<typename InputIt>
-    unified_vector(InputIt first, InputIt last)
-        : engine_(std::distance(first, last))
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    unified_vector(InputIt first, InputIt last, const Alloc& alloc = Alloc())
+        : engine_(make_engine(std::distance(first, last), storage_options(), alloc))
         , size_(std::distance(first, last))
     {
-        std::copy(first, last, data_impl());
+        initialize_copy(first, last, data_impl());
     }
     
     /**
      * @brief Construct from initializer list
      * @param init Initializer list
+     * @param alloc Host storage allocator
      */
-    unified_vector(std::initializer_list<T> init)
-        : engine_(init.size())
+    unified_vector(std::initializer_list<T> init, const Alloc& alloc = Alloc())
+        : engine_(make_engine(init.size(), storage_options(), alloc))
         , size_(init.size())
     {
         std::copy(init.begin(), init.end(), data_impl());
@@ -116,46 +216,100 @@ public:
     
     /**
      * @brief Copy constructor
+     * 
+     * If other was created with storage_options::copy_on_write, the copy
+     * shares its host and device storage until either vector is written.
+     * Sharers may then be used on different threads, but as with any
+     * container, copying a vector is a read of it and must not race with
+     * a write to that same vector.
+     * 
      * @param other Vector to copy
      */
     unified_vector(const unified_vector& other)
-        : engine_(other.size_)
-        , size_(other.size_)
+        : size_(other.size_)
     {
-        // Sync other to host first
-        other.engine_.sync_to_host();
-        std::copy_n(other.data_impl(), size_, data_impl());
+        Alloc alloc = alloc_traits::select_on_container_copy_construction(other.get_allocator());
+        if (other.shares_on_copy(alloc)) {
+            engine_ = other.engine_;
+            return;
+        }
+        engine_ = make_engine(size_, other.engine_->get_storage_options(), alloc);
+        copy_elements(*other.engine_, *engine_, size_);
     }
     
     /**
      * @brief Move constructor
+     * 
+     * Not noexcept for stateful allocators: the moved-from vector needs a
+     * new empty engine holding its allocator.
+     * 
      * @param other Vector to move
      */
-    unified_vector(unified_vector&& other) noexcept
-        : engine_(std::move(other.engine_))
+    unified_vector(unified_vector&& other) noexcept(shares_empty_engine)
+        : engine_(std::exchange(other.engine_, empty_engine(other.get_allocator())))
         , size_(other.size_)
     {
         other.size_ = 0;
     }
     
+    /**
+     * @brief Map a file of raw elements into a vector
+     * 
+     * The vector holds the elements in [offset, offset + length) of the
+     * file. Pages are read on first access rather than copied up front,
+     * and device uploads read straight from the mapping. With
+     * map_mode::read_write, modifications and growth go to the file:
+     * flush() forces them to disk, and the file is trimmed to size() when
+     * the vector is destroyed.
+     * 
+     * @param path File to map
+     * @param mode Whether modifications reach the file
+     * @param offset Byte offset of the first element (multiple of alignof(T))
+     * @param length Bytes to map (default: to the end of the file)
+     * @return Vector backed by the mapping
+     * @throws io_exception if the file cannot be opened or mapped
+     */
+    static unified_vector map_file(const std::string& path, map_mode mode = map_mode::read_only,
+                                   size_t offset = 0, size_t length = static_cast<size_t>(-1)) {
+        unified_vector vec{storage_options()};
+        vec.engine_->map_file(path, mode, offset, length);
+        vec.size_ = vec.engine_->capacity();
+        return vec;
+    }
+    
     /**
      * @brief Destructor
      */
-    ~unified_vector() = default;
+    ~unified_vector() {
+        close_mapping();
+    }
     
     // ==================== Assignment ====================
     
     /**
      * @brief Copy assignment
+     * 
+     * Shares other's storage under the same conditions as the copy
+     * constructor; otherwise copies into storage configured like this
+     * vector's.
+     * 
      * @param other Vector to copy
      * @return Reference to this
      */
     unified_vector& operator=(const unified_vector& other) {
         if (this != &other) {
-            other.engine_.sync_to_host();
-            engine_ = versioning_engine<T>(other.size_);
+            close_mapping();
+            Alloc alloc = alloc_traits::propagate_on_container_copy_assignment::value
+                              ? other.get_allocator() : get_allocator();
+            if (other.shares_on_copy(alloc)) {
+                engine_ = other.engine_;
+                size_ = other.size_;
+                return *this;
+            }
+            auto copy = make_engine(other.size_, engine_->get_storage_options(), alloc);
+            copy_elements(*other.engine_, *copy, other.size_);
+            engine_ = std::move(copy);
             size_ = other.size_;
-            std::copy_n(other.data_impl(), size_, data_impl());
         }
         return *this;
     }
@@ -165,9 +319,19 @@ public:
      * @param other Vector to move
      * @return Reference to this
      */
-    unified_vector& operator=(unified_vector&& other) noexcept {
+    unified_vector& operator=(unified_vector&& other) noexcept(shares_empty_engine) {
         if (this != &other) {
-            engine_ = std::move(other.engine_);
+            close_mapping();
+            if (!alloc_traits::propagate_on_container_move_assignment::value &&
+                get_allocator() != other.get_allocator()) {
+                // Storage cannot change hands; copy into memory from our allocator
+                auto copy = make_engine(other.size_, engine_->get_storage_options(), get_allocator());
+                copy_elements(*other.engine_, *copy, other.size_);
+                engine_ = std::move(copy);
+                size_ = other.size_;
+                return *this;
+            }
+            engine_ = std::exchange(other.engine_, empty_engine(other.get_allocator()));
             size_ = other.size_;
             other.size_ = 0;
         }
@@ -193,12 +357,13 @@ public:
     template<typename InputIt>
     void assign(InputIt first, InputIt last) {
         size_type new_size = std::distance(first, last);
+        detach(new_size, false);
         if (new_size > capacity()) {
-            engine_.resize(new_size);
+            engine_->resize(new_size);
         }
         size_ = new_size;
-        std::copy(first, last, data_impl());
-        engine_.mark_host_dirty(0, size_);
+        initialize_copy(first, last, data_impl());
+        engine_->mark_host_dirty(0, size_);
     }
     
     /**
@@ -207,12 +372,13 @@ public:
      * @param value Value to copy
      */
     void assign(size_type count, const T& value) {
+        detach(count, false);
         if (count > capacity()) {
-            engine_.resize(count);
+            engine_->resize(count);
         }
         size_ = count;
-        std::fill_n(data_impl(), count, value);
-        engine_.mark_host_dirty(0, size_);
+        initialize_fill(data_impl(), count, value);
+        engine_->mark_host_dirty(0, size_);
     }
     
     /**
@@ -223,6 +389,14 @@ public:
         assign(init.begin(), init.end());
     }
     
+    /**
+     * @brief Get host storage allocator
+     * @return Copy of the allocator
+     */
+    allocator_type get_allocator() const {
+        return engine_->get_allocator();
+    }
+    
     // ==================== Element Access ====================
     
     /**
@@ -305,28 +479,29 @@ public:
      * @brief Get pointer to underlying data (const)
      * @return Pointer to data
      */
-    const T* data() const noexcept {
-        engine_.sync_to_host();
+    const T* data() const {
+        engine_->sync_to_host();
         return data_impl();
     }
     
     // ==================== Iterators ====================
     
+    // Const iterators synchronize to host on construction and may throw
     iterator begin() noexcept;
-    const_iterator begin() const noexcept;
-    const_iterator cbegin() const noexcept;
+    const_iterator begin() const;
+    const_iterator cbegin() const;
     
     iterator end() noexcept;
-    const_iterator end() const noexcept;
-    const_iterator cend() const noexcept;
+    const_iterator end() const;
+    const_iterator cend() const;
     
     reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
-    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
-    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(cend()); }
     
     reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
-    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
-    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(cbegin()); }
     
     // ==================== Capacity ====================
     
@@ -360,7 +535,8 @@ public:
      */
     void reserve(size_type new_cap) {
         if (new_cap > capacity()) {
-            engine_.resize(new_cap);
+            detach(new_cap);
+            if (new_cap > capacity()) engine_->resize(new_cap);
         }
     }
     
@@ -369,7 +545,7 @@ public:
      * @return Capacity
      */
     size_type capacity() const noexcept {
-        return engine_.capacity();
+        return engine_->capacity();
     }
     
     /**
@@ -377,7 +553,7 @@ public:
      */
     void shrink_to_fit() {
         if (size_ < capacity()) {
-            engine_.resize(size_);
+            engine_->resize(size_);
         }
     }
     
@@ -388,16 +564,28 @@ public:
      */
     void clear() noexcept {
         size_ = 0;
-        engine_.clear_dirty_ranges();
+        if (owns_engine()) engine_->clear_dirty_ranges();
     }
     
     /**
      * @brief Insert element at position
+     * 
+     * Every insert resolves pos to an index. A const_iterator has already
+     * synchronized the vector to host when it was created; pass an
+     * iterator (e.g. begin() + i) to keep device-resident data on the
+     * device.
+     * 
      * @param pos Position to insert at
      * @param value Value to insert
      * @return Iterator to inserted element
      */
-    iterator insert(const_iterator pos, const T& value);
+    iterator insert(const_iterator pos, const T& value) {
+        return insert_fill(pos.get_index(), 1, value);
+    }
+    
+    iterator insert(iterator pos, const T& value) {
+        return insert_fill(pos.get_index(), 1, value);
+    }
     
     /**
      * @brief Insert element at position (move)
@@ -405,7 +593,86 @@ public:
      * @param value Value to insert
      * @return Iterator to inserted element
      */
-    iterator insert(const_iterator pos, T&& value);
+    iterator insert(const_iterator pos, T&& value) {
+        return insert_value(pos.get_index(), std::move(value));
+    }
+    
+    iterator insert(iterator pos, T&& value) {
+        return insert_value(pos.get_index(), std::move(value));
+    }
+    
+    /**
+     * @brief Insert count copies of value at position
+     * 
+     * Like the range overloads, this grows storage at most once and moves
+     * the tail once. If the newest data is on the device, the tail moves
+     * there and only the new elements are uploaded.
+     * 
+     * @param pos Position to insert at
+     * @param count Number of copies
+     * @param value Value to insert
+     * @return Iterator to the first inserted element
+     */
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        return insert_fill(pos.get_index(), count, value);
+    }
+    
+    iterator insert(iterator pos, size_type count, const T& value) {
+        return insert_fill(pos.get_index(), count, value);
+    }
+    
+    /**
+     * @brief Insert a range at position
+     * 
+     * Ranges of another unified_vector are copied device to device when
+     * both vectors' newest data is on the device.
+     * 
+     * @tparam InputIt Iterator type (must not point into this vector)
+     * @param pos Position to insert at
+     * @param first Beginning of range
+     * @param last End of range
+     * @return Iterator to the first inserted element
+     */
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        return insert_range(pos.get_index(), first, last);
+    }
+    
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    iterator insert(iterator pos, InputIt first, InputIt last) {
+        return insert_range(pos.get_index(), first, last);
+    }
+    
+    /**
+     * @brief Insert an initializer list at position
+     * @param pos Position to insert at
+     * @param init Elements to insert
+     * @return Iterator to the first inserted element
+     */
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert_range(pos.get_index(), init.begin(), init.end());
+    }
+    
+    iterator insert(iterator pos, std::initializer_list<T> init) {
+        return insert_range(pos.get_index(), init.begin(), init.end());
+    }
+    
+    /**
+     * @brief Append the elements of a range
+     * @tparam Range Type with std::begin/std::end, e.g. a container or unified_vector
+     * @param range Elements to append
+     */
+    template<typename Range>
+    void append_range(const Range& range) {
+        if constexpr (std::is_same<Range, unified_vector>::value) {
+            // Neither vector is synchronized to host unless the copy needs it
+            insert_from(size_, range, 0, range.size());
+        } else {
+            insert_range(size_, std::begin(range), std::end(range));
+        }
+    }
     
     /**
      * @brief Erase element at position
@@ -427,12 +694,13 @@ public:
      * @param value Value to add
      */
     void push_back(const T& value) {
+        detach();
         if (size_ >= capacity()) {
             size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
             reserve(new_cap);
         }
         data_impl()[size_] = value;
-        engine_.mark_host_dirty(size_, size_ + 1);
+        engine_->mark_host_dirty(size_, size_ + 1);
         ++size_;
     }
     
@@ -441,12 +709,13 @@ public:
      * @param value Value to add
      */
     void push_back(T&& value) {
+        detach();
         if (size_ >= capacity()) {
             size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
             reserve(new_cap);
         }
         data_impl()[size_] = std::move(value);
-        engine_.mark_host_dirty(size_, size_ + 1);
+        engine_->mark_host_dirty(size_, size_ + 1);
         ++size_;
     }
     
@@ -458,12 +727,13 @@ public:
      */
     template<typename... Args>
     reference emplace_back(Args&&... args) {
+        detach();
         if (size_ >= capacity()) {
             size_type new_cap = capacity() == 0 ? 1 : capacity() * 2;
             reserve(new_cap);
         }
         new (&data_impl()[size_]) T(std::forward<Args>(args)...);
-        engine_.mark_host_dirty(size_, size_ + 1);
+        engine_->mark_host_dirty(size_, size_ + 1);
         return reference(this, size_++);
     }
     
@@ -490,12 +760,37 @@ public:
      * @param value Value for new elements
      */
     void resize(size_type count, const T& value) {
+        if (count > size_) detach(count);
         if (count > capacity()) {
             reserve(count);
         }
         if (count > size_) {
-            std::fill_n(data_impl() + size_, count - size_, value);
-            engine_.mark_host_dirty(size_, count);
+            initialize_fill(data_impl() + size_, count - size_, value);
+            engine_->mark_host_dirty(size_, count);
+        }
+        size_ = count;
+    }
+    
+    /**
+     * @brief Resize vector, leaving new elements uninitialized
+     * 
+     * New elements hold indeterminate values and are not uploaded to the
+     * device until written. Types that are not trivially default
+     * constructible are value-initialized instead.
+     * 
+     * @param count New size
+     * @param tag no_init
+     */
+    void resize(size_type count, no_init_t tag) {
+        (void)tag;
+        if constexpr (!std::is_trivially_default_constructible<T>::value) {
+            resize(count);
+            return;
+        }
+        if (count > size_) {
+            detach(count);
+            if (count > capacity()) reserve(count);
+            engine_->discard_range(size_, count);
         }
         size_ = count;
     }
@@ -512,11 +807,17 @@ public:
     // ==================== Internal Implementation ====================
     
 private:
+    /**
+     * @brief Adopt an engine holding size initialized elements
+     */
+    unified_vector(std::shared_ptr<engine_type> engine, size_type size) noexcept
+        : engine_(std::move(engine)), size_(size) {}
+    
     /**
      * @brief Get element value (implementation)
      */
     const T& at_impl(size_type index) const {
-        engine_.sync_to_host();
+        engine_->sync_to_host();
         return data_impl()[index];
     }
     
@@ -524,32 +825,236 @@ private:
      * @brief Set element value (implementation)
      */
     void set_impl(size_type index, const T& value) {
-        engine_.sync_to_host();
+        detach();
+        engine_->sync_to_host();
         data_impl()[index] = value;
-        engine_.mark_host_dirty(index, index + 1);
+        engine_->mark_host_dirty(index, index + 1);
     }
     
     /**
      * @brief Set element value (implementation, move)
      */
     void set_impl(size_type index, T&& value) {
-        engine_.sync_to_host();
+        detach();
+        engine_->sync_to_host();
         data_impl()[index] = std::move(value);
-        engine_.mark_host_dirty(index, index + 1);
+        engine_->mark_host_dirty(index, index + 1);
     }
     
     /**
      * @brief Get data pointer (mutable)
      */
     T* data_impl() {
-        return engine_.host_data();
+        return engine_->host_data();
     }
     
     /**
      * @brief Get data pointer (const)
      */
     const T* data_impl() const {
-        return engine_.host_data();
+        return engine_->host_data();
+    }
+    
+    /**
+     * @brief Create an engine owned by this vector
+     */
+    static std::shared_ptr<engine_type> make_engine(size_type capacity, const storage_options& options,
+                                                    const Alloc& alloc) {
+        // Create the shared empty engine before any vector can be moved from
+        if constexpr (shares_empty_engine) (void)shared_empty_engine();
+        return std::make_shared<engine_type>(capacity, options, alloc);
+    }
+    
+    /**
+     * @brief Get the engine shared by empty vectors
+     * 
+     * Created by the first vector constructed, so later calls (from the
+     * noexcept move operations) do not allocate.
+     */
+    static const std::shared_ptr<engine_type>& shared_empty_engine() {
+        // Never destroyed: vectors with static storage duration may still
+        // hold it after other statics have been torn down
+        static const std::shared_ptr<engine_type>* empty =
+            new std::shared_ptr<engine_type>(std::make_shared<engine_type>(0, storage_options(), Alloc()));
+        return *empty;
+    }
+    
+    /**
+     * @brief Get an empty engine for default-constructed and moved-from vectors
+     * 
+     * With stateless default-constructible allocators all such vectors share
+     * one engine, so neither default construction nor moving allocates; the
+     * first write gives a vector its own engine. Other allocators get a new
+     * empty engine, which is a small allocation.
+     */
+    static std::shared_ptr<engine_type> empty_engine(const Alloc& alloc) {
+        if constexpr (shares_empty_engine) {
+            (void)alloc;
+            return shared_empty_engine();
+        } else {
+            return make_engine(0, storage_options(), alloc);
+        }
+    }
+    
+    /**
+     * @brief Check whether no other vector shares this vector's engine
+     * 
+     * The reference count is read relaxed; the fence orders this vector's
+     * following writes after everything a sharer did before dropping its
+     * reference on another thread.
+     */
+    bool owns_engine() const noexcept {
+        if (engine_.use_count() != 1) return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+    
+    /**
+     * @brief Check whether a copy using alloc may share this vector's storage
+     */
+    bool shares_on_copy(const Alloc& alloc) const {
+        if constexpr (shares_empty_engine) {
+            // Placeholder for empty vectors: share it without touching its lock
+            if (engine_ == shared_empty_engine()) return true;
+        }
+        const engine_type& engine = *engine_;
+        return engine.get_storage_options().copy_on_write && !engine.is_file_mapped() &&
+               !engine.has_host_writers() && alloc == engine.get_allocator();
+    }
+    
+    /**
+     * @brief Give this vector its own storage before a write
+     * 
+     * A no-op unless the engine is shared with copy-on-write copies (or is
+     * the shared empty engine). The new engine has the same configuration.
+     * A device-dirty shared copy is copied on the device, leaving the
+     * other sharers' state alone.
+     * 
+     * @param min_capacity Capacity the new storage needs at least
+     * @param preserve Copy the current elements (false when all are overwritten)
+     */
+    void detach(size_type min_capacity = 0, bool preserve = true) {
+        if (owns_engine()) return;
+        const engine_type& shared = *engine_;
+        auto own = make_engine(std::max(min_capacity, preserve ? shared.capacity() : 0),
+                               shared.get_storage_options(), shared.get_allocator());
+        if (preserve) copy_elements(shared, *own, size_);
+        engine_ = std::move(own);
+    }
+    
+    /**
+     * @brief Copy the first count elements of from into the new engine to
+     * 
+     * A device-dirty source is copied device to device and the new engine
+     * starts device-dirty, so host memory is neither read nor written.
+     * Otherwise the elements are copied on the host.
+     */
+    static void copy_elements(const engine_type& from, engine_type& to, size_type count) {
+        if (count == 0 || to.copy_device_from(from, count)) return;
+        from.sync_to_host();
+        initialize_copy(from.host_data(), from.host_data() + count, to.host_data());
+    }
+    
+    /**
+     * @brief Run fn(begin, end) over [0, count), on the thread pool for large counts
+     * 
+     * Chunks match the partition of host::parallel_for, so with
+     * numa_placement::local the pages of fresh storage are first touched,
+     * and placed, by the threads that later run host algorithms on them.
+     */
+    template<typename Fn>
+    static void initialize_chunks(size_type count, Fn&& fn) {
+        if (host::should_parallelize(count)) {
+            host::parallel_for(count, fn);
+        } else {
+            fn(size_type(0), count);
+        }
+    }
+    
+    /**
+     * @brief Fill out[0, count) with value, in parallel for large counts
+     */
+    static void initialize_fill(T* out, size_type count, const T& value) {
+        initialize_chunks(count, [&](size_type begin, size_type end) {
+            std::fill(out + begin, out + end, value);
+        });
+    }
+    
+    /**
+     * @brief Copy [first, last) to out, in parallel for large random-access ranges
+     */
+    template<typename InputIt>
+    static void initialize_copy(InputIt first, InputIt last, T* out) {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of<std::random_access_iterator_tag, category>::value) {
+            initialize_chunks(static_cast<size_type>(last - first), [&](size_type begin, size_type end) {
+                std::copy(first + begin, first + end, out + begin);
+            });
+        } else {
+            std::copy(first, last, out);
+        }
+    }
+    
+    /**
+     * @brief Make room for count elements at pos
+     * 
+     * Grows at most once, then moves [pos, size()) up by count: on the
+     * device if the newest data is there, otherwise on the host, where the
+     * moved tail is marked dirty. size() includes the gap on return.
+     * 
+     * @return True if the gap was opened on the device; the caller then
+     *         writes the new elements on the host and calls upload_range()
+     */
+    bool open_gap(size_type pos, size_type count) {
+        size_type new_size = size_ + count;
+        detach(new_size);
+        if (new_size > capacity()) {
+            reserve(std::max(new_size, capacity() * 2));
+        }
+        bool on_device = engine_->is_device_resident();
+        if (on_device) {
+            engine_->shift_device_range(pos, size_, pos + count);
+        } else {
+            engine_->sync_to_host();
+            std::copy_backward(data_impl() + pos, data_impl() + size_, data_impl() + new_size);
+            engine_->mark_host_dirty(pos, new_size);
+        }
+        size_ = new_size;
+        return on_device;
+    }
+    
+    /**
+     * @brief Insert value at index pos (move)
+     */
+    iterator insert_value(size_type pos, T&& value);
+    
+    /**
+     * @brief Insert count copies of value at index pos
+     */
+    iterator insert_fill(size_type pos, size_type count, const T& value);
+    
+    /**
+     * @brief Insert [first, last) at index pos
+     */
+    template<typename InputIt>
+    iterator insert_range(size_type pos, InputIt first, InputIt last);
+    
+    /**
+     * @brief Insert count elements of source starting at index start
+     */
+    iterator insert_from(size_type pos, const unified_vector& source, size_type start, size_type count);
+    
+    /**
+     * @brief Unmap a file-backed vector, trimming the file to size()
+     */
+    void close_mapping() noexcept {
+        if (!owns_engine() || !engine_->is_file_mapped()) return;
+        try {
+            engine_->close_file(size_);
+        } catch (...) {
+            // Device write-back failed; the file keeps its last host contents
+        }
+        size_ = 0;
     }
     
 public:
@@ -559,23 +1064,46 @@ public:
      * @brief Prefetch data to device
      */
     void prefetch_to_device() {
-        engine_.sync_to_device();
+        engine_->sync_to_device();
+    }
+    
+    /**
+     * @brief Write device results back and msync a read_write file mapping
+     */
+    void flush() {
+        engine_->flush_file();
     }
     
     /**
      * @brief Get versioning engine for GPU operations
+     * 
+     * Callers may write through the engine, so a vector sharing storage
+     * with copy-on-write copies gets its own storage first.
+     * 
      * @return Reference to versioning engine
      */
-    versioning_engine<T>& get_engine() {
-        return engine_;
+    versioning_engine<T, Alloc>& get_engine() {
+        detach();
+        return *engine_;
     }
     
     /**
-     * @brief Get versioning engine (const)
+     * @brief Get versioning engine for reading (const)
+     * 
+     * Does not detach: the engine may be shared with copy-on-write copies.
+     * 
      * @return Const reference to versioning engine
      */
-    const versioning_engine<T>& get_engine() const {
-        return engine_;
+    const versioning_engine<T, Alloc>& get_engine() const {
+        return *engine_;
+    }
+    
+    /**
+     * @brief Check whether storage is shared with copy-on-write copies
+     * @return True if another vector references the same storage
+     */
+    bool shares_storage() const noexcept {
+        return engine_.use_count() > 1 && engine_->capacity() > 0;
     }
 };
 
@@ -584,8 +1112,8 @@ public:
 /**
  * @brief Equality comparison
  */
-template<typename T>
-bool operator==(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
+template<typename T, typename Alloc>
+bool operator==(const unified_vector<T, Alloc>& lhs, const unified_vector<T, Alloc>& rhs) {
     if (lhs.size() != rhs.size()) return false;
     return std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
@@ -593,27 +1121,84 @@ bool operator==(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
 /**
  * @brief Inequality comparison
  */
-template<typename T>
-bool operator!=(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
+template<typename T, typename Alloc>
+bool operator!=(const unified_vector<T, Alloc>& lhs, const unified_vector<T, Alloc>& rhs) {
     return !(lhs == rhs);
 }
 
 /**
  * @brief Less than comparison
  */
-template<typename T>
-bool operator<(const unified_vector<T>& lhs, const unified_vector<T>& rhs) {
+template<typename T, typename Alloc>
+bool operator<(const unified_vector<T, Alloc>& lhs, const unified_vector<T, Alloc>& rhs) {
     return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
 /**
  * @brief Swap specialization
  */
-template<typename T>
-void swap(unified_vector<T>& lhs, unified_vector<T>& rhs) noexcept {
+template<typename T, typename Alloc>
+void swap(unified_vector<T, Alloc>& lhs, unified_vector<T, Alloc>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
+/**
+ * @brief Concatenate vectors into a new vector
+ * 
+ * The result is allocated once. Parts whose newest data is on the device
+ * are copied there first, device to device; the remaining parts are then
+ * copied on the host and uploaded, so a result assembled from device data
+ * stays on the device. If no part is on the device, everything is copied
+ * on the host. The result uses the first vector's storage options and
+ * allocator.
+ * 
+ * @code
+ * auto all = concat(train, validation, test);
+ * @endcode
+ * 
+ * @param first First vector
+ * @param rest Further vectors of the same type
+ * @return Vector holding the elements of all arguments in order
+ */
+template<typename T, typename Alloc, typename... Rest>
+unified_vector<T, Alloc> concat(const unified_vector<T, Alloc>& first, const Rest&... rest) {
+    static_assert((std::is_same<Rest, unified_vector<T, Alloc>>::value && ...),
+                  "concat requires vectors of the same type");
+    using vector_type = unified_vector<T, Alloc>;
+    const vector_type* parts[] = {&first, &rest...};
+    
+    size_t total = 0;
+    for (const vector_type* part : parts) total += part->size_;
+    
+    vector_type result(vector_type::make_engine(
+                           total, first.engine_->get_storage_options(),
+                           std::allocator_traits<Alloc>::select_on_container_copy_construction(
+                               first.get_allocator())),
+                       total);
+    if (total == 0) return result;
+    
+    bool copied[sizeof...(Rest) + 1] = {};
+    bool on_device = false;
+    size_t offset = 0;
+    for (size_t i = 0; i <= sizeof...(Rest); ++i) {
+        copied[i] = result.engine_->copy_device_from(*parts[i]->engine_, parts[i]->size_, offset);
+        on_device = on_device || copied[i];
+        offset += parts[i]->size_;
+    }
+    
+    offset = 0;
+    for (size_t i = 0; i <= sizeof...(Rest); ++i) {
+        size_t count = parts[i]->size_;
+        if (!copied[i] && count > 0) {
+            parts[i]->engine_->sync_to_host();
+            std::copy_n(parts[i]->data_impl(), count, result.data_impl() + offset);
+            if (on_device) result.engine_->upload_range(offset, offset + count);
+        }
+        offset += count;
+    }
+    return result;
+}
+
 } // namespace vulkan_stdpar
 
 // Include iterator implementation
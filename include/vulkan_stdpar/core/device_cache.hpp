@@ -0,0 +1,341 @@
+/**
+ * @file device_cache.hpp
+ * @brief Process-wide recycling cache for device buffer allocations
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains device_buffer_cache, which keeps device allocations
+ * released by versioning_engine instances and hands them to later engines
+ * of a similar size instead of creating a new buffer each time, and its
+ * USM counterpart device_usm_cache.
+ */
+
+#ifndef VULKAN_STDPAR_CORE_DEVICE_CACHE_HPP
+#define VULKAN_STDPAR_CORE_DEVICE_CACHE_HPP
+
+#include "profiling.hpp"
+#include "exceptions.hpp"
+#include "device_selection.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+#include <sycl/sycl.hpp>
+#endif
+
+/**
+ * @brief Default byte budget of the device buffer cache
+ */
+#ifndef VULKAN_STDPAR_DEVICE_CACHE_BUDGET
+#define VULKAN_STDPAR_DEVICE_CACHE_BUDGET (size_t(256) * 1024 * 1024)
+#endif
+
+namespace vulkan_stdpar {
+
+namespace memory {
+
+/**
+ * @brief Device buffer cache statistics
+ */
+struct device_cache_stats {
+    uint64_t hits;          ///< Checkouts served from the cache
+    uint64_t misses;        ///< Checkouts that created a new buffer
+    uint64_t evictions;     ///< Buffers dropped to stay within budget
+    size_t cached_bytes;    ///< Bytes currently held by the cache
+    size_t budget;          ///< Byte budget
+
+    device_cache_stats()
+        : hits(0), misses(0), evictions(0), cached_bytes(0), budget(0)
+    {}
+};
+
+/**
+ * @brief Round a request up to its cache bucket size
+ *
+ * Buckets are 64 KiB minimum and then four per power of two, so a recycled
+ * allocation wastes at most a quarter of its size.
+ *
+ * @param bytes Requested size in bytes
+ * @return Bucket size in bytes
+ */
+inline size_t device_bucket_size(size_t bytes) {
+    const size_t min_bucket = size_t(64) * 1024;
+    if (bytes <= min_bucket) return min_bucket;
+    size_t power = min_bucket;
+    while (power * 2 <= bytes) power *= 2;
+    size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+}
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+
+/**
+ * @brief Device allocation from sycl::malloc_device, freed on destruction
+ */
+class usm_block {
+private:
+    std::byte* data_;           ///< Device pointer
+    size_t bytes_;              ///< Allocation size
+    sycl::context context_;     ///< Owning context
+
+public:
+    /**
+     * @brief Allocate device memory
+     * @param bytes Size in bytes
+     * @param q Queue whose device and context own the allocation
+     * @throws out_of_memory_exception if allocation fails
+     */
+    usm_block(size_t bytes, const sycl::queue& q)
+        : data_(sycl::malloc_device<std::byte>(bytes, q))
+        , bytes_(bytes)
+        , context_(q.get_context())
+    {
+        if (!data_) throw out_of_memory_exception(bytes);
+    }
+
+    ~usm_block() {
+        if (data_) sycl::free(data_, context_);
+    }
+
+    usm_block(usm_block&& other) noexcept
+        : data_(other.data_), bytes_(other.bytes_), context_(other.context_)
+    {
+        other.data_ = nullptr;
+        other.bytes_ = 0;
+    }
+
+    usm_block& operator=(usm_block&& other) noexcept {
+        if (this != &other) {
+            if (data_) sycl::free(data_, context_);
+            data_ = other.data_;
+            bytes_ = other.bytes_;
+            context_ = other.context_;
+            other.data_ = nullptr;
+            other.bytes_ = 0;
+        }
+        return *this;
+    }
+
+    usm_block(const usm_block&) = delete;
+    usm_block& operator=(const usm_block&) = delete;
+
+    std::byte* data() const noexcept { return data_; }
+    size_t byte_size() const noexcept { return bytes_; }
+};
+
+/**
+ * @brief Creation of cacheable device blocks
+ * @tparam Block Block type
+ */
+template<typename Block>
+struct device_block_traits;
+
+template<>
+struct device_block_traits<sycl::buffer<std::byte, 1>> {
+    static sycl::buffer<std::byte, 1> create(size_t bytes) {
+        return sycl::buffer<std::byte, 1>(sycl::range<1>(bytes));
+    }
+};
+
+/**
+ * USM blocks belong to the default queue's context; algorithms running on
+ * a queue of another context stage data through buffers instead of
+ * dereferencing them (see detail::shares_device_memory).
+ */
+template<>
+struct device_block_traits<usm_block> {
+    static usm_block create(size_t bytes) {
+        return usm_block(bytes, queue::get_default_queue());
+    }
+};
+
+/**
+ * @brief Size-bucketed cache of untyped device allocations
+ *
+ * Engines check out a byte block of at least the size they need and view
+ * it as their element type; when an engine is destroyed, shrinks its
+ * device footprint or reallocates, the block is checked back in. Cached
+ * blocks beyond the byte budget are dropped, largest buckets first.
+ * Contents of a checked-out block are unspecified.
+ *
+ * @tparam Block sycl::buffer<std::byte, 1> or usm_block
+ */
+template<typename Block>
+class basic_device_cache {
+public:
+    using block_type = Block;
+
+private:
+    mutable std::mutex mutex_;                              ///< Protects all members
+    std::map<size_t, std::vector<block_type>> buckets_;     ///< Free buffers by bucket size
+    size_t cached_bytes_;                                   ///< Sum of cached bucket sizes
+    size_t budget_;                                         ///< Byte budget
+    device_cache_stats stats_;                              ///< Counters
+
+public:
+    /**
+     * @brief Construct cache
+     * @param budget Maximum bytes held while unused
+     */
+    explicit basic_device_cache(size_t budget = VULKAN_STDPAR_DEVICE_CACHE_BUDGET)
+        : cached_bytes_(0), budget_(budget) {}
+
+    basic_device_cache(const basic_device_cache&) = delete;
+    basic_device_cache& operator=(const basic_device_cache&) = delete;
+
+    /**
+     * @brief Get the process-wide cache
+     * @return Reference to the shared cache
+     */
+    static basic_device_cache& instance() {
+        // Never destroyed: vectors with static storage duration return
+        // their blocks after other statics have been torn down
+        static basic_device_cache* cache = new basic_device_cache();
+        return *cache;
+    }
+
+    /**
+     * @brief Obtain a buffer of at least bytes
+     * @param bytes Required size in bytes
+     * @return Block of device_bucket_size(bytes) bytes
+     */
+    block_type checkout(size_t bytes) {
+        size_t bucket = device_bucket_size(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = buckets_.find(bucket);
+            if (it != buckets_.end() && !it->second.empty()) {
+                block_type block = std::move(it->second.back());
+                it->second.pop_back();
+                cached_bytes_ -= bucket;
+                ++stats_.hits;
+                profiling::record_device_cache(true);
+                return block;
+            }
+            ++stats_.misses;
+        }
+        profiling::record_device_cache(false);
+        return device_block_traits<block_type>::create(bucket);
+    }
+
+    /**
+     * @brief Return a buffer obtained from checkout()
+     * @param block Buffer to recycle
+     */
+    void checkin(block_type block) {
+        size_t bucket = block.byte_size();
+        std::vector<block_type> dropped;    // destroyed outside the lock
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (bucket > budget_) {
+                ++stats_.evictions;
+                dropped.push_back(std::move(block));
+            } else {
+                evict_until(budget_ - bucket, dropped);
+                buckets_[bucket].push_back(std::move(block));
+                cached_bytes_ += bucket;
+            }
+        }
+    }
+
+    /**
+     * @brief Set byte budget, evicting cached buffers if necessary
+     * @param bytes New budget (0 disables caching)
+     */
+    void set_budget(size_t bytes) {
+        std::vector<block_type> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        budget_ = bytes;
+        evict_until(budget_, dropped);
+    }
+
+    /**
+     * @brief Drop every cached buffer
+     */
+    void clear() {
+        std::vector<block_type> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        evict_until(0, dropped);
+    }
+
+    /**
+     * @brief Get cache statistics
+     * @return Snapshot of counters
+     */
+    device_cache_stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        device_cache_stats result = stats_;
+        result.cached_bytes = cached_bytes_;
+        result.budget = budget_;
+        return result;
+    }
+
+private:
+    /**
+     * @brief Evict largest buckets first until cached bytes <= limit
+     */
+    void evict_until(size_t limit, std::vector<block_type>& dropped) {
+        while (cached_bytes_ > limit && !buckets_.empty()) {
+            auto it = std::prev(buckets_.end());
+            if (it->second.empty()) {
+                buckets_.erase(it);
+                continue;
+            }
+            dropped.push_back(std::move(it->second.back()));
+            it->second.pop_back();
+            cached_bytes_ -= it->first;
+            ++stats_.evictions;
+        }
+    }
+};
+
+/**
+ * @brief Cache of sycl::buffer blocks used by the buffer backend and streaming
+ */
+using device_buffer_cache = basic_device_cache<sycl::buffer<std::byte, 1>>;
+
+/**
+ * @brief Cache of malloc_device blocks used by the USM backend
+ */
+using device_usm_cache = basic_device_cache<usm_block>;
+
+/**
+ * @brief View the leading count elements of a byte buffer as T
+ * @tparam T Element type
+ * @param block Buffer from device_buffer_cache::checkout
+ * @param count Number of elements (count * sizeof(T) <= block size)
+ * @return Typed buffer sharing block's memory
+ */
+template<typename T>
+sycl::buffer<T, 1> view_device_block(device_buffer_cache::block_type& block, size_t count) {
+    size_t bytes = count * sizeof(T);
+    if (bytes == block.byte_size()) {
+        return block.template reinterpret<T, 1>(sycl::range<1>(count));
+    }
+    device_buffer_cache::block_type prefix(block, sycl::id<1>(0), sycl::range<1>(bytes));
+    return prefix.template reinterpret<T, 1>(sycl::range<1>(count));
+}
+
+/**
+ * @brief View a USM block as T
+ * @tparam T Element type
+ * @param block Block from device_usm_cache::checkout
+ * @return Typed device pointer
+ */
+template<typename T>
+T* view_device_block(usm_block& block, size_t) {
+    return reinterpret_cast<T*>(block.data());
+}
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+} // namespace memory
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CORE_DEVICE_CACHE_HPP
@@ -106,6 +106,7 @@ struct device_info {
     // Feature support
     bool supports_timeline_semaphores;         ///< Timeline semaphore support
     bool supports_pinned_memory;               ///< Host-coherent memory support
+    bool host_unified_memory;                  ///< Device memory is host memory (zero-copy)
     bool supports_sub_groups;                  ///< Sub-group operations
     bool supports_fp16;                        ///< Half-precision floating point
     bool supports_fp64;                        ///< Double-precision floating point
@@ -128,6 +129,7 @@ struct device_info {
         , max_work_items_per_compute_unit(0)
         , supports_timeline_semaphores(false)
         , supports_pinned_memory(false)
+        , host_unified_memory(false)
         , supports_sub_groups(false)
         , supports_fp16(false)
         , supports_fp64(false)
@@ -239,6 +241,8 @@ inline device_info sycl_device_to_info(const sycl::device& dev) {
     // Feature support
     info.supports_fp64 = dev.has(sycl::aspect::fp64);
     info.supports_fp16 = dev.has(sycl::aspect::fp16);
+    info.supports_pinned_memory = dev.has(sycl::aspect::usm_host_allocations);
+    info.host_unified_memory = dev.is_cpu();
     
     return info;
 }
@@ -298,6 +302,7 @@ inline std::vector<device_info> enumerate_devices() {
     cpu_device.memory_size = 1024ULL * 1024 * 1024 * 16;  // Assume 16GB
     cpu_device.max_compute_units = std::thread::hardware_concurrency();
     cpu_device.max_work_group_size = 1;
+    cpu_device.host_unified_memory = true;
     
     return {cpu_device};
 }
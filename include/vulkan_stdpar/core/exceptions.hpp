@@ -191,6 +191,25 @@ private:
     std::string reason_;
 };
 
+/**
+ * @brief Exception thrown when a file operation fails
+ */
+class io_exception : public vulkan_stdpar_exception {
+public:
+    io_exception(const std::string& path, const std::string& reason)
+        : vulkan_stdpar_exception("I/O error on '" + path + "': " + reason)
+        , path_(path)
+        , reason_(reason)
+    {}
+    
+    const std::string& path() const { return path_; }
+    const std::string& reason() const { return reason_; }
+    
+private:
+    std::string path_;
+    std::string reason_;
+};
+
 /**
  * @brief Error handling macro for try-catch blocks
  * 
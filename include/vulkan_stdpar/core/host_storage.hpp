@@ -0,0 +1,691 @@
+/**
+ * @file host_storage.hpp
+ * @brief Aligned, growable raw host storage for versioning_engine
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains host_storage, the raw element buffer that backs
+ * unified_vector on the host. Small buffers come from aligned operator new;
+ * large buffers on Linux are anonymous mappings that grow with mremap and
+ * can be advised to use transparent huge pages. Storage can also reserve a
+ * large virtual address range up front and commit pages as it grows, so
+ * growth never moves existing elements, or live in pooled page-locked
+ * memory for faster device transfers, or map a file so elements fault in
+ * lazily from disk. A user-supplied allocator replaces all of this with
+ * allocator_traits allocation.
+ */
+
+#ifndef VULKAN_STDPAR_CORE_HOST_STORAGE_HPP
+#define VULKAN_STDPAR_CORE_HOST_STORAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "exceptions.hpp"
+#include "memory_management.hpp"
+#include "numa.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VULKAN_STDPAR_HAS_MMAP 1
+#endif
+
+/**
+ * @brief Default byte alignment of host storage (SIMD friendly)
+ */
+#ifndef VULKAN_STDPAR_HOST_ALIGNMENT
+#define VULKAN_STDPAR_HOST_ALIGNMENT 64
+#endif
+
+/**
+ * @brief Allocation size (bytes) from which host storage is mmap-backed
+ */
+#ifndef VULKAN_STDPAR_HOST_MMAP_THRESHOLD
+#define VULKAN_STDPAR_HOST_MMAP_THRESHOLD (2u * 1024u * 1024u)
+#endif
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Host storage configuration
+ */
+struct storage_options {
+    size_t alignment;       ///< Byte alignment of element storage (power of two)
+    bool huge_pages;        ///< Advise transparent huge pages for mmap-backed storage
+    size_t reserve_bytes;   ///< Virtual address space reserved up front (0 disables)
+    bool pinned;            ///< Place elements in page-locked memory from the pinned pool
+    bool copy_on_write;     ///< Copies share storage until one of them is written
+    numa_placement placement; ///< NUMA page placement of mmap-backed storage
+
+    storage_options()
+        : alignment(VULKAN_STDPAR_HOST_ALIGNMENT)
+        , huge_pages(true)
+        , reserve_bytes(0)
+        , pinned(false)
+        , copy_on_write(false)
+        , placement(numa_placement::local)
+    {}
+};
+
+/**
+ * @brief How a file-backed vector relates to its file
+ */
+enum class map_mode {
+    read_only,  ///< File is never written; modified pages become private copies
+    read_write  ///< Shared mapping; modifications and growth are written to the file
+};
+
+/**
+ * @brief Aligned raw element buffer with realloc semantics
+ *
+ * Elements are not constructed or destroyed by the storage; the owning
+ * container is responsible for element lifetime (T is expected to be
+ * trivially copyable). Growing preserves the first `preserve` elements;
+ * mremap only relocates trivially copyable elements, others are moved.
+ *
+ * With std::allocator the storage manages memory itself (aligned heap,
+ * mmap, reserved address space). Any other allocator is used as-is through
+ * std::allocator_traits; storage_options are then ignored.
+ *
+ * @tparam T Element type
+ * @tparam Alloc Allocator type
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class host_storage {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using allocator_type = Alloc;
+
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                  "host_storage: allocator value_type must match T");
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "host_storage: fancy allocator pointers are not supported");
+
+    /// True when memory is managed directly rather than through Alloc
+    static constexpr bool raw_storage = std::is_same<Alloc, std::allocator<T>>::value;
+
+private:
+    /**
+     * @brief Origin of the current allocation
+     */
+    enum class origin {
+        none,       ///< No allocation
+        heap,       ///< Aligned operator new
+        mapped,     ///< Anonymous mmap
+        reserved,   ///< PROT_NONE reservation with committed prefix
+        pinned,     ///< Region from the pinned memory pool
+        file,       ///< Mapping of a file (fd_ open)
+        allocator   ///< User allocator
+    };
+
+    T* data_;                   ///< Element storage
+    size_type capacity_;        ///< Capacity in elements
+    size_t bytes_;              ///< Allocated (committed) bytes
+    size_t reserved_;           ///< Reserved address space in bytes
+    origin origin_;             ///< Allocation origin
+    int fd_;                    ///< Mapped file descriptor (origin::file)
+    size_t file_offset_;        ///< File offset of the first element (origin::file)
+    bool file_shared_;          ///< File mapping writes through to the file
+    storage_options options_;   ///< Configuration
+    Alloc alloc_;               ///< Element allocator
+
+public:
+    /**
+     * @brief Construct storage
+     * @param capacity Initial capacity in elements
+     * @param options Storage configuration
+     * @param alloc Element allocator
+     */
+    explicit host_storage(size_type capacity = 0, const storage_options& options = storage_options(),
+                          const Alloc& alloc = Alloc())
+        : data_(nullptr)
+        , capacity_(0)
+        , bytes_(0)
+        , reserved_(0)
+        , origin_(origin::none)
+        , fd_(-1)
+        , file_offset_(0)
+        , file_shared_(false)
+        , options_(options)
+        , alloc_(alloc)
+    {
+        options_.alignment = std::max(options_.alignment, alignof(T));
+        reallocate(capacity, 0);
+    }
+
+    /**
+     * @brief Destructor - releases the allocation
+     */
+    ~host_storage() {
+        release();
+    }
+
+    // Non-copyable but movable
+    host_storage(const host_storage&) = delete;
+    host_storage& operator=(const host_storage&) = delete;
+
+    host_storage(host_storage&& other) noexcept
+        : data_(other.data_)
+        , capacity_(other.capacity_)
+        , bytes_(other.bytes_)
+        , reserved_(other.reserved_)
+        , origin_(other.origin_)
+        , fd_(other.fd_)
+        , file_offset_(other.file_offset_)
+        , file_shared_(other.file_shared_)
+        , options_(other.options_)
+        , alloc_(std::move(other.alloc_))
+    {
+        other.data_ = nullptr;
+        other.capacity_ = 0;
+        other.bytes_ = 0;
+        other.reserved_ = 0;
+        other.origin_ = origin::none;
+        other.fd_ = -1;
+    }
+
+    host_storage& operator=(host_storage&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            bytes_ = other.bytes_;
+            reserved_ = other.reserved_;
+            origin_ = other.origin_;
+            fd_ = other.fd_;
+            file_offset_ = other.file_offset_;
+            file_shared_ = other.file_shared_;
+            options_ = other.options_;
+            alloc_ = std::move(other.alloc_);
+            other.data_ = nullptr;
+            other.capacity_ = 0;
+            other.bytes_ = 0;
+            other.reserved_ = 0;
+            other.origin_ = origin::none;
+            other.fd_ = -1;
+        }
+        return *this;
+    }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    size_type capacity() const noexcept { return capacity_; }
+    const storage_options& options() const noexcept { return options_; }
+    Alloc get_allocator() const { return alloc_; }
+
+    /**
+     * @brief Check whether storage is backed by an mmap region
+     * @return True for mapped storage
+     */
+    bool is_mapped() const noexcept {
+        return origin_ == origin::mapped || origin_ == origin::reserved || origin_ == origin::file;
+    }
+
+    /**
+     * @brief Check whether storage is a mapping of a file
+     * @return True after map_file() until the storage detaches or is released
+     */
+    bool is_file_mapped() const noexcept {
+        return origin_ == origin::file;
+    }
+
+    /**
+     * @brief Check whether storage is page-locked pinned memory
+     * @return True for storage from the pinned pool
+     */
+    bool is_pinned() const noexcept {
+        return origin_ == origin::pinned;
+    }
+
+    /**
+     * @brief Get the largest capacity reachable without moving elements
+     * @return Capacity in elements (equals capacity() unless address space is reserved)
+     */
+    size_type reserved_capacity() const noexcept {
+        return origin_ == origin::reserved ? reserved_ / sizeof(T) : capacity_;
+    }
+
+    /**
+     * @brief Replace the allocation with a mapping of a file
+     *
+     * Capacity becomes the number of elements in [offset, offset + length).
+     * Pages are read from disk on first access. A read_write mapping grows
+     * the file when capacity grows, so it must extend to the end of the
+     * file; a read_only mapping moves to anonymous memory instead.
+     *
+     * @param path File to map
+     * @param mode Whether modifications reach the file
+     * @param offset Byte offset of the first element (multiple of alignof(T))
+     * @param length Bytes to map (default: to the end of the file)
+     * @throws invalid_argument_exception if the range is misaligned, outside the
+     *         file, not a whole number of elements, or short of the end of a
+     *         read_write file
+     * @throws io_exception if the file cannot be opened or mapped
+     */
+    void map_file(const std::string& path, map_mode mode, size_t offset = 0,
+                  size_t length = static_cast<size_t>(-1)) {
+        static_assert(raw_storage, "host_storage: file mapping requires std::allocator");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        int fd = ::open(path.c_str(), mode == map_mode::read_write ? O_RDWR : O_RDONLY);
+        if (fd < 0) {
+            throw io_exception(path, std::strerror(errno));
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            int error = errno;
+            ::close(fd);
+            throw io_exception(path, std::strerror(error));
+        }
+        size_t file_bytes = static_cast<size_t>(info.st_size);
+        if (offset % alignof(T) != 0 || offset > file_bytes) {
+            ::close(fd);
+            throw invalid_argument_exception("offset", "must be element aligned and within " + path);
+        }
+        size_t bytes = std::min(length, file_bytes - offset);
+        if (bytes % sizeof(T) != 0) {
+            ::close(fd);
+            throw invalid_argument_exception("path", path + " is not a whole number of elements");
+        }
+        if (mode == map_mode::read_write && offset + bytes != file_bytes) {
+            ::close(fd);
+            throw invalid_argument_exception("length", "read_write mappings must reach the end of " + path);
+        }
+
+        // Mappings start on a page; elements start lead bytes into the first one
+        size_t lead = offset % page_size();
+        char* ptr = nullptr;
+        if (bytes > 0) {
+            // Private mappings are copy-on-write, so read_only files stay untouched
+            int flags = mode == map_mode::read_write ? MAP_SHARED : MAP_PRIVATE;
+            void* base = ::mmap(nullptr, lead + bytes, PROT_READ | PROT_WRITE, flags, fd,
+                                static_cast<off_t>(offset - lead));
+            if (base == MAP_FAILED) {
+                int error = errno;
+                ::close(fd);
+                throw io_exception(path, std::strerror(error));
+            }
+            ptr = static_cast<char*>(base) + lead;
+        }
+
+        release();
+        data_ = reinterpret_cast<T*>(ptr);
+        bytes_ = bytes;
+        capacity_ = bytes / sizeof(T);
+        origin_ = origin::file;
+        fd_ = fd;
+        file_offset_ = offset;
+        file_shared_ = mode == map_mode::read_write;
+#else
+        (void)path;
+        (void)mode;
+        (void)offset;
+        (void)length;
+        throw unsupported_operation_exception("map_file without mmap");
+#endif
+    }
+
+    /**
+     * @brief Write modified pages of a read_write mapping back to the file
+     * @throws io_exception if msync fails
+     */
+    void flush() {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (origin_ == origin::file && file_shared_ && bytes_ > 0) {
+            if (::msync(file_base(), file_lead() + bytes_, MS_SYNC) != 0) {
+                throw io_exception("mapped file", std::strerror(errno));
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Unmap a file, trimming a read_write file to its used length
+     *
+     * Capacity growth extends the file ahead of the elements actually
+     * written; this cuts it back. The storage is empty afterwards.
+     *
+     * @param used_bytes Bytes of the file that hold elements
+     */
+    void close_file(size_t used_bytes) noexcept {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (origin_ != origin::file) return;
+        int fd = fd_;
+        bool trim = file_shared_ && used_bytes < bytes_;
+        fd_ = -1;
+        release();
+        if (trim) {
+            (void)::ftruncate(fd, static_cast<off_t>(file_offset_ + used_bytes));
+        }
+        ::close(fd);
+#else
+        (void)used_bytes;
+#endif
+    }
+
+    /**
+     * @brief Change capacity, preserving leading elements
+     * @param new_capacity New capacity in elements
+     * @param preserve Number of leading elements to keep
+     * @throws std::bad_alloc if allocation fails
+     * @throws io_exception if a read_write file mapping cannot be resized
+     */
+    void reallocate(size_type new_capacity, size_type preserve) {
+        if (new_capacity == capacity_) return;
+        preserve = std::min({preserve, capacity_, new_capacity});
+
+        if (new_capacity == 0) {
+            release();
+            return;
+        }
+
+        if constexpr (!raw_storage) {
+            T* fresh = alloc_traits::allocate(alloc_, new_capacity);
+            move_elements(fresh, preserve);
+            release();
+            data_ = fresh;
+            bytes_ = new_capacity * sizeof(T);
+            capacity_ = new_capacity;
+            origin_ = origin::allocator;
+            return;
+        }
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (origin_ == origin::file && file_shared_) {
+            resize_file(new_capacity, preserve);
+            return;
+        }
+#endif
+
+        size_t new_bytes = round_up(new_capacity * sizeof(T), options_.alignment);
+
+        if (options_.pinned && options_.alignment <= memory::detail::pinned_pool::page_size()) {
+            grow_pinned(new_capacity, new_bytes, preserve);
+            return;
+        }
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (options_.reserve_bytes > 0 && options_.alignment <= page_size()) {
+            grow_reserved(new_capacity, new_bytes, preserve);
+            return;
+        }
+
+        if (use_mapping(new_bytes)) {
+            new_bytes = round_up(new_bytes, page_size());
+            if (origin_ == origin::mapped) {
+                // Page tables move; element data is never copied. Objects that
+                // are not trivially copyable may only stay where they are.
+                constexpr int flags = std::is_trivially_copyable<T>::value ? MREMAP_MAYMOVE : 0;
+                void* moved = ::mremap(data_, bytes_, new_bytes, flags);
+                if (moved != MAP_FAILED) {
+                    data_ = static_cast<T*>(moved);
+                    bytes_ = new_bytes;
+                    capacity_ = new_capacity;
+                    advise(data_, bytes_);
+                    return;
+                }
+                if (flags != 0) throw std::bad_alloc();
+            }
+            T* fresh = map(new_bytes);
+            move_elements(fresh, preserve);
+            release();
+            data_ = fresh;
+            bytes_ = new_bytes;
+            capacity_ = new_capacity;
+            origin_ = origin::mapped;
+            return;
+        }
+#endif
+
+        T* fresh = static_cast<T*>(::operator new(new_bytes, std::align_val_t(options_.alignment)));
+        move_elements(fresh, preserve);
+        release();
+        data_ = fresh;
+        bytes_ = new_bytes;
+        capacity_ = new_capacity;
+        origin_ = origin::heap;
+    }
+
+private:
+    static size_t round_up(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void move_elements(T* destination, size_type count) {
+        if (count == 0) return;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memcpy(static_cast<void*>(destination), data_, count * sizeof(T));
+        } else {
+            // destination is raw memory: construct there, then end the moved-from objects
+            std::uninitialized_move(data_, data_ + count, destination);
+            std::destroy(data_, data_ + count);
+        }
+    }
+
+    void release() noexcept {
+        switch (origin_) {
+        case origin::heap:
+            ::operator delete(data_, std::align_val_t(options_.alignment));
+            break;
+        case origin::mapped:
+#ifdef VULKAN_STDPAR_HAS_MMAP
+            ::munmap(data_, bytes_);
+#endif
+            break;
+        case origin::reserved:
+#ifdef VULKAN_STDPAR_HAS_MMAP
+            ::munmap(data_, reserved_);
+#endif
+            break;
+        case origin::pinned:
+            memory::detail::pinned_pool::instance().deallocate(data_);
+            break;
+        case origin::file:
+#ifdef VULKAN_STDPAR_HAS_MMAP
+            if (data_) ::munmap(file_base(), file_lead() + bytes_);
+            if (fd_ >= 0) ::close(fd_);
+#endif
+            fd_ = -1;
+            break;
+        case origin::allocator:
+            alloc_traits::deallocate(alloc_, data_, capacity_);
+            break;
+        case origin::none:
+            break;
+        }
+        data_ = nullptr;
+        capacity_ = 0;
+        bytes_ = 0;
+        reserved_ = 0;
+        origin_ = origin::none;
+    }
+
+    /**
+     * @brief Grow within the current pinned region or move to a larger one
+     */
+    void grow_pinned(size_type new_capacity, size_t new_bytes, size_type preserve) {
+        auto& pool = memory::detail::pinned_pool::instance();
+        if (origin_ == origin::pinned && new_bytes <= bytes_) {
+            // Bucket rounding left room; no new pinning needed
+            capacity_ = new_capacity;
+            return;
+        }
+
+        T* fresh = static_cast<T*>(pool.allocate(new_bytes));
+        move_elements(fresh, preserve);
+        release();
+        data_ = fresh;
+        bytes_ = pool.capacity(fresh);
+        capacity_ = new_capacity;
+        origin_ = origin::pinned;
+    }
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    /**
+     * @brief Resize a shared file mapping together with the file
+     * @param new_capacity New capacity in elements
+     * @param preserve Number of leading elements to keep
+     * @throws io_exception if the file cannot be resized or remapped
+     */
+    void resize_file(size_type new_capacity, size_type preserve) {
+        size_t new_bytes = new_capacity * sizeof(T);
+        off_t file_end = static_cast<off_t>(file_offset_ + new_bytes);
+        if (new_bytes > bytes_ && ::ftruncate(fd_, file_end) != 0) {
+            throw io_exception("mapped file", std::strerror(errno));
+        }
+        size_t lead = file_lead();
+        void* ptr;
+        if (!data_) {
+            ptr = map_file_range(lead + new_bytes);
+        } else if constexpr (std::is_trivially_copyable<T>::value) {
+            ptr = ::mremap(file_base(), lead + bytes_, lead + new_bytes, MREMAP_MAYMOVE);
+        } else {
+            ptr = ::mremap(file_base(), lead + bytes_, lead + new_bytes, 0);
+            if (ptr == MAP_FAILED) ptr = relocate_file_mapping(lead + new_bytes, preserve);
+        }
+        if (ptr == MAP_FAILED) throw io_exception("mapped file", std::strerror(errno));
+        if (new_bytes < bytes_) {
+            (void)::ftruncate(fd_, file_end);
+        }
+        data_ = reinterpret_cast<T*>(static_cast<char*>(ptr) + lead);
+        bytes_ = new_bytes;
+        capacity_ = new_capacity;
+    }
+
+    /**
+     * @brief Map the file from the page containing file_offset_
+     * @return Mapping base, or MAP_FAILED
+     */
+    void* map_file_range(size_t bytes) const {
+        return ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+                      static_cast<off_t>(file_offset_ - file_lead()));
+    }
+
+    /**
+     * @brief Move a file mapping that cannot grow in place, keeping the elements
+     *
+     * Both mappings show the same file pages, so the leading elements are
+     * moved out to a temporary buffer and back rather than relocated bitwise.
+     *
+     * @return New mapping base, or MAP_FAILED with the old mapping intact
+     */
+    void* relocate_file_mapping(size_t new_mapping_bytes, size_type preserve) {
+        std::allocator<T> temporary_alloc;
+        T* temporary = temporary_alloc.allocate(std::max<size_type>(preserve, 1));
+        std::uninitialized_move(data_, data_ + preserve, temporary);
+        std::destroy(data_, data_ + preserve);
+
+        void* ptr = map_file_range(new_mapping_bytes);
+        T* destination = data_;
+        if (ptr != MAP_FAILED) {
+            ::munmap(file_base(), file_lead() + bytes_);
+            destination = reinterpret_cast<T*>(static_cast<char*>(ptr) + file_lead());
+        }
+        int saved_errno = errno;
+        std::uninitialized_move(temporary, temporary + preserve, destination);
+        std::destroy(temporary, temporary + preserve);
+        temporary_alloc.deallocate(temporary, std::max<size_type>(preserve, 1));
+        errno = saved_errno;
+        return ptr;
+    }
+
+    /**
+     * @brief Grow inside a reserved address range, committing pages on demand
+     */
+    void grow_reserved(size_type new_capacity, size_t new_bytes, size_type preserve) {
+        new_bytes = round_up(new_bytes, page_size());
+
+        if (origin_ != origin::reserved || new_bytes > reserved_) {
+            // Reserve a fresh range; only happens once unless the reservation is outgrown
+            size_t reserve = round_up(std::max(options_.reserve_bytes, new_bytes), page_size());
+            if (origin_ == origin::reserved) {
+                reserve = std::max(reserve, reserved_ * 2);
+            }
+            void* range = ::mmap(nullptr, reserve, PROT_NONE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (range == MAP_FAILED) throw std::bad_alloc();
+            if (::mprotect(range, new_bytes, PROT_READ | PROT_WRITE) != 0) {
+                ::munmap(range, reserve);
+                throw std::bad_alloc();
+            }
+            advise(range, reserve);
+
+            T* fresh = static_cast<T*>(range);
+            move_elements(fresh, preserve);
+            release();
+            data_ = fresh;
+            bytes_ = new_bytes;
+            reserved_ = reserve;
+            capacity_ = new_capacity;
+            origin_ = origin::reserved;
+            return;
+        }
+
+        if (new_bytes > bytes_) {
+            // Commit the next pages in place; existing elements never move
+            char* base = reinterpret_cast<char*>(data_);
+            if (::mprotect(base + bytes_, new_bytes - bytes_, PROT_READ | PROT_WRITE) != 0) {
+                throw std::bad_alloc();
+            }
+            bytes_ = new_bytes;
+        }
+        capacity_ = new_capacity;
+    }
+
+    /**
+     * @brief Bytes between the page-aligned start of a file mapping and data_
+     */
+    size_t file_lead() const {
+        return file_offset_ % page_size();
+    }
+
+    void* file_base() const {
+        return reinterpret_cast<char*>(data_) - file_lead();
+    }
+
+    static size_t page_size() {
+        static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    bool use_mapping(size_t bytes) const {
+        return bytes >= VULKAN_STDPAR_HOST_MMAP_THRESHOLD && options_.alignment <= page_size();
+    }
+
+    T* map(size_t bytes) const {
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) throw std::bad_alloc();
+        advise(ptr, bytes);
+        return static_cast<T*>(ptr);
+    }
+
+    void advise(void* ptr, size_t bytes) const {
+        if (options_.placement == numa_placement::interleave) {
+            host::interleave_pages(ptr, bytes);
+        }
+#ifdef MADV_HUGEPAGE
+        if (options_.huge_pages) {
+            ::madvise(ptr, bytes, MADV_HUGEPAGE);
+        }
+#endif
+    }
+#endif
+};
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CORE_HOST_STORAGE_HPP
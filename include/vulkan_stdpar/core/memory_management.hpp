@@ -6,7 +6,7 @@
  * @date 2025-12-02
  * 
  * This file contains memory management utilities including pinned memory allocation,
- * lazy buffer creation, and memory optimization strategies.
+ * lazy buffer creation, memory pooling, and memory optimization strategies.
  */
 
 #ifndef VULKAN_STDPAR_CORE_MEMORY_MANAGEMENT_HPP
@@ -17,11 +17,46 @@
 #include <type_traits>
 #include <atomic>
 #include <mutex>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <new>
+#include <unordered_map>
+
+#include "device_selection.hpp"
 
 #ifdef VULKAN_STDPAR_USE_SYCL
 #include <sycl/sycl.hpp>
 #endif
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Bytes of freed pinned memory kept for reuse
+ */
+#ifndef VULKAN_STDPAR_PINNED_POOL_BYTES
+#define VULKAN_STDPAR_PINNED_POOL_BYTES (size_t(64) * 1024 * 1024)
+#endif
+
+/**
+ * @brief Smallest allocation for which pinning is worthwhile
+ */
+#ifndef VULKAN_STDPAR_PINNED_MIN_BYTES
+#define VULKAN_STDPAR_PINNED_MIN_BYTES (size_t(64) * 1024)
+#endif
+
+/**
+ * @brief Let devices that share host memory use host storage in place (0 disables)
+ */
+#ifndef VULKAN_STDPAR_ZERO_COPY
+#define VULKAN_STDPAR_ZERO_COPY 1
+#endif
+
 namespace vulkan_stdpar {
 
 // Forward declarations
@@ -90,24 +125,64 @@ namespace memory {
 
 /**
  * @brief Get memory properties for a device
+ * 
+ * Devices whose memory is host memory report it as host visible, coherent
+ * and cached as well as device local.
+ * 
  * @param device Device information
  * @return Memory properties
  */
-memory_properties get_memory_properties(const device_info& device);
+inline memory_properties get_memory_properties(const device_info& device) {
+    memory_properties props;
+    props.device_local = true;
+    props.host_visible = device.host_unified_memory;
+    props.host_coherent = device.host_unified_memory;
+    props.host_cached = device.host_unified_memory;
+    props.alignment = alignof(std::max_align_t);
+    props.max_allocation_size = device.memory_size;
+    return props;
+}
 
 /**
- * @brief Check if device supports pinned memory
+ * @brief Check if device supports unified memory
  * @param device Device information
- * @return True if pinned memory is supported
+ * @return True if device memory is host memory, so host data can be used in place
  */
-bool supports_pinned_memory(const device_info& device);
+inline bool supports_unified_memory(const device_info& device) {
+    memory_properties props = get_memory_properties(device);
+    return props.device_local && props.host_visible && props.host_coherent;
+}
 
+#ifdef VULKAN_STDPAR_USE_SYCL
 /**
- * @brief Check if device supports unified memory
- * @param device Device information
- * @return True if unified memory is supported
+ * @brief Check whether kernels on a device can work on host storage in place
+ * 
+ * The USM backend additionally needs the device to accept pointers from
+ * the system allocator. Results are cached per device.
+ * 
+ * @param dev SYCL device
+ * @return True if host storage can be bound as the device copy
  */
-bool supports_unified_memory(const device_info& device);
+inline bool supports_zero_copy(const sycl::device& dev) {
+#if VULKAN_STDPAR_ZERO_COPY
+    static std::mutex mutex;
+    static std::unordered_map<sycl::device, bool> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(dev);
+    if (it != cache.end()) return it->second;
+    
+    bool zero_copy = supports_unified_memory(device::sycl_device_to_info(dev));
+#ifdef VULKAN_STDPAR_USE_USM
+    zero_copy = zero_copy && dev.has(sycl::aspect::usm_system_allocations);
+#endif
+    cache.emplace(dev, zero_copy);
+    return zero_copy;
+#else
+    (void)dev;
+    return false;
+#endif
+}
+#endif
 
 /**
  * @brief Check if device supports device-local memory
@@ -124,13 +199,6 @@ bool supports_device_local_memory(const device_info& device);
  */
 allocation_strategy select_optimal_strategy(size_t size, access_pattern pattern);
 
-/**
- * @brief Select pinned memory allocation strategy
- * @param size Allocation size in bytes
- * @return Pinned memory allocation strategy
- */
-allocation_strategy select_pinned_strategy(size_t size);
-
 /**
  * @brief Select device-local memory allocation strategy
  * @param size Allocation size in bytes
@@ -138,15 +206,6 @@ allocation_strategy select_pinned_strategy(size_t size);
  */
 allocation_strategy select_device_local_strategy(size_t size);
 
-/**
- * @brief Allocate pinned memory
- * @param size Size to allocate in bytes
- * @param device Device information
- * @return Aligned pointer to allocated memory
- * @throws std::bad_alloc if allocation fails
- */
-void* allocate_pinned_memory(size_t size, const device_info& device);
-
 /**
  * @brief Allocate device memory
  * @param size Size to allocate in bytes
@@ -156,13 +215,6 @@ void* allocate_pinned_memory(size_t size, const device_info& device);
  */
 void* allocate_device_memory(size_t size, const device_info& device);
 
-/**
- * @brief Free pinned memory
- * @param ptr Pointer to free
- * @param size Size of allocation
- */
-void free_pinned_memory(void* ptr, size_t size);
-
 /**
  * @brief Free device memory
  * @param ptr Pointer to free
@@ -347,8 +399,299 @@ sycl::buffer<T> create_sub_buffer(sycl::buffer<T>& parent, size_t offset, size_t
 
 #endif // VULKAN_STDPAR_USE_SYCL
 
+namespace detail {
+
+/**
+ * @brief Shared buddy heap behind memory_pool
+ *
+ * Memory is carved from arenas of 2^arena_shift bytes, each aligned to its
+ * own size. Blocks are power-of-two size classes from 2^min_shift bytes up
+ * to half an arena; a free block of order k keeps an intrusive list node in
+ * its first bytes, and a per-arena order map (stored in the arena's first
+ * block) lets deallocation find and coalesce its buddy in O(1). Requests
+ * above the largest class go straight to operator new.
+ */
+class buddy_heap : public std::enable_shared_from_this<buddy_heap> {
+public:
+    static constexpr size_t min_shift = 6;                              ///< 64-byte minimum class
+    static constexpr size_t arena_shift = 22;                           ///< 4 MiB arenas
+    static constexpr size_t arena_bytes = size_t(1) << arena_shift;
+    static constexpr size_t num_orders = arena_shift - min_shift;       ///< Orders 0 .. 15
+    static constexpr size_t max_block = size_t(1) << (arena_shift - 1); ///< Largest pooled block
+    static constexpr size_t meta_order = arena_shift - 2 * min_shift;   ///< Order of the order map
+    static constexpr uint8_t not_free = 0xff;
+    
+private:
+    struct free_node {
+        free_node* prev;
+        free_node* next;
+    };
+    
+    std::mutex mutex_;                          ///< Protects free lists and arenas
+    free_node* free_lists_[num_orders];         ///< Free blocks per order
+    uint32_t nonempty_;                         ///< Bit k set when free_lists_[k] is non-empty
+    std::vector<unsigned char*> arenas_;        ///< Owned arenas
+    std::atomic<size_t> outstanding_;           ///< Bytes checked out of the heap
+    std::atomic<size_t> peak_;                  ///< High-water mark of outstanding_
+    uint64_t id_;                               ///< Unique heap identity for thread caches
+    
+public:
+    buddy_heap() : nonempty_(0), outstanding_(0), peak_(0), id_(next_id()) {
+        std::fill(std::begin(free_lists_), std::end(free_lists_), nullptr);
+    }
+    
+    ~buddy_heap() {
+        for (unsigned char* arena : arenas_) {
+            ::operator delete(arena, std::align_val_t(arena_bytes));
+        }
+    }
+    
+    buddy_heap(const buddy_heap&) = delete;
+    buddy_heap& operator=(const buddy_heap&) = delete;
+    
+    uint64_t id() const noexcept { return id_; }
+    size_t outstanding() const noexcept { return outstanding_.load(std::memory_order_relaxed); }
+    size_t peak() const noexcept { return peak_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Map a byte count to its size class
+     * @param bytes Request size
+     * @return Order k such that 2^(min_shift + k) >= bytes
+     */
+    static size_t order_for(size_t bytes) noexcept {
+        size_t order = 0;
+        while ((size_t(1) << (min_shift + order)) < bytes) ++order;
+        return order;
+    }
+    
+    static size_t block_size(size_t order) noexcept {
+        return size_t(1) << (min_shift + order);
+    }
+    
+    /**
+     * @brief Pre-map arenas so that at least bytes can be served without growing
+     */
+    void reserve(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t arenas = (bytes + arena_bytes - 1) / arena_bytes;
+        for (size_t i = 0; i < arenas; ++i) add_arena();
+    }
+    
+    /**
+     * @brief Take up to count blocks of one order, splitting larger blocks as needed
+     * @return Number of blocks written to out (at least 1)
+     * @throws std::bad_alloc if no arena can be added
+     */
+    size_t acquire(size_t order, void** out, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t taken = 0;
+        while (taken < count) {
+            try {
+                out[taken] = take_block(order);
+            } catch (...) {
+                if (taken == 0) throw;
+                break;
+            }
+            ++taken;
+        }
+        note_checkout(block_size(order) * taken);
+        return taken;
+    }
+    
+    /**
+     * @brief Return blocks of one order, coalescing with free buddies
+     */
+    void release(size_t order, void* const* blocks, size_t count) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < count; ++i) {
+            put_block(static_cast<unsigned char*>(blocks[i]), order);
+        }
+        outstanding_.fetch_sub(block_size(order) * count, std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Allocate a request larger than every size class
+     */
+    void* allocate_large(size_t bytes) {
+        void* ptr = ::operator new(bytes, std::align_val_t(64));
+        note_checkout(bytes);
+        return ptr;
+    }
+    
+    void deallocate_large(void* ptr, size_t bytes) noexcept {
+        ::operator delete(ptr, std::align_val_t(64));
+        outstanding_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+    
+private:
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    
+    void note_checkout(size_t bytes) {
+        size_t now = outstanding_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_.load(std::memory_order_relaxed);
+        while (now > peak && !peak_.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+    }
+    
+    static unsigned char* arena_of(unsigned char* block) noexcept {
+        return reinterpret_cast<unsigned char*>(reinterpret_cast<uintptr_t>(block) & ~(arena_bytes - 1));
+    }
+    
+    static uint8_t* order_map(unsigned char* arena) noexcept {
+        return reinterpret_cast<uint8_t*>(arena);
+    }
+    
+    void push(unsigned char* block, size_t order) noexcept {
+        auto* node = reinterpret_cast<free_node*>(block);
+        node->prev = nullptr;
+        node->next = free_lists_[order];
+        if (node->next) node->next->prev = node;
+        free_lists_[order] = node;
+        nonempty_ |= uint32_t(1) << order;
+        unsigned char* arena = arena_of(block);
+        order_map(arena)[(block - arena) >> min_shift] = static_cast<uint8_t>(order);
+    }
+    
+    void unlink(unsigned char* block, size_t order) noexcept {
+        auto* node = reinterpret_cast<free_node*>(block);
+        if (node->prev) node->prev->next = node->next;
+        else free_lists_[order] = node->next;
+        if (node->next) node->next->prev = node->prev;
+        if (!free_lists_[order]) nonempty_ &= ~(uint32_t(1) << order);
+        unsigned char* arena = arena_of(block);
+        order_map(arena)[(block - arena) >> min_shift] = not_free;
+    }
+    
+    unsigned char* take_block(size_t order) {
+        uint32_t candidates = nonempty_ & ~((uint32_t(1) << order) - 1);
+        if (candidates == 0) {
+            add_arena();
+            candidates = nonempty_ & ~((uint32_t(1) << order) - 1);
+        }
+        size_t found = order;
+        while (!(candidates & (uint32_t(1) << found))) ++found;
+        auto* block = reinterpret_cast<unsigned char*>(free_lists_[found]);
+        unlink(block, found);
+        // Split down to the requested class, freeing the upper halves
+        while (found > order) {
+            --found;
+            push(block + block_size(found), found);
+        }
+        return block;
+    }
+    
+    void put_block(unsigned char* block, size_t order) noexcept {
+        unsigned char* arena = arena_of(block);
+        uint8_t* map = order_map(arena);
+        size_t index = static_cast<size_t>(block - arena) >> min_shift;
+        while (order + 1 < num_orders) {
+            size_t buddy = index ^ (size_t(1) << order);
+            if (map[buddy] != order) break;
+            unlink(arena + (buddy << min_shift), order);
+            index &= ~(size_t(1) << order);
+            ++order;
+        }
+        push(arena + (index << min_shift), order);
+    }
+    
+    void add_arena() {
+        auto* arena = static_cast<unsigned char*>(::operator new(arena_bytes, std::align_val_t(arena_bytes)));
+        arenas_.push_back(arena);
+        // The order map occupies the first block of order meta_order; the rest
+        // of the arena is one free buddy of each order from meta_order upwards
+        std::memset(arena, not_free, block_size(meta_order));
+        for (size_t order = meta_order; order < num_orders; ++order) {
+            push(arena + block_size(order), order);
+        }
+    }
+};
+
+/**
+ * @brief Per-thread block cache for small size classes
+ *
+ * Each thread keeps a short stack of free blocks per size class and heap,
+ * refilled from and flushed to the shared heap in batches so that the
+ * common allocate/deallocate pair takes no lock.
+ */
+class thread_block_cache {
+public:
+    static constexpr size_t cached_orders = 10;        ///< Classes up to 32 KiB are cached
+    static constexpr size_t bin_bytes = 64 * 1024;     ///< Byte budget per bin
+    static constexpr size_t max_bin = 64;
+    
+    struct bin {
+        void* blocks[max_bin];
+        size_t count = 0;
+    };
+    
+    struct entry {
+        uint64_t heap_id;
+        std::weak_ptr<buddy_heap> owner;
+        bin bins[cached_orders];
+    };
+    
+private:
+    std::vector<std::unique_ptr<entry>> entries_;
+    entry* last_ = nullptr;
+    
+public:
+    ~thread_block_cache() {
+        for (auto& e : entries_) {
+            if (auto heap = e->owner.lock()) {
+                for (size_t order = 0; order < cached_orders; ++order) {
+                    heap->release(order, e->bins[order].blocks, e->bins[order].count);
+                }
+            }
+        }
+    }
+    
+    static size_t capacity(size_t order) noexcept {
+        return std::min(max_bin, std::max<size_t>(4, bin_bytes / buddy_heap::block_size(order)));
+    }
+    
+    /**
+     * @brief Get this thread's cache entry for a heap
+     * @throws std::bad_alloc if a new entry cannot be created
+     */
+    entry& lookup(buddy_heap& heap) {
+        if (last_ && last_->heap_id == heap.id()) return *last_;
+        for (auto& e : entries_) {
+            if (e->heap_id == heap.id()) {
+                last_ = e.get();
+                return *last_;
+            }
+        }
+        // Drop entries of destroyed heaps; their blocks are already gone
+        entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                      [](const std::unique_ptr<entry>& e) { return e->owner.expired(); }),
+                       entries_.end());
+        auto fresh = std::make_unique<entry>();
+        fresh->heap_id = heap.id();
+        fresh->owner = heap.shared_from_this();
+        last_ = fresh.get();
+        entries_.push_back(std::move(fresh));
+        return *last_;
+    }
+    
+    static thread_block_cache& local() {
+        static thread_local thread_block_cache cache;
+        return cache;
+    }
+};
+
+} // namespace detail
+
 /**
  * @brief Memory pool for efficient allocation
+ *
+ * Requests are rounded up to power-of-two size classes (64 B to 2 MiB)
+ * served by a buddy heap: O(1) free lists per class, splitting of larger
+ * blocks on demand and coalescing of freed buddies. Classes up to 32 KiB
+ * are additionally cached per thread and moved to and from the shared heap
+ * in batches. Larger requests bypass the pool.
+ *
  * @tparam T Element type
  */
 template<typename T>
@@ -359,115 +702,499 @@ public:
     using pointer = T*;
     
 private:
-    struct block {
-        pointer ptr;
-        size_type size;
-        bool in_use;
-        
-        block(pointer p = nullptr, size_type s = 0) 
-            : ptr(p), size(s), in_use(false) {}
-    };
+    static_assert(alignof(T) <= (size_t(1) << detail::buddy_heap::min_shift),
+                  "memory_pool: over-aligned types are not supported");
+    
+    using cache_type = detail::thread_block_cache;
     
-    std::vector<block> blocks_;
-    std::mutex mutex_;
-    size_type total_allocated_;
-    size_type peak_usage_;
+    std::shared_ptr<detail::buddy_heap> heap_;    ///< Shared with thread caches
     
 public:
     /**
      * @brief Constructor
-     * @param initial_capacity Initial pool capacity
+     * @param initial_capacity Elements to pre-map so early allocations do not grow the pool
      */
-    explicit memory_pool(size_type initial_capacity = 0) 
-        : total_allocated_(0), peak_usage_(0) {
+    explicit memory_pool(size_type initial_capacity = 0)
+        : heap_(std::make_shared<detail::buddy_heap>())
+    {
         if (initial_capacity > 0) {
-            allocate_block(initial_capacity);
+            heap_->reserve(initial_capacity * sizeof(T));
         }
     }
     
     /**
-     * @brief Destructor
+     * @brief Destructor - releases every arena (outstanding blocks become invalid)
      */
-    ~memory_pool() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        for (auto& block : blocks_) {
-            if (block.ptr) {
-                operator delete(block.ptr);
-            }
-        }
-    }
+    ~memory_pool() = default;
+    
+    // Non-copyable, non-movable (allocators hold a pointer to the pool)
+    memory_pool(const memory_pool&) = delete;
+    memory_pool& operator=(const memory_pool&) = delete;
     
     /**
      * @brief Allocate memory from pool
      * @param size Size to allocate in elements
      * @return Pointer to allocated memory
+     * @throws std::bad_alloc if allocation fails
      */
     pointer allocate(size_type size) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        // Try to find a suitable free block
-        for (auto& block : blocks_) {
-            if (!block.in_use && block.size >= size) {
-                block.in_use = true;
-                total_allocated_ += size;
-                peak_usage_ = std::max(peak_usage_, total_allocated_);
-                return block.ptr;
-            }
+        size_t bytes = std::max<size_t>(size * sizeof(T), 1);
+        if (bytes > detail::buddy_heap::max_block) {
+            return static_cast<pointer>(heap_->allocate_large(bytes));
+        }
+        size_t order = detail::buddy_heap::order_for(bytes);
+        if (order >= cache_type::cached_orders) {
+            void* block;
+            heap_->acquire(order, &block, 1);
+            return static_cast<pointer>(block);
         }
         
-        // No suitable block found, allocate new one
-        allocate_block(size);
-        blocks_.back().in_use = true;
-        total_allocated_ += size;
-        peak_usage_ = std::max(peak_usage_, total_allocated_);
-        return blocks_.back().ptr;
+        auto& bin = cache_type::local().lookup(*heap_).bins[order];
+        if (bin.count == 0) {
+            bin.count = heap_->acquire(order, bin.blocks, cache_type::capacity(order) / 2);
+        }
+        return static_cast<pointer>(bin.blocks[--bin.count]);
     }
     
     /**
      * @brief Deallocate memory back to pool
      * @param ptr Pointer to deallocate
-     * @param size Size of allocation
+     * @param size Size of allocation (as passed to allocate)
      */
-    void deallocate(pointer ptr, size_type size) {
-        std::lock_guard<std::mutex> lock(mutex_);
+    void deallocate(pointer ptr, size_type size) noexcept {
+        if (!ptr) return;
+        size_t bytes = std::max<size_t>(size * sizeof(T), 1);
+        if (bytes > detail::buddy_heap::max_block) {
+            heap_->deallocate_large(ptr, bytes);
+            return;
+        }
+        size_t order = detail::buddy_heap::order_for(bytes);
+        if (order >= cache_type::cached_orders) {
+            void* block = ptr;
+            heap_->release(order, &block, 1);
+            return;
+        }
         
-        for (auto& block : blocks_) {
-            if (block.ptr == ptr) {
-                block.in_use = false;
-                total_allocated_ -= size;
-                return;
-            }
+        cache_type::entry* cache;
+        try {
+            cache = &cache_type::local().lookup(*heap_);
+        } catch (...) {
+            // Creating this thread's cache entry failed; bypass the cache
+            void* block = ptr;
+            heap_->release(order, &block, 1);
+            return;
         }
         
-        // Block not found, deallocate directly
-        operator delete(ptr);
+        auto& bin = cache->bins[order];
+        size_t limit = cache_type::capacity(order);
+        if (bin.count == limit) {
+            // Flush the older half so the next frees stay local
+            size_t flush = limit / 2;
+            heap_->release(order, bin.blocks, flush);
+            std::copy(bin.blocks + flush, bin.blocks + bin.count, bin.blocks);
+            bin.count -= flush;
+        }
+        bin.blocks[bin.count++] = ptr;
     }
     
     /**
      * @brief Get current usage statistics
-     * @return Total allocated memory
+     * @return Elements checked out of the shared heap (including thread-cached blocks)
      */
     size_type get_allocated() const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return total_allocated_;
+        return heap_->outstanding() / sizeof(T);
     }
     
     /**
      * @brief Get peak usage
-     * @return Peak memory usage
+     * @return Peak of get_allocated()
      */
     size_type get_peak_usage() const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return peak_usage_;
+        return heap_->peak() / sizeof(T);
     }
+};
+
+/**
+ * @brief Get the process-wide byte pool used by default-constructed pool_allocators
+ * @return Reference to the shared pool
+ */
+inline memory_pool<unsigned char>& get_default_pool() {
+    // Never destroyed: containers with static storage duration may return
+    // blocks after other statics have been torn down
+    static memory_pool<unsigned char>* pool = new memory_pool<unsigned char>();
+    return *pool;
+}
+
+/**
+ * @brief Standard allocator drawing storage from a memory_pool
+ *
+ * Freed blocks go back to the pool and are handed out again to later
+ * allocations instead of returning to the system allocator, which suits
+ * many short-lived containers of similar size. Allocators compare equal
+ * when they share a pool.
+ *
+ * @tparam T Element type
+ */
+template<typename T>
+class pool_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using pool_type = memory_pool<unsigned char>;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    
+    template<typename U>
+    struct rebind {
+        using other = pool_allocator<U>;
+    };
     
 private:
-    void allocate_block(size_type size) {
-        pointer ptr = static_cast<pointer>(operator new(size * sizeof(T)));
-        blocks_.emplace_back(ptr, size);
+    static_assert(alignof(T) <= (size_t(1) << detail::buddy_heap::min_shift),
+                  "pool_allocator: over-aligned types are not supported");
+    
+    pool_type* pool_;    ///< Backing pool (never null)
+    
+    template<typename U> friend class pool_allocator;
+    
+public:
+    /**
+     * @brief Construct allocator using the process-wide pool
+     */
+    pool_allocator() noexcept : pool_(&get_default_pool()) {}
+    
+    /**
+     * @brief Construct allocator using a specific pool
+     * @param pool Backing pool (must outlive every allocation made through it)
+     */
+    explicit pool_allocator(pool_type& pool) noexcept : pool_(&pool) {}
+    
+    /**
+     * @brief Rebinding copy constructor
+     */
+    template<typename U>
+    pool_allocator(const pool_allocator<U>& other) noexcept : pool_(other.pool_) {}
+    
+    /**
+     * @brief Allocate storage for n elements
+     * @param n Number of elements
+     * @return Pointer to uninitialized storage
+     * @throws std::bad_alloc if allocation fails
+     */
+    T* allocate(size_type n) {
+        return reinterpret_cast<T*>(pool_->allocate(n * sizeof(T)));
+    }
+    
+    /**
+     * @brief Return storage to the pool
+     * @param ptr Pointer from allocate()
+     * @param n Number of elements passed to allocate()
+     */
+    void deallocate(T* ptr, size_type n) noexcept {
+        pool_->deallocate(reinterpret_cast<unsigned char*>(ptr), n * sizeof(T));
+    }
+    
+    /**
+     * @brief Get backing pool
+     * @return Reference to the pool
+     */
+    pool_type& pool() const noexcept {
+        return *pool_;
+    }
+    
+    template<typename U>
+    bool operator==(const pool_allocator<U>& other) const noexcept {
+        return pool_ == other.pool_;
+    }
+    
+    template<typename U>
+    bool operator!=(const pool_allocator<U>& other) const noexcept {
+        return pool_ != other.pool_;
     }
 };
 
+/**
+ * @brief Pinned memory pool statistics
+ */
+struct pinned_stats {
+    uint64_t allocations;   ///< Pinned allocations served
+    uint64_t pool_hits;     ///< Allocations served from freed regions
+    uint64_t lock_failures; ///< Regions that could not be page-locked
+    size_t live_bytes;      ///< Bytes handed out and not yet freed
+    size_t cached_bytes;    ///< Freed bytes kept for reuse
+
+    pinned_stats()
+        : allocations(0), pool_hits(0), lock_failures(0), live_bytes(0), cached_bytes(0)
+    {}
+};
+
+namespace detail {
+
+/**
+ * @brief Pool of page-locked host regions
+ *
+ * Regions come from sycl::malloc_host when SYCL is enabled and from
+ * mmap + mlock on Linux otherwise. Pinning and unpinning cost a system
+ * call and page-table walk each, so freed regions are kept by size bucket
+ * (page granular, four buckets per power of two) up to
+ * VULKAN_STDPAR_PINNED_POOL_BYTES and handed out again. If mlock fails
+ * (typically RLIMIT_MEMLOCK), the region stays usable but unlocked.
+ */
+class pinned_pool {
+private:
+    struct region {
+        size_t bytes;   ///< Bucket size
+        bool locked;    ///< Page-locked by mlock or the SYCL runtime
+    };
+
+    mutable std::mutex mutex_;                          ///< Protects all members
+    std::map<size_t, std::vector<void*>> free_;         ///< Freed regions by bucket size
+    std::unordered_map<void*, region> regions_;         ///< Every region owned by the pool
+    size_t limit_;                                      ///< Cached byte limit
+    pinned_stats stats_;                                ///< Counters
+
+public:
+    pinned_pool() : limit_(VULKAN_STDPAR_PINNED_POOL_BYTES) {}
+
+    pinned_pool(const pinned_pool&) = delete;
+    pinned_pool& operator=(const pinned_pool&) = delete;
+
+    /**
+     * @brief Get the process-wide pool
+     *
+     * Never destroyed, so storage with static lifetime can free into it.
+     *
+     * @return Reference to the shared pool
+     */
+    static pinned_pool& instance() {
+        static pinned_pool* pool = new pinned_pool();
+        return *pool;
+    }
+
+    /**
+     * @brief Round a request to its bucket size
+     * @param bytes Requested size
+     * @return Page-aligned bucket size
+     */
+    static size_t bucket_size(size_t bytes) {
+        size_t page = page_size();
+        bytes = std::max(bytes, page);
+        size_t power = page;
+        while (power * 2 <= bytes) power *= 2;
+        size_t step = std::max(page, power / 4);
+        return (bytes + step - 1) / step * step;
+    }
+
+    /**
+     * @brief Allocate a page-aligned pinned region
+     * @param bytes Minimum size
+     * @return Pointer to bucket_size(bytes) bytes
+     * @throws std::bad_alloc if allocation fails
+     */
+    void* allocate(size_t bytes) {
+        size_t bucket = bucket_size(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.allocations;
+            auto it = free_.find(bucket);
+            if (it != free_.end() && !it->second.empty()) {
+                void* ptr = it->second.back();
+                it->second.pop_back();
+                stats_.cached_bytes -= bucket;
+                stats_.live_bytes += bucket;
+                ++stats_.pool_hits;
+                return ptr;
+            }
+        }
+
+        bool locked = false;
+        void* ptr = map_region(bucket, locked);
+        std::lock_guard<std::mutex> lock(mutex_);
+        regions_.emplace(ptr, region{bucket, locked});
+        stats_.live_bytes += bucket;
+        if (!locked) ++stats_.lock_failures;
+        return ptr;
+    }
+
+    /**
+     * @brief Return a region to the pool
+     * @param ptr Pointer from allocate() (null is ignored)
+     */
+    void deallocate(void* ptr) {
+        if (!ptr) return;
+        region released;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = regions_.find(ptr);
+            if (it == regions_.end()) return;
+            released = it->second;
+            stats_.live_bytes -= released.bytes;
+            if (stats_.cached_bytes + released.bytes <= limit_) {
+                free_[released.bytes].push_back(ptr);
+                stats_.cached_bytes += released.bytes;
+                return;
+            }
+            regions_.erase(it);
+        }
+        unmap_region(ptr, released);
+    }
+
+    /**
+     * @brief Get the usable size of a region
+     * @param ptr Pointer from allocate()
+     * @return Bucket size, or 0 if ptr is not a pool region
+     */
+    size_t capacity(const void* ptr) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = regions_.find(const_cast<void*>(ptr));
+        return it == regions_.end() ? 0 : it->second.bytes;
+    }
+
+    /**
+     * @brief Release every cached region to the system
+     */
+    void trim() {
+        std::vector<std::pair<void*, region>> dropped;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& bucket : free_) {
+                for (void* ptr : bucket.second) {
+                    auto it = regions_.find(ptr);
+                    dropped.emplace_back(ptr, it->second);
+                    regions_.erase(it);
+                }
+            }
+            free_.clear();
+            stats_.cached_bytes = 0;
+        }
+        for (auto& entry : dropped) {
+            unmap_region(entry.first, entry.second);
+        }
+    }
+
+    /**
+     * @brief Get pool statistics
+     * @return Snapshot of counters
+     */
+    pinned_stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    static size_t page_size() {
+#if defined(__linux__)
+        static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+private:
+    static void* map_region(size_t bytes, bool& locked) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        void* ptr = sycl::malloc_host(bytes, queue::get_default_queue());
+        if (!ptr) throw std::bad_alloc();
+        locked = true;
+        return ptr;
+#elif defined(__linux__)
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) throw std::bad_alloc();
+        locked = ::mlock(ptr, bytes) == 0;
+        return ptr;
+#else
+        locked = false;
+        return ::operator new(bytes, std::align_val_t(page_size()));
+#endif
+    }
+
+    static void unmap_region(void* ptr, const region& r) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        (void)r;
+        sycl::free(ptr, queue::get_default_queue());
+#elif defined(__linux__)
+        if (r.locked) ::munlock(ptr, r.bytes);
+        ::munmap(ptr, r.bytes);
+#else
+        (void)r;
+        ::operator delete(ptr, std::align_val_t(page_size()));
+#endif
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Check if device supports pinned memory
+ * @param device Device information
+ * @return True if pinned memory is supported
+ */
+inline bool supports_pinned_memory(const device_info& device) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+    return device.supports_pinned_memory;
+#elif defined(__linux__)
+    (void)device;
+    return true;
+#else
+    (void)device;
+    return false;
+#endif
+}
+
+/**
+ * @brief Select pinned memory allocation strategy
+ * 
+ * Small buffers are not worth a pinned region of at least one page and
+ * the locking cost; they keep the automatic strategy.
+ * 
+ * @param size Allocation size in bytes
+ * @return host_pinned for sizes of at least VULKAN_STDPAR_PINNED_MIN_BYTES, otherwise automatic
+ */
+inline allocation_strategy select_pinned_strategy(size_t size) {
+    return size >= VULKAN_STDPAR_PINNED_MIN_BYTES ? allocation_strategy::host_pinned
+                                                  : allocation_strategy::automatic;
+}
+
+/**
+ * @brief Allocate pinned memory
+ * @param size Size to allocate in bytes
+ * @param device Device information
+ * @return Page-aligned pointer to allocated memory (null for size 0)
+ * @throws std::bad_alloc if allocation fails
+ */
+inline void* allocate_pinned_memory(size_t size, const device_info& device) {
+    (void)device;
+    if (size == 0) return nullptr;
+    return detail::pinned_pool::instance().allocate(size);
+}
+
+/**
+ * @brief Free pinned memory
+ * @param ptr Pointer to free
+ * @param size Size of allocation
+ */
+inline void free_pinned_memory(void* ptr, size_t size) {
+    (void)size;
+    detail::pinned_pool::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Get pinned memory pool statistics
+ * @return Snapshot of counters
+ */
+inline pinned_stats get_pinned_stats() {
+    return detail::pinned_pool::instance().stats();
+}
+
+/**
+ * @brief Release cached pinned regions to the system
+ */
+inline void trim_pinned_memory() {
+    detail::pinned_pool::instance().trim();
+}
+
 } // namespace memory
 
 } // namespace vulkan_stdpar
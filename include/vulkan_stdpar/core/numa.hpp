@@ -0,0 +1,198 @@
+/**
+ * @file numa.hpp
+ * @brief Host NUMA topology and page placement
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains numa_topology, which reads the memory nodes and their
+ * CPUs from /sys/devices/system/node, and interleave_pages, which asks the
+ * kernel to spread a mapping's pages round-robin across those nodes. No
+ * libnuma is needed; on other systems the topology is one node holding
+ * every CPU and placement requests are ignored.
+ */
+
+#ifndef VULKAN_STDPAR_CORE_NUMA_HPP
+#define VULKAN_STDPAR_CORE_NUMA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_mbind)
+#define VULKAN_STDPAR_HAS_NUMA 1
+#endif
+#endif
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Where the pages of large host storage are placed on NUMA systems
+ */
+enum class numa_placement {
+    local,      ///< Each page on the node of the worker that first writes it
+    interleave  ///< Pages spread round-robin across all memory nodes
+};
+
+namespace host {
+
+/**
+ * @brief One NUMA memory node
+ */
+struct numa_node {
+    int id;                 ///< Node number in /sys/devices/system/node
+    std::vector<int> cpus;  ///< Online CPUs attached to the node
+};
+
+namespace detail {
+
+/**
+ * @brief Parse a kernel CPU or node list such as "0-3,8,10-11"
+ */
+inline std::vector<int> parse_id_list(const std::string& text) {
+    std::vector<int> ids;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t comma = text.find(',', pos);
+        std::string item = text.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        pos = comma == std::string::npos ? text.size() : comma + 1;
+        size_t dash = item.find('-');
+        try {
+            int first = std::stoi(item.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+            for (int id = first; id <= last; ++id) ids.push_back(id);
+        } catch (...) {
+            // Blank or malformed item (e.g. trailing newline)
+        }
+    }
+    return ids;
+}
+
+/**
+ * @brief Read the first line of a sysfs file, or "" if it cannot be read
+ */
+inline std::string read_sysfs_line(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+} // namespace detail
+
+/**
+ * @brief Memory nodes of the host and the CPUs attached to each
+ */
+class numa_topology {
+private:
+    std::vector<numa_node> nodes_;  ///< Nodes with at least one CPU, by id
+
+public:
+    /**
+     * @brief Read the topology from sysfs
+     *
+     * Falls back to a single node holding CPUs 0..hardware_concurrency-1
+     * when sysfs is unavailable.
+     */
+    numa_topology() {
+#if defined(__linux__)
+        const std::string root = "/sys/devices/system/node/";
+        for (int id : detail::parse_id_list(detail::read_sysfs_line(root + "online"))) {
+            numa_node node;
+            node.id = id;
+            node.cpus = detail::parse_id_list(
+                detail::read_sysfs_line(root + "node" + std::to_string(id) + "/cpulist"));
+            if (!node.cpus.empty()) nodes_.push_back(std::move(node));
+        }
+#endif
+        if (nodes_.empty()) {
+            numa_node node;
+            node.id = 0;
+            unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned cpu = 0; cpu < hw; ++cpu) node.cpus.push_back(static_cast<int>(cpu));
+            nodes_.push_back(std::move(node));
+        }
+    }
+
+    /**
+     * @brief Get the process-wide topology, read on first use
+     * @return Shared topology
+     */
+    static const numa_topology& get() {
+        static const numa_topology topology;
+        return topology;
+    }
+
+    /**
+     * @brief Get the nodes that have CPUs
+     * @return Nodes in id order
+     */
+    const std::vector<numa_node>& nodes() const noexcept {
+        return nodes_;
+    }
+
+    /**
+     * @brief Get number of nodes with CPUs
+     * @return Node count (at least 1)
+     */
+    size_t node_count() const noexcept {
+        return nodes_.size();
+    }
+
+    /**
+     * @brief Find the node index a CPU belongs to
+     * @param cpu CPU number
+     * @return Index into nodes(), or 0 if the CPU is unknown
+     */
+    size_t node_of_cpu(int cpu) const noexcept {
+        for (size_t i = 0; i < nodes_.size(); ++i) {
+            const auto& cpus = nodes_[i].cpus;
+            if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end()) return i;
+        }
+        return 0;
+    }
+};
+
+/**
+ * @brief Interleave the not yet touched pages of a mapping across all nodes
+ *
+ * Pages already faulted in stay where they are. Does nothing on a single
+ * node or without NUMA support.
+ *
+ * @param ptr Page-aligned start of an anonymous or private mapping
+ * @param bytes Length of the range
+ * @return True if the interleave policy was applied
+ */
+inline bool interleave_pages(void* ptr, size_t bytes) noexcept {
+#ifdef VULKAN_STDPAR_HAS_NUMA
+    const auto& topology = numa_topology::get();
+    if (topology.node_count() < 2 || bytes == 0) return false;
+
+    constexpr size_t bits = sizeof(unsigned long) * 8;
+    constexpr int mpol_interleave = 3;  // MPOL_INTERLEAVE from <linux/mempolicy.h>
+    int max_id = topology.nodes().back().id;
+    std::vector<unsigned long> mask(static_cast<size_t>(max_id) / bits + 1, 0);
+    for (const auto& node : topology.nodes()) {
+        mask[static_cast<size_t>(node.id) / bits] |= 1ul << (static_cast<size_t>(node.id) % bits);
+    }
+    // The kernel reads maxnode - 1 bits
+    return ::syscall(SYS_mbind, ptr, bytes, mpol_interleave, mask.data(),
+                     mask.size() * bits + 1, 0u) == 0;
+#else
+    (void)ptr;
+    (void)bytes;
+    return false;
+#endif
+}
+
+} // namespace host
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CORE_NUMA_HPP
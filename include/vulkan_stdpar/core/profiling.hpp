@@ -15,6 +15,10 @@
 #include <cstdint>
 #include <atomic>
 #include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 
@@ -31,6 +35,10 @@ struct performance_counters {
     double total_sync_time;                    ///< Cumulative synchronization time (seconds)
     uint64_t cache_hits;                       ///< Sync optimization hits
     uint64_t cache_misses;                     ///< Sync optimization misses
+    uint64_t device_cache_hits;                ///< Device allocations served by the buffer cache
+    uint64_t device_cache_misses;              ///< Device allocations that created a new buffer
+    uint64_t device_evictions;                 ///< Device copies evicted to host by the residency budget
+    uint64_t bytes_evicted;                    ///< Device bytes freed by eviction
     
     /**
      * @brief Default constructor - initializes all counters to zero
@@ -43,6 +51,10 @@ struct performance_counters {
         , total_sync_time(0.0)
         , cache_hits(0)
         , cache_misses(0)
+        , device_cache_hits(0)
+        , device_cache_misses(0)
+        , device_evictions(0)
+        , bytes_evicted(0)
     {}
     
     /**
@@ -56,6 +68,10 @@ struct performance_counters {
         total_sync_time = 0.0;
         cache_hits = 0;
         cache_misses = 0;
+        device_cache_hits = 0;
+        device_cache_misses = 0;
+        device_evictions = 0;
+        bytes_evicted = 0;
     }
     
     /**
@@ -78,6 +94,16 @@ struct performance_counters {
         return static_cast<double>(cache_hits) / static_cast<double>(total);
     }
     
+    /**
+     * @brief Get device buffer cache hit rate
+     * @return Hit ratio (0.0 to 1.0)
+     */
+    double get_device_cache_hit_rate() const {
+        uint64_t total = device_cache_hits + device_cache_misses;
+        if (total == 0) return 0.0;
+        return static_cast<double>(device_cache_hits) / static_cast<double>(total);
+    }
+    
     /**
      * @brief Get average kernel execution time
      * @return Average time in milliseconds
@@ -103,84 +129,206 @@ namespace profiling {
 
 #ifdef VULKAN_STDPAR_ENABLE_PROFILING
 
+namespace detail {
+
+/**
+ * @brief Process-wide profiling state
+ *
+ * Every record is applied to the calling thread's counters without locking
+ * and to the global and per-queue aggregates under a mutex. Engines submit
+ * to a single default queue, which is reported as queue 0.
+ */
+struct profiling_state {
+    std::atomic<bool> enabled{true};
+    std::mutex mutex;
+    performance_counters global;
+    std::unordered_map<uint32_t, performance_counters> queues;
+};
+
+inline profiling_state& get_profiling_state() {
+    // Never destroyed so that records from static destructors stay valid
+    static profiling_state* state = new profiling_state();
+    return *state;
+}
+
+inline performance_counters& thread_counters() {
+    static thread_local performance_counters counters;
+    return counters;
+}
+
+template<typename Update>
+void record(Update&& update) {
+    profiling_state& state = get_profiling_state();
+    if (!state.enabled.load(std::memory_order_relaxed)) return;
+    update(thread_counters());
+    std::lock_guard<std::mutex> lock(state.mutex);
+    update(state.global);
+    update(state.queues[0]);
+}
+
+} // namespace detail
+
 /**
  * @brief Enable or disable profiling
  * @param enabled True to enable profiling
  */
-void enable_profiling(bool enabled);
+inline void enable_profiling(bool enabled) {
+    detail::get_profiling_state().enabled.store(enabled, std::memory_order_relaxed);
+}
 
 /**
  * @brief Check if profiling is enabled
  * @return True if profiling is currently enabled
  */
-bool is_profiling_enabled();
+inline bool is_profiling_enabled() {
+    return detail::get_profiling_state().enabled.load(std::memory_order_relaxed);
+}
 
 /**
  * @brief Get thread-local performance counters
  * @return Reference to current thread's counters
  */
-performance_counters& get_thread_counters();
+inline performance_counters& get_thread_counters() {
+    return detail::thread_counters();
+}
 
 /**
  * @brief Get performance metrics for specific queue
- * @param queue_id Queue identifier
+ * @param queue_id Queue identifier (0 is the default queue)
  * @return Performance counters for queue
  */
-performance_counters get_queue_metrics(uint32_t queue_id);
+inline performance_counters get_queue_metrics(uint32_t queue_id) {
+    auto& state = detail::get_profiling_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.queues.find(queue_id);
+    return it == state.queues.end() ? performance_counters() : it->second;
+}
 
 /**
  * @brief Get global aggregated metrics
  * @return Aggregated performance counters across all threads
  */
-performance_counters get_global_metrics();
+inline performance_counters get_global_metrics() {
+    auto& state = detail::get_profiling_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.global;
+}
 
 /**
  * @brief Reset thread-local counters
  */
-void reset_thread_counters();
+inline void reset_thread_counters() {
+    detail::thread_counters().reset();
+}
 
 /**
- * @brief Reset all counters (thread-local and global)
+ * @brief Reset all counters (calling thread's and global)
  */
-void reset_all_counters();
+inline void reset_all_counters() {
+    reset_thread_counters();
+    auto& state = detail::get_profiling_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.global.reset();
+    state.queues.clear();
+}
 
 /**
  * @brief Record kernel launch
  * @param execution_time Kernel execution time in seconds
  */
-void record_kernel_launch(double execution_time);
+inline void record_kernel_launch(double execution_time) {
+    detail::record([&](performance_counters& c) {
+        ++c.kernel_launches;
+        c.total_kernel_time += execution_time;
+    });
+}
 
 /**
  * @brief Record data transfer to device
  * @param bytes Number of bytes transferred
  * @param transfer_time Transfer time in seconds
  */
-void record_transfer_to_device(uint64_t bytes, double transfer_time);
+inline void record_transfer_to_device(uint64_t bytes, double transfer_time) {
+    detail::record([&](performance_counters& c) {
+        c.bytes_copied_to_device += bytes;
+        c.total_sync_time += transfer_time;
+    });
+}
 
 /**
  * @brief Record data transfer from device
  * @param bytes Number of bytes transferred
  * @param transfer_time Transfer time in seconds
  */
-void record_transfer_from_device(uint64_t bytes, double transfer_time);
+inline void record_transfer_from_device(uint64_t bytes, double transfer_time) {
+    detail::record([&](performance_counters& c) {
+        c.bytes_copied_from_device += bytes;
+        c.total_sync_time += transfer_time;
+    });
+}
 
 /**
  * @brief Record synchronization operation
  * @param sync_time Synchronization time in seconds
  * @param cache_hit True if sync was optimized (cache hit)
  */
-void record_sync(double sync_time, bool cache_hit);
+inline void record_sync(double sync_time, bool cache_hit) {
+    detail::record([&](performance_counters& c) {
+        c.total_sync_time += sync_time;
+        ++(cache_hit ? c.cache_hits : c.cache_misses);
+    });
+}
 
 /**
- * @brief Print performance summary to stdout
+ * @brief Record a device buffer cache lookup
+ * @param hit True if a cached allocation was reused
+ */
+inline void record_device_cache(bool hit) {
+    detail::record([&](performance_counters& c) {
+        ++(hit ? c.device_cache_hits : c.device_cache_misses);
+    });
+}
+
+/**
+ * @brief Record eviction of a device copy to host
+ * @param bytes Device bytes freed
  */
-void print_summary();
+inline void record_device_eviction(uint64_t bytes) {
+    detail::record([&](performance_counters& c) {
+        ++c.device_evictions;
+        c.bytes_evicted += bytes;
+    });
+}
 
 /**
  * @brief Get performance summary as string
  * @return Formatted summary string
  */
-std::string get_summary_string();
+inline std::string get_summary_string() {
+    performance_counters c = get_global_metrics();
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "Vulkan STD-Parallel performance summary\n";
+    out << "  Kernel launches:      " << c.kernel_launches
+        << " (avg " << c.get_avg_kernel_time() << " ms)\n";
+    out << "  Host -> device:       " << c.bytes_copied_to_device << " bytes\n";
+    out << "  Device -> host:       " << c.bytes_copied_from_device << " bytes\n";
+    out << "  Sync time:            " << c.total_sync_time * 1000.0 << " ms\n";
+    out << "  Sync hit rate:        " << c.get_efficiency() * 100.0 << " %\n";
+    out << "  Device buffer cache:  " << c.device_cache_hits << " hits, "
+        << c.device_cache_misses << " misses ("
+        << c.get_device_cache_hit_rate() * 100.0 << " %)\n";
+    out << "  Device evictions:     " << c.device_evictions << " ("
+        << c.bytes_evicted << " bytes)\n";
+    return out.str();
+}
+
+/**
+ * @brief Print performance summary to stdout
+ */
+inline void print_summary() {
+    std::cout << get_summary_string();
+}
 
 #else // VULKAN_STDPAR_ENABLE_PROFILING
 
@@ -199,6 +347,8 @@ inline void record_kernel_launch(double) {}
 inline void record_transfer_to_device(uint64_t, double) {}
 inline void record_transfer_from_device(uint64_t, double) {}
 inline void record_sync(double, bool) {}
+inline void record_device_cache(bool) {}
+inline void record_device_eviction(uint64_t) {}
 inline void print_summary() {}
 inline std::string get_summary_string() { return ""; }
 
@@ -0,0 +1,340 @@
+/**
+ * @file residency.hpp
+ * @brief Global device memory budget with least-recently-used eviction
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains residency_manager, which tracks the device bytes held
+ * by every versioning_engine and evicts idle device copies back to host
+ * memory when a new allocation would exceed the budget. Victims are
+ * chosen under the manager lock but written back and freed after it is
+ * dropped, so a slow device-to-host copy does not stall every other
+ * allocation.
+ */
+
+#ifndef VULKAN_STDPAR_CORE_RESIDENCY_HPP
+#define VULKAN_STDPAR_CORE_RESIDENCY_HPP
+
+#include "profiling.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Default device memory budget in bytes (0 derives it from the device)
+ */
+#ifndef VULKAN_STDPAR_DEVICE_MEMORY_BUDGET
+#define VULKAN_STDPAR_DEVICE_MEMORY_BUDGET 0
+#endif
+
+namespace vulkan_stdpar {
+
+namespace memory {
+
+/**
+ * @brief Object owning a device copy that can be evicted to host memory
+ */
+class device_resident {
+public:
+    /**
+     * @brief Write the device copy back to host if needed and free it
+     *
+     * Called without the residency manager lock, while the manager holds
+     * the object's registration aside. Implementations must not block on
+     * their own locks: if the object is busy or pinned by a running
+     * kernel it returns 0 and the manager moves on. An exception, e.g. a
+     * failed write-back, is treated the same way.
+     *
+     * @return Bytes freed, or 0 if nothing was evicted
+     */
+    virtual size_t try_evict() const = 0;
+
+protected:
+    ~device_resident() = default;
+};
+
+/**
+ * @brief Residency manager statistics
+ */
+struct residency_stats {
+    size_t resident_bytes;  ///< Device bytes currently held by engines
+    size_t peak_bytes;      ///< Highest resident_bytes observed
+    size_t budget;          ///< Byte budget (0 means unlimited)
+    size_t resident_count;  ///< Number of engines holding a device copy
+    uint64_t evictions;     ///< Device copies evicted to host
+    uint64_t bytes_evicted; ///< Device bytes freed by eviction
+
+    residency_stats()
+        : resident_bytes(0), peak_bytes(0), budget(0), resident_count(0)
+        , evictions(0), bytes_evicted(0)
+    {}
+};
+
+/**
+ * @brief Process-wide tracker of device copies in least-recently-used order
+ *
+ * Engines admit their device allocation before creating it, touch it on
+ * every device use and release it when they free it. Admitting past the
+ * budget evicts the least-recently-used other copies first; evicted
+ * engines re-upload transparently on their next device access.
+ */
+class residency_manager {
+private:
+    struct entry {
+        const device_resident* owner;   ///< Engine holding the copy
+        size_t bytes;                   ///< Device bytes held
+        bool evicting;                  ///< Set aside in evicting_ by an eviction in progress
+    };
+
+public:
+    /**
+     * @brief Opaque registration handle returned by admit()
+     */
+    using handle = std::list<entry>::iterator;
+
+private:
+    mutable std::mutex mutex_;      ///< Protects all members
+    std::condition_variable evicted_; ///< Signals the end of an eviction pass
+    std::list<entry> lru_;          ///< Most recently used first
+    std::list<entry> evicting_;     ///< Entries being evicted outside the lock
+    size_t resident_bytes_;         ///< Sum of entry sizes
+    size_t budget_;                 ///< Byte budget (0 means unlimited)
+    bool budget_set_;               ///< Budget configured explicitly
+    residency_stats stats_;         ///< Peak and eviction counters
+
+public:
+    residency_manager()
+        : resident_bytes_(0)
+        , budget_(VULKAN_STDPAR_DEVICE_MEMORY_BUDGET)
+        , budget_set_(VULKAN_STDPAR_DEVICE_MEMORY_BUDGET != 0)
+    {}
+
+    residency_manager(const residency_manager&) = delete;
+    residency_manager& operator=(const residency_manager&) = delete;
+
+    /**
+     * @brief Get the process-wide manager
+     * @return Reference to the shared manager
+     */
+    static residency_manager& instance() {
+        // Never destroyed: engines with static storage duration release
+        // their allocations after other statics have been torn down
+        static residency_manager* manager = new residency_manager();
+        return *manager;
+    }
+
+    /**
+     * @brief Register a device allocation, evicting others to make room
+     * @param owner Engine about to allocate
+     * @param bytes Size of the allocation
+     * @return Handle for touch(), release() and rebind()
+     */
+    handle admit(const device_resident* owner, size_t bytes) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (budget_ != 0 && resident_bytes_ + bytes > budget_) {
+            evict_unlocked(lock, resident_bytes_ + bytes - budget_, owner);
+        }
+        lru_.push_front(entry{owner, bytes, false});
+        resident_bytes_ += bytes;
+        stats_.peak_bytes = std::max(stats_.peak_bytes, resident_bytes_);
+        return lru_.begin();
+    }
+
+    /**
+     * @brief Mark an allocation as most recently used
+     * @param h Handle from admit()
+     */
+    void touch(handle h) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!h->evicting) lru_.splice(lru_.begin(), lru_, h);
+    }
+
+    /**
+     * @brief Unregister an allocation freed by its owner
+     * @param h Handle from admit()
+     */
+    void release(handle h) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // The owner holds its own lock, so a running eviction of h fails and returns it
+        evicted_.wait(lock, [&] { return !h->evicting; });
+        resident_bytes_ -= h->bytes;
+        lru_.erase(h);
+    }
+
+    /**
+     * @brief Transfer an allocation to a new owner (engine move)
+     * @param h Handle from admit()
+     * @param owner New owning engine
+     */
+    void rebind(handle h, const device_resident* owner) noexcept {
+        std::unique_lock<std::mutex> lock(mutex_);
+        evicted_.wait(lock, [&] { return !h->evicting; });
+        h->owner = owner;
+    }
+
+    /**
+     * @brief Evict least-recently-used copies until bytes are freed
+     * @param bytes Bytes to free
+     * @param keep Engine that must not be evicted (may be null)
+     * @return Bytes actually freed
+     */
+    size_t evict(size_t bytes, const device_resident* keep = nullptr) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return evict_unlocked(lock, bytes, keep);
+    }
+
+    /**
+     * @brief Set byte budget, evicting copies if necessary
+     * @param bytes New budget (0 means unlimited)
+     */
+    void set_budget(size_t bytes) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        budget_ = bytes;
+        budget_set_ = true;
+        if (budget_ != 0 && resident_bytes_ > budget_) {
+            evict_unlocked(lock, resident_bytes_ - budget_, nullptr);
+        }
+    }
+
+    /**
+     * @brief Set the budget derived from device capacity unless configured
+     * @param bytes Default budget
+     */
+    void init_budget(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!budget_set_) {
+            budget_ = bytes;
+            budget_set_ = true;
+        }
+    }
+
+    /**
+     * @brief Get byte budget
+     * @return Budget (0 means unlimited)
+     */
+    size_t budget() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return budget_;
+    }
+
+    /**
+     * @brief Get residency statistics
+     * @return Snapshot of counters
+     */
+    residency_stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        residency_stats result = stats_;
+        result.resident_bytes = resident_bytes_;
+        result.budget = budget_;
+        result.resident_count = lru_.size() + evicting_.size();
+        return result;
+    }
+
+private:
+    /**
+     * @brief Ends an eviction pass however it is left
+     *
+     * Victims still set aside (not erased and replaced by evicting_.end())
+     * get their evicting flag cleared and go back to the cold end of the
+     * list, and waiters in release() and rebind() are woken, so none of
+     * them can wait on a stale flag.
+     */
+    class eviction_pass {
+    private:
+        residency_manager& manager_;
+        std::unique_lock<std::mutex>& lock_;
+        const std::vector<handle>& victims_;
+
+    public:
+        eviction_pass(residency_manager& manager, std::unique_lock<std::mutex>& lock,
+                      const std::vector<handle>& victims)
+            : manager_(manager), lock_(lock), victims_(victims) {}
+
+        ~eviction_pass() {
+            if (!lock_.owns_lock()) lock_.lock();
+            for (handle h : victims_) {
+                if (h == manager_.evicting_.end()) continue;
+                h->evicting = false;
+                manager_.lru_.splice(manager_.lru_.end(), manager_.evicting_, h);
+            }
+            manager_.evicted_.notify_all();
+        }
+
+        eviction_pass(const eviction_pass&) = delete;
+        eviction_pass& operator=(const eviction_pass&) = delete;
+    };
+
+    /**
+     * @brief Evict from the cold end of the list until bytes are freed
+     *
+     * Victims are moved to evicting_ under the lock, evicted with the lock
+     * dropped, then erased (or put back at the cold end if busy) under the
+     * lock again. An owner whose try_evict() throws counts as busy. Entries
+     * that refused are not retried in the same call.
+     */
+    size_t evict_unlocked(std::unique_lock<std::mutex>& lock, size_t bytes, const device_resident* keep) {
+        size_t freed = 0;
+        std::vector<const device_resident*> tried;
+        for (;;) {
+            std::vector<handle> victims;
+            eviction_pass pass(*this, lock, victims);
+            size_t picked = 0;
+            auto it = lru_.end();
+            while (freed + picked < bytes && it != lru_.begin()) {
+                auto victim = std::prev(it);
+                if (victim->owner == keep ||
+                    std::find(tried.begin(), tried.end(), victim->owner) != tried.end()) {
+                    it = victim;
+                    continue;
+                }
+                victims.push_back(victim);
+                picked += victim->bytes;
+                victim->evicting = true;
+                evicting_.splice(evicting_.end(), lru_, victim);
+            }
+            if (victims.empty()) return freed;
+
+            std::vector<size_t> released(victims.size());
+            tried.reserve(tried.size() + victims.size());
+            lock.unlock();
+            for (size_t i = 0; i < victims.size(); ++i) {
+                try {
+                    // Entries set aside are not modified until the lock is retaken
+                    released[i] = victims[i]->owner->try_evict();
+                } catch (...) {
+                    released[i] = 0;
+                }
+            }
+            lock.lock();
+
+            // Owners that refused go back to the list when pass ends
+            for (size_t i = 0; i < victims.size(); ++i) {
+                handle h = victims[i];
+                if (released[i] == 0) {
+                    tried.push_back(h->owner);
+                    continue;
+                }
+                freed += h->bytes;
+                resident_bytes_ -= h->bytes;
+                ++stats_.evictions;
+                stats_.bytes_evicted += h->bytes;
+                profiling::record_device_eviction(h->bytes);
+                evicting_.erase(h);
+                victims[i] = evicting_.end();
+            }
+            if (freed >= bytes) return freed;
+        }
+    }
+};
+
+} // namespace memory
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CORE_RESIDENCY_HPP
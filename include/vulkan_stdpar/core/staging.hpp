@@ -0,0 +1,249 @@
+/**
+ * @file staging.hpp
+ * @brief Pinned staging ring for host-to-device uploads
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains staging_ring, a small set of pinned host slots that
+ * uploads stream through. Host data is copied into one slot while the
+ * previous slot's transfer is still in flight, and callers may modify
+ * their host data as soon as an upload call returns.
+ */
+
+#ifndef VULKAN_STDPAR_CORE_STAGING_HPP
+#define VULKAN_STDPAR_CORE_STAGING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+#include <sycl/sycl.hpp>
+#endif
+
+/**
+ * @brief Size of one staging slot in bytes
+ */
+#ifndef VULKAN_STDPAR_STAGING_SLOT_BYTES
+#define VULKAN_STDPAR_STAGING_SLOT_BYTES (size_t(8) * 1024 * 1024)
+#endif
+
+/**
+ * @brief Number of staging slots in the ring (at least 2 for overlap)
+ */
+#ifndef VULKAN_STDPAR_STAGING_SLOTS
+#define VULKAN_STDPAR_STAGING_SLOTS 3
+#endif
+
+/**
+ * @brief Largest clean gap merged into a neighbouring upload span, in bytes
+ */
+#ifndef VULKAN_STDPAR_STAGING_COALESCE_BYTES
+#define VULKAN_STDPAR_STAGING_COALESCE_BYTES (size_t(64) * 1024)
+#endif
+
+namespace vulkan_stdpar {
+
+namespace memory {
+
+/**
+ * @brief Element span [start, end) to upload
+ */
+struct upload_span {
+    size_t start;   ///< First element
+    size_t end;     ///< One past the last element
+};
+
+/**
+ * @brief Merge ranges into few large spans for upload
+ *
+ * Ranges closer than max_gap elements are joined; the clean elements in
+ * between are uploaded too, which is harmless because host and device
+ * agree on them and cheaper than a separate transfer.
+ *
+ * @tparam Range Type with start and end members
+ * @param ranges Dirty ranges in any order
+ * @param max_gap Largest gap in elements to bridge
+ * @return Sorted, disjoint spans
+ */
+template<typename Range>
+std::vector<upload_span> coalesce_spans(const std::vector<Range>& ranges, size_t max_gap) {
+    std::vector<upload_span> spans;
+    spans.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        if (range.start < range.end) spans.push_back(upload_span{range.start, range.end});
+    }
+    std::sort(spans.begin(), spans.end(),
+              [](const upload_span& a, const upload_span& b) { return a.start < b.start; });
+
+    size_t out = 0;
+    for (size_t i = 0; i < spans.size(); ++i) {
+        if (out > 0 && spans[i].start <= spans[out - 1].end + max_gap) {
+            spans[out - 1].end = std::max(spans[out - 1].end, spans[i].end);
+        } else {
+            spans[out++] = spans[i];
+        }
+    }
+    spans.resize(out);
+    return spans;
+}
+
+#ifdef VULKAN_STDPAR_USE_SYCL
+
+/**
+ * @brief Ring of pinned host slots for streaming uploads
+ *
+ * Each upload is cut into slot-sized pieces. A piece is copied into the
+ * next slot (waiting only for that slot's previous transfer) and a device
+ * copy is enqueued from it, so host copying and transfers overlap. Uploads
+ * from consecutive engines share the ring and pipeline the same way.
+ */
+class staging_ring {
+private:
+    struct slot {
+        unsigned char* data;    ///< Pinned host memory
+        sycl::event pending;    ///< Last transfer reading this slot
+    };
+
+    std::mutex mutex_;          ///< Serializes use of the slots
+    sycl::context context_;     ///< Context the slots were allocated in
+    std::vector<slot> slots_;   ///< Ring slots
+    size_t slot_bytes_;         ///< Size of each slot
+    size_t next_;               ///< Next slot to fill
+
+public:
+    /**
+     * @brief Allocate the ring on a queue's context
+     * @param q Queue whose context owns the pinned slots
+     */
+    explicit staging_ring(sycl::queue& q)
+        : context_(q.get_context())
+        , slot_bytes_(VULKAN_STDPAR_STAGING_SLOT_BYTES)
+        , next_(0)
+    {
+        size_t count = std::max<size_t>(2, VULKAN_STDPAR_STAGING_SLOTS);
+        for (size_t i = 0; i < count; ++i) {
+            auto* data = static_cast<unsigned char*>(sycl::malloc_host(slot_bytes_, q));
+            if (!data) break;
+            slots_.push_back(slot{data, sycl::event()});
+        }
+    }
+
+    staging_ring(const staging_ring&) = delete;
+    staging_ring& operator=(const staging_ring&) = delete;
+
+    /**
+     * @brief Get the process-wide ring, creating it on first use
+     *
+     * The ring is never destroyed so pinned memory outlives any queue
+     * still referencing it at exit.
+     *
+     * @param q Queue used for the first allocation
+     * @return Reference to the shared ring
+     */
+    static staging_ring& instance(sycl::queue& q) {
+        static staging_ring* ring = new staging_ring(q);
+        return *ring;
+    }
+
+    /**
+     * @brief Check whether uploads on a queue can use this ring
+     * @param q Target queue
+     * @return True if q shares the ring's context and slots were allocated
+     */
+    bool usable(const sycl::queue& q) const {
+        return slots_.size() >= 2 && q.get_context() == context_;
+    }
+
+    /**
+     * @brief Upload count elements into dst starting at dst_index
+     *
+     * Returns once src has been copied into pinned slots; the transfers
+     * complete asynchronously and later commands on dst are ordered after
+     * them by the SYCL runtime.
+     *
+     * @tparam T Trivially copyable element type
+     * @param q Queue to enqueue the transfers on
+     * @param dst Destination device buffer
+     * @param dst_index First destination element
+     * @param src Host source
+     * @param count Number of elements
+     */
+    template<typename T>
+    void upload(sycl::queue& q, sycl::buffer<T>& dst, size_t dst_index, const T* src, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Staged uploads require trivially copyable elements");
+        size_t piece = slot_bytes_ / sizeof(T);
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (size_t offset = 0; offset < count; offset += piece) {
+            size_t n = std::min(piece, count - offset);
+            slot& s = slots_[next_];
+            next_ = (next_ + 1) % slots_.size();
+
+            // Only this slot's previous transfer must finish before reuse
+            s.pending.wait();
+            std::memcpy(s.data, src + offset, n * sizeof(T));
+
+            const T* staged = reinterpret_cast<const T*>(s.data);
+            s.pending = q.submit([&](sycl::handler& cgh) {
+                auto acc = dst.template get_access<sycl::access::mode::write>(
+                    cgh, sycl::range<1>(n), sycl::id<1>(dst_index + offset));
+                cgh.copy(staged, acc);
+            });
+        }
+    }
+
+    /**
+     * @brief Upload count elements to a USM device pointer
+     *
+     * Like the buffer overload, but ordering is explicit: each piece
+     * depends on events and its event is appended to events.
+     *
+     * @tparam T Trivially copyable element type
+     * @param q Queue to enqueue the transfers on
+     * @param dst Destination device pointer
+     * @param src Host source
+     * @param count Number of elements
+     * @param events Work dst must wait for; receives the transfer events
+     */
+    template<typename T>
+    void upload(sycl::queue& q, T* dst, const T* src, size_t count, std::vector<sycl::event>& events) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Staged uploads require trivially copyable elements");
+        size_t piece = slot_bytes_ / sizeof(T);
+        std::vector<sycl::event> deps = events;
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (size_t offset = 0; offset < count; offset += piece) {
+            size_t n = std::min(piece, count - offset);
+            slot& s = slots_[next_];
+            next_ = (next_ + 1) % slots_.size();
+
+            s.pending.wait();
+            std::memcpy(s.data, src + offset, n * sizeof(T));
+            s.pending = q.memcpy(dst + offset, s.data, n * sizeof(T), deps);
+            events.push_back(s.pending);
+        }
+    }
+
+    /**
+     * @brief Get slot size in bytes
+     * @return Bytes per slot
+     */
+    size_t slot_bytes() const noexcept {
+        return slot_bytes_;
+    }
+};
+
+#endif // VULKAN_STDPAR_USE_SYCL
+
+} // namespace memory
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CORE_STAGING_HPP
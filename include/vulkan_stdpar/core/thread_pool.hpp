@@ -0,0 +1,372 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Host worker pool for CPU-side parallel execution
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains the host thread pool used to run algorithms on raw
+ * host pointers in parallel when work is not dispatched to a device.
+ * Workers are pinned to CPUs in NUMA node order, and parallel_for hands
+ * chunk k of a range to the same worker on every call, so repeated passes
+ * over a vector find each chunk in that worker's cache and local memory.
+ */
+
+#ifndef VULKAN_STDPAR_CORE_THREAD_POOL_HPP
+#define VULKAN_STDPAR_CORE_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "numa.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @brief Minimum element count before host algorithms run in parallel
+ */
+#ifndef VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD
+#define VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD 32768
+#endif
+
+/**
+ * @brief Pin host pool workers to CPUs (set to 0 to let the OS place them)
+ */
+#ifndef VULKAN_STDPAR_HOST_PIN_WORKERS
+#define VULKAN_STDPAR_HOST_PIN_WORKERS 1
+#endif
+
+namespace vulkan_stdpar {
+
+/**
+ * @brief Host execution namespace
+ */
+namespace host {
+
+/**
+ * @brief Fixed-size pool of host worker threads
+ *
+ * Each worker has its own task queue. parallel_for sends chunk k to worker
+ * k - 1 (the caller runs chunk 0), so the same range is split and
+ * assigned the same way on every call. A worker whose queue is empty
+ * takes tasks queued for busy workers, trying workers on its own NUMA
+ * node before the others.
+ */
+class thread_pool {
+private:
+    static constexpr size_t no_worker = static_cast<size_t>(-1);
+
+    std::vector<std::thread> workers_;                     ///< Worker threads
+    std::vector<std::deque<std::function<void()>>> queues_; ///< Pending tasks per worker
+    std::vector<size_t> worker_node_;                      ///< NUMA node index of each worker
+    std::vector<char> busy_;                               ///< Worker is running a task
+    std::mutex mutex_;                                     ///< Protects queues_, busy_ and stop_
+    std::condition_variable cv_;                           ///< Signals new tasks and completions
+    bool stop_;                                            ///< Shutdown flag
+
+public:
+    /**
+     * @brief Construct pool
+     * @param num_threads Number of worker threads (0 selects hardware concurrency - 1)
+     */
+    explicit thread_pool(size_t num_threads = 0) : stop_(false) {
+        if (num_threads == 0) {
+            size_t hw = std::thread::hardware_concurrency();
+            num_threads = hw > 1 ? hw - 1 : 0;
+        }
+
+        // CPU slot 0 is left to the calling thread, which runs chunk 0
+        const auto& topology = host::numa_topology::get();
+        std::vector<int> cpus = allowed_cpus(topology);
+        queues_.resize(num_threads);
+        worker_node_.assign(num_threads, 0);
+        busy_.assign(num_threads, 0);
+        workers_.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i) {
+            int cpu = cpus.empty() ? -1 : cpus[(i + 1) % cpus.size()];
+            if (cpu >= 0) worker_node_[i] = topology.node_of_cpu(cpu);
+            workers_.emplace_back([this, i] { worker_loop(i); });
+            pin(workers_.back(), cpu);
+        }
+    }
+
+    /**
+     * @brief Destructor - drains pending tasks and joins workers
+     */
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Non-copyable, non-movable
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /**
+     * @brief Get number of worker threads
+     * @return Worker count (the calling thread also participates in parallel_for)
+     */
+    size_t size() const noexcept {
+        return workers_.size();
+    }
+
+    /**
+     * @brief Get maximum useful parallelism (workers plus caller)
+     * @return Concurrency level
+     */
+    size_t concurrency() const noexcept {
+        return workers_.size() + 1;
+    }
+
+    /**
+     * @brief Get the NUMA node a worker runs on
+     * @param worker Worker index
+     * @return Index into numa_topology::nodes()
+     */
+    size_t worker_node(size_t worker) const {
+        return worker_node_[worker];
+    }
+
+    /**
+     * @brief Run func over [0, count) split into contiguous chunks
+     *
+     * The split depends only on count, grain and the pool size, and chunk
+     * k always goes to worker k - 1, so successive calls over the same
+     * range give each worker the same elements. The calling thread
+     * executes chunk 0 and then helps with tasks of busy workers while
+     * waiting, so nested calls from worker threads cannot deadlock. The
+     * first exception thrown by any chunk is rethrown in the caller.
+     *
+     * @tparam Func Callable as func(size_t begin, size_t end)
+     * @param count Number of iterations
+     * @param grain Minimum iterations per chunk
+     * @param func Chunk body
+     */
+    template<typename Func>
+    void parallel_for(size_t count, size_t grain, Func&& func) {
+        if (count == 0) return;
+
+        size_t max_chunks = grain == 0 ? count : std::max<size_t>(1, count / grain);
+        size_t num_chunks = std::min(concurrency(), max_chunks);
+        if (num_chunks <= 1) {
+            func(size_t(0), count);
+            return;
+        }
+
+        struct completion {
+            std::atomic<size_t> remaining;
+            std::exception_ptr error;
+            std::mutex error_mutex;
+        } done;
+        done.remaining.store(num_chunks - 1, std::memory_order_relaxed);
+
+        auto run_chunk = [&](size_t chunk) {
+            size_t begin = count * chunk / num_chunks;
+            size_t end = count * (chunk + 1) / num_chunks;
+            try {
+                func(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(done.error_mutex);
+                if (!done.error) done.error = std::current_exception();
+            }
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+                queues_[chunk - 1].emplace_back([&run_chunk, &done, chunk, this] {
+                    run_chunk(chunk);
+                    if (done.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        std::lock_guard<std::mutex> wake(mutex_);
+                        cv_.notify_all();
+                    }
+                });
+            }
+        }
+        cv_.notify_all();
+
+        run_chunk(0);
+
+        // Help with queued work until all chunks of this call have finished
+        size_t self = current_worker();
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] {
+                    return done.remaining.load(std::memory_order_acquire) == 0 || can_take(self);
+                });
+                if (done.remaining.load(std::memory_order_acquire) == 0) break;
+                take(self, task);
+            }
+            task();
+        }
+
+        if (done.error) {
+            std::rethrow_exception(done.error);
+        }
+    }
+
+private:
+    /**
+     * @brief Pool and worker index of the calling thread
+     */
+    struct worker_identity {
+        const thread_pool* pool = nullptr;
+        size_t index = no_worker;
+    };
+
+    static worker_identity& identity() {
+        thread_local worker_identity id;
+        return id;
+    }
+
+    /**
+     * @brief Worker index of the calling thread in this pool, or no_worker
+     */
+    size_t current_worker() const {
+        const worker_identity& id = identity();
+        return id.pool == this ? id.index : no_worker;
+    }
+
+    /**
+     * @brief Check whether worker self (or a non-worker) has a task to run
+     *
+     * Own tasks always qualify; another worker's tasks only while that
+     * worker is busy, so an idle worker keeps the chunks meant for it.
+     */
+    bool can_take(size_t self) const {
+        if (self != no_worker && !queues_[self].empty()) return true;
+        for (size_t w = 0; w < queues_.size(); ++w) {
+            if (w != self && busy_[w] && !queues_[w].empty()) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Pop a task for worker self: own queue, then same node, then others
+     */
+    bool take(size_t self, std::function<void()>& task) {
+        if (self != no_worker && !queues_[self].empty()) {
+            task = std::move(queues_[self].front());
+            queues_[self].pop_front();
+            return true;
+        }
+        size_t node = self != no_worker ? worker_node_[self] : no_worker;
+        for (int pass = 0; pass < 2; ++pass) {
+            for (size_t w = 0; w < queues_.size(); ++w) {
+                if (w == self || !busy_[w] || queues_[w].empty()) continue;
+                if ((pass == 0) != (worker_node_[w] == node)) continue;
+                task = std::move(queues_[w].back());
+                queues_[w].pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(size_t index) {
+        identity() = worker_identity{this, index};
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] { return stop_ || can_take(index); });
+                if (!take(index, task)) return;
+                busy_[index] = 1;
+                // Tasks left behind are now stealable
+                if (!queues_[index].empty()) cv_.notify_all();
+            }
+            task();
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_[index] = 0;
+        }
+    }
+
+    /**
+     * @brief CPUs this process may run on, grouped by NUMA node
+     */
+    static std::vector<int> allowed_cpus(const host::numa_topology& topology) {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        bool known = ::sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+        for (const auto& node : topology.nodes()) {
+            for (int cpu : node.cpus) {
+                if (!known || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) cpus.push_back(cpu);
+            }
+        }
+#else
+        (void)topology;
+#endif
+        return cpus;
+    }
+
+    static void pin(std::thread& worker, int cpu) {
+#if defined(__linux__) && VULKAN_STDPAR_HOST_PIN_WORKERS
+        if (cpu < 0 || cpu >= CPU_SETSIZE) return;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        // Best effort: a failure leaves the worker unpinned
+        (void)::pthread_setaffinity_np(worker.native_handle(), sizeof(set), &set);
+#else
+        (void)worker;
+        (void)cpu;
+#endif
+    }
+};
+
+/**
+ * @brief Get the process-wide host thread pool
+ * @return Reference to the shared pool
+ */
+inline thread_pool& get_thread_pool() {
+    static thread_pool pool;
+    return pool;
+}
+
+/**
+ * @brief Run func over [0, count) on the shared pool
+ * @tparam Func Callable as func(size_t begin, size_t end)
+ * @param count Number of iterations
+ * @param func Chunk body
+ * @param grain Minimum iterations per chunk
+ */
+template<typename Func>
+void parallel_for(size_t count, Func&& func, size_t grain = VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD / 4) {
+    get_thread_pool().parallel_for(count, grain, std::forward<Func>(func));
+}
+
+/**
+ * @brief Check whether a range is large enough to run in parallel
+ * @param count Number of elements
+ * @return True if count meets the parallel threshold
+ */
+inline bool should_parallelize(size_t count) noexcept {
+    return count >= VULKAN_STDPAR_HOST_PARALLEL_THRESHOLD && get_thread_pool().size() > 0;
+}
+
+} // namespace host
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_CORE_THREAD_POOL_HPP
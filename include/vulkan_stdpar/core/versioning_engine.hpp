@@ -13,14 +13,24 @@
 #define VULKAN_STDPAR_CORE_VERSIONING_ENGINE_HPP
 
 #include <atomic>
+#include <chrono>
 #include <vector>
 #include <memory>
 #include <shared_mutex>
 #include <mutex>
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "host_storage.hpp"
+#include "device_cache.hpp"
+#include "residency.hpp"
+#include "staging.hpp"
 
 #ifdef VULKAN_STDPAR_USE_SYCL
+#include <optional>
 #include <sycl/sycl.hpp>
 #endif
 
@@ -107,44 +117,73 @@ struct dirty_range {
 /**
  * @brief Memory state manager with dirty range tracking
  * @tparam T Element type
+ * @tparam Alloc Host storage allocator
  */
-template<typename T>
-class versioning_engine {
+template<typename T, typename Alloc = std::allocator<T>>
+class versioning_engine : private memory::device_resident {
 public:
     using value_type = T;
     using size_type = size_t;
+    using allocator_type = Alloc;
     
 private:
     mutable std::atomic<memory_state> state_;     ///< Current memory state
+    std::atomic<uint64_t> host_epoch_;            ///< Bumped when host snapshots go stale
     mutable std::vector<dirty_range> dirty_ranges_; ///< Modified regions
+    mutable std::vector<dirty_range> undefined_ranges_; ///< Discarded host ranges the next device allocation skips
     mutable std::shared_mutex mutex_;             ///< Thread safety
+    mutable std::atomic<unsigned> host_writers_{0}; ///< Writable host views open on the storage
     
 #ifdef VULKAN_STDPAR_USE_SYCL
-    sycl::buffer<T> device_buffer_;            ///< Device memory buffer
+#ifdef VULKAN_STDPAR_USE_USM
+    using device_cache = memory::device_usm_cache;
+#else
+    using device_cache = memory::device_buffer_cache;
+#endif
+    using device_block = device_cache::block_type;
+    mutable std::optional<device_block> device_block_;      ///< Allocation checked out of the cache
+#ifdef VULKAN_STDPAR_USE_USM
+    mutable T* device_ptr_ = nullptr;                       ///< Typed view of device_block_
+    mutable std::vector<sycl::event> device_events_;        ///< Outstanding work on device_ptr_
+#else
+    mutable std::optional<sycl::buffer<T>> device_buffer_;  ///< Typed view of device_block_
+#endif
+    mutable std::optional<memory::residency_manager::handle> residency_; ///< LRU registration
+    mutable std::atomic<unsigned> device_pins_{0};          ///< Kernels using the device copy
+    mutable bool zero_copy_ = false;                        ///< Device view aliases host storage
 #endif
-    std::vector<T> host_data_;                  ///< Host memory storage
+    mutable host_storage<T, Alloc> host_data_;  ///< Host memory storage
     size_type capacity_;                         ///< Allocated capacity
-    bool device_allocated_;                       ///< Device buffer allocation flag
+    mutable bool device_allocated_;               ///< Device buffer allocation flag
     
 public:
     /**
      * @brief Construct versioning engine
      * @param capacity Initial capacity
+     * @param options Host storage configuration
+     * @param alloc Host storage allocator
      */
-    explicit versioning_engine(size_type capacity = 0)
+    explicit versioning_engine(size_type capacity = 0, const storage_options& options = storage_options(),
+                               const Alloc& alloc = Alloc())
         : state_(memory_state::clean)
+        , host_epoch_(0)
+        , host_data_(capacity, options, alloc)
         , capacity_(capacity)
         , device_allocated_(false)
-    {
-        host_data_.reserve(capacity_);
-    }
+    {}
     
     /**
-     * @brief Destructor - ensures proper cleanup
+     * @brief Destructor - returns the device allocation to the buffer cache
+     * 
+     * Device-dirty data is not copied back: the host storage is released
+     * together with the engine.
      */
     ~versioning_engine() {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // Locked so a concurrent eviction cannot race the release
         std::unique_lock<std::shared_mutex> lock(mutex_);
-        sync_to_host_impl(lock);
+        release_device_buffer();
+#endif
     }
     
     // Non-copyable but movable
@@ -153,17 +192,22 @@ public:
     
     versioning_engine(versioning_engine&& other) noexcept
         : state_(other.state_.load())
+        , host_epoch_(other.host_epoch_.load())
         , dirty_ranges_(std::move(other.dirty_ranges_))
+        , undefined_ranges_(std::move(other.undefined_ranges_))
         , host_data_(std::move(other.host_data_))
-#ifdef VULKAN_STDPAR_USE_SYCL
-        , device_buffer_(std::move(other.device_buffer_))
-#endif
         , capacity_(other.capacity_)
         , device_allocated_(other.device_allocated_)
     {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        std::unique_lock<std::shared_mutex> lock(other.mutex_);
+        device_allocated_ = other.device_allocated_;
+        take_device_buffer(other);
+#endif
         other.capacity_ = 0;
         other.device_allocated_ = false;
         other.state_.store(memory_state::clean);
+        other.host_epoch_.fetch_add(1, std::memory_order_release);
     }
     
     versioning_engine& operator=(versioning_engine&& other) noexcept {
@@ -173,10 +217,17 @@ public:
             std::lock(lock1, lock2);
             
             state_ = other.state_.load();
+            host_epoch_.store(std::max(host_epoch_.load(), other.host_epoch_.load()) + 1,
+                              std::memory_order_release);
             dirty_ranges_ = std::move(other.dirty_ranges_);
+            undefined_ranges_ = std::move(other.undefined_ranges_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+            // Before the host storage goes: a zero-copy view may alias it
+            release_device_buffer();
+#endif
             host_data_ = std::move(other.host_data_);
 #ifdef VULKAN_STDPAR_USE_SYCL
-            device_buffer_ = std::move(other.device_buffer_);
+            take_device_buffer(other);
 #endif
             capacity_ = other.capacity_;
             device_allocated_ = other.device_allocated_;
@@ -184,6 +235,7 @@ public:
             other.capacity_ = 0;
             other.device_allocated_ = false;
             other.state_.store(memory_state::clean);
+            other.host_epoch_.fetch_add(1, std::memory_order_release);
         }
         return *this;
     }
@@ -248,10 +300,40 @@ public:
     
     /**
      * @brief Synchronize device modifications to host
+     * 
+     * Returns without locking unless the engine is device dirty, so readers
+     * of up-to-date host data (including every empty vector sharing one
+     * engine) do not contend.
      */
     void sync_to_host() const {
+        if (get_memory_state() != memory_state::device_dirty) return;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_host_impl(lock);
+    }
+    
+    /**
+     * @brief Make the host copy current without downloading the device copy
+     * 
+     * For callers about to overwrite every element in use on the host. A
+     * device-dirty copy is dropped instead of transferred; the caller marks
+     * what it writes dirty, and later uploads are ordered after pending
+     * kernels. Kernels writing host memory in place (zero-copy) are waited
+     * for.
+     */
+    void discard_device_copy() {
+        if (get_memory_state() != memory_state::device_dirty) return;
         std::unique_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (zero_copy_ || !device_allocated_) {
+            sync_to_host_impl(lock);
+            return;
+        }
+        if (get_memory_state() == memory_state::device_dirty) {
+            state_.store(memory_state::clean, std::memory_order_release);
+        }
+#else
         sync_to_host_impl(lock);
+#endif
     }
     
     /**
@@ -263,6 +345,284 @@ public:
         resize_impl(lock, new_capacity);
     }
     
+    /**
+     * @brief Use a file mapping as host storage, replacing current contents
+     * 
+     * Host and device start clean: the device copy, if any, is dropped and
+     * the next device use uploads straight from the mapping.
+     * 
+     * @param path File to map
+     * @param mode Whether modifications reach the file
+     * @param offset Byte offset of the first element (multiple of alignof(T))
+     * @param length Bytes to map (default: to the end of the file)
+     */
+    void map_file(const std::string& path, map_mode mode, size_t offset = 0,
+                  size_t length = static_cast<size_t>(-1)) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // Before the old storage is freed: a zero-copy buffer aliases it and
+        // pending uploads may still read from it
+        release_device_buffer();
+#endif
+        host_data_.map_file(path, mode, offset, length);
+        capacity_ = host_data_.capacity();
+        dirty_ranges_.clear();
+        undefined_ranges_.clear();
+        state_.store(memory_state::clean, std::memory_order_release);
+        host_epoch_.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Check whether host storage is a file mapping
+     * @return True for storage set up by map_file()
+     */
+    bool is_file_mapped() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return host_data_.is_file_mapped();
+    }
+    
+    /**
+     * @brief Bring the host copy up to date and msync a read_write mapping
+     */
+    void flush_file() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_host_impl(lock);
+        host_data_.flush();
+    }
+    
+    /**
+     * @brief Write back device data and unmap the file
+     * @param count Number of elements in use; a read_write file is trimmed to this
+     */
+    void close_file(size_type count) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_host_impl(lock);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        release_device_buffer();
+#endif
+        host_data_.close_file(count * sizeof(T));
+        capacity_ = 0;
+        dirty_ranges_.clear();
+        undefined_ranges_.clear();
+        state_.store(memory_state::clean, std::memory_order_release);
+        host_epoch_.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Declare the contents of [start, end) dead
+     * 
+     * The caller will overwrite the whole range before reading it, so no
+     * pending host modification inside it is uploaded. Without a device
+     * allocation the range is also skipped by the upload that follows the
+     * next allocation, except for parts the host writes and marks dirty.
+     * 
+     * @param start First element
+     * @param end One past the last element
+     */
+    void discard_range(size_type start, size_type end) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        discard_range_impl(lock, start, end);
+    }
+    
+    /**
+     * @brief Set elements [start, end) to value on the device
+     * 
+     * Other pending host modifications are uploaded first; the range itself
+     * is neither written on the host nor transferred, and the engine
+     * becomes device-dirty. Without SYCL the host storage is filled.
+     * 
+     * @param start First element
+     * @param end One past the last element
+     * @param value Fill value
+     */
+    void fill_device(size_type start, size_type end, const T& value) {
+        if (start == end) return;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        discard_range_impl(lock, start, end);
+        sync_to_device_impl(lock);
+        
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_USE_USM
+        sycl::event filled = queue.fill(device_ptr_ + start, value, end - start, device_events_);
+        device_events_.assign(1, filled);
+#else
+        queue.submit([&](sycl::handler& cgh) {
+            auto acc = device_buffer_->template get_access<sycl::access::mode::write>(
+                cgh, sycl::range<1>(end - start), sycl::id<1>(start));
+            cgh.fill(acc, value);
+        });
+#endif
+        mark_device_dirty_impl(lock);
+#else
+        std::fill(host_data_.data() + start, host_data_.data() + end, value);
+        mark_host_dirty_impl(lock, start, end);
+#endif
+    }
+    
+    /**
+     * @brief Check whether the newest data lives only in device memory
+     * 
+     * True when the engine is device-dirty and the device copy is a
+     * separate allocation rather than a zero-copy view of host storage.
+     * Inserts and copies use this to keep such data on the device.
+     * 
+     * @return True if the device copy is newer than host storage
+     */
+    bool is_device_resident() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        return get_memory_state() == memory_state::device_dirty && device_allocated_ && !zero_copy_;
+#else
+        return false;
+#endif
+    }
+    
+    /**
+     * @brief Copy elements from another engine's device copy
+     * 
+     * If source is device-resident, its elements [source_offset,
+     * source_offset + count) are copied device to device, asynchronously,
+     * to [offset, offset + count) of this engine's device copy, and this
+     * engine becomes device-dirty. Neither host storage is touched. This
+     * engine must either be device-resident already or have no device
+     * allocation; in the latter case one is checked out and the rest of it
+     * is undefined until filled by further copies or upload_range().
+     * 
+     * @param source Engine to copy from (must not be this)
+     * @param count Elements to copy
+     * @param offset First element written in this engine
+     * @param source_offset First element read from source
+     * @return False if nothing was copied: the caller must copy through the
+     *         host (source not device-resident, this engine's device copy is
+     *         not newer than its host copy, or no device memory available)
+     */
+    bool copy_device_from(const versioning_engine& source, size_type count, size_type offset = 0,
+                          size_type source_offset = 0) {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        // Allocating below may evict; the pin keeps the source (locked here) out of that
+        auto source_pin = source.pin_device();
+        std::unique_lock<std::shared_mutex> lock1(mutex_, std::defer_lock);
+        std::unique_lock<std::shared_mutex> lock2(source.mutex_, std::defer_lock);
+        std::lock(lock1, lock2);
+        
+        if (count == 0 || source.get_memory_state() != memory_state::device_dirty ||
+            !source.device_allocated_ || source.zero_copy_) {
+            return false;
+        }
+        if (device_allocated_ && (zero_copy_ || get_memory_state() != memory_state::device_dirty)) {
+            return false;
+        }
+        assert(offset + count <= capacity_ && source_offset + count <= source.capacity_);
+        
+        if (!device_allocated_) {
+            try {
+                allocate_device_block(lock1);
+            } catch (const out_of_memory_exception&) {
+                return false;
+            }
+        }
+        
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_USE_USM
+        std::vector<sycl::event> after = source.device_events_;
+        after.insert(after.end(), device_events_.begin(), device_events_.end());
+        sycl::event copied = queue.memcpy(device_ptr_ + offset, source.device_ptr_ + source_offset,
+                                          count * sizeof(T), after);
+        device_events_.assign(1, copied);
+        // Later kernels writing the source must not overtake the copy
+        source.device_events_.push_back(copied);
+#else
+        queue.submit([&](sycl::handler& cgh) {
+            auto from = source.device_buffer_->template get_access<sycl::access::mode::read>(
+                cgh, sycl::range<1>(count), sycl::id<1>(source_offset));
+            auto to = device_buffer_->template get_access<sycl::access::mode::write>(
+                cgh, sycl::range<1>(count), sycl::id<1>(offset));
+            cgh.copy(from, to);
+        });
+#endif
+        mark_device_dirty_impl(lock1);
+        return true;
+#else
+        (void)source;
+        (void)count;
+        (void)offset;
+        (void)source_offset;
+        return false;
+#endif
+    }
+    
+    /**
+     * @brief Move device elements [first, last) to start at index to
+     * 
+     * Used to open a gap for an insert without downloading. The ranges may
+     * overlap; the elements go through a scratch block from the device
+     * cache, counted against the residency budget.
+     * Requires is_device_resident() and to + (last - first) <= capacity().
+     * 
+     * @param first First element to move
+     * @param last One past the last element to move
+     * @param to New index of first
+     */
+    void shift_device_range(size_type first, size_type last, size_type to) {
+        if (first == last || first == to) return;
+#ifdef VULKAN_STDPAR_USE_SYCL
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        assert(device_allocated_ && !zero_copy_ && to + (last - first) <= capacity_);
+        sycl::queue queue = get_default_queue();
+        size_type count = last - first;
+        memory::residency_manager::handle handle;
+        device_block block = checkout_device_block(count * sizeof(T), handle);
+#ifdef VULKAN_STDPAR_USE_USM
+        T* scratch = memory::view_device_block<T>(block, count);
+        sycl::event staged = queue.memcpy(scratch, device_ptr_ + first, count * sizeof(T),
+                                          device_events_);
+        queue.memcpy(device_ptr_ + to, scratch, count * sizeof(T), staged).wait();
+        device_events_.clear();
+#else
+        {
+            // The typed view must be gone before the block is checked in
+            sycl::buffer<T> scratch = memory::view_device_block<T>(block, count);
+            queue.submit([&](sycl::handler& cgh) {
+                auto from = device_buffer_->template get_access<sycl::access::mode::read>(
+                    cgh, sycl::range<1>(count), sycl::id<1>(first));
+                auto tmp = scratch.template get_access<sycl::access::mode::discard_write>(cgh);
+                cgh.copy(from, tmp);
+            });
+            queue.submit([&](sycl::handler& cgh) {
+                auto tmp = scratch.template get_access<sycl::access::mode::read>(cgh);
+                auto dest = device_buffer_->template get_access<sycl::access::mode::write>(
+                    cgh, sycl::range<1>(count), sycl::id<1>(to));
+                cgh.copy(tmp, dest);
+            });
+        }
+#endif
+        checkin_device_block(std::move(block), handle);
+#else
+        (void)to;
+#endif
+    }
+    
+    /**
+     * @brief Upload host elements [start, end) into a device-resident copy
+     * 
+     * Lets callers write new elements on the host and push just those to
+     * the device, keeping the engine device-dirty instead of downloading
+     * everything first. Requires is_device_resident().
+     * 
+     * @param start First element
+     * @param end One past the last element
+     */
+    void upload_range(size_type start, size_type end) {
+        if (start == end) return;
+#ifdef VULKAN_STDPAR_USE_SYCL
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        assert(device_allocated_ && !zero_copy_ && end <= capacity_);
+        sycl::queue queue = get_default_queue();
+        upload_spans(queue, {memory::upload_span{start, end}});
+#endif
+    }
+    
     /**
      * @brief Get current capacity
      * @return Current capacity
@@ -271,6 +631,34 @@ public:
         return capacity_;
     }
     
+    /**
+     * @brief Get host storage configuration
+     * @return Storage options
+     */
+    const storage_options& get_storage_options() const noexcept {
+        return host_data_.options();
+    }
+    
+    /**
+     * @brief Get host storage allocator
+     * @return Copy of the allocator
+     */
+    Alloc get_allocator() const {
+        return host_data_.get_allocator();
+    }
+    
+    /**
+     * @brief Get host snapshot epoch
+     * 
+     * The epoch changes whenever previously obtained host pointers may no
+     * longer observe current data (reallocation or device-side writes).
+     * 
+     * @return Current host epoch
+     */
+    uint64_t host_epoch() const noexcept {
+        return host_epoch_.load(std::memory_order_acquire);
+    }
+    
     /**
      * @brief Get host data pointer (read-only access)
      * @return Pointer to host data
@@ -290,14 +678,47 @@ public:
     }
     
 #ifdef VULKAN_STDPAR_USE_SYCL
+#ifdef VULKAN_STDPAR_USE_USM
+    /**
+     * @brief Get device pointer, allocating and uploading host data if needed
+     * 
+     * The upload may still be in flight: kernels using the pointer must
+     * depend on get_device_events().
+     * 
+     * @return Device pointer to capacity() elements
+     */
+    T* get_device_pointer() const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+        return device_ptr_;
+    }
+    
     /**
-     * @brief Get device buffer
+     * @brief Get events that work on the device pointer must wait for
+     * @return Outstanding upload events
+     */
+    std::vector<sycl::event> get_device_events() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return device_events_;
+    }
+    
+    /**
+     * @brief Replace outstanding events with one that depends on them all
+     * @param event Event of work submitted against the device pointer
+     */
+    void set_device_event(sycl::event event) const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        device_events_.assign(1, std::move(event));
+    }
+#else
+    /**
+     * @brief Get device buffer, allocating and uploading host data if needed
      * @return Reference to device buffer
      */
     sycl::buffer<T>& get_device_buffer() {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        ensure_device_allocated(lock);
-        return device_buffer_;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+        return *device_buffer_;
     }
     
     /**
@@ -305,12 +726,83 @@ public:
      * @return Const reference to device buffer
      */
     const sycl::buffer<T>& get_device_buffer() const {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        sync_to_device_impl(lock);
+        return *device_buffer_;
+    }
+#endif
+    
+    /**
+     * @brief Check whether a device allocation is currently held
+     * @return True if a device buffer is allocated
+     */
+    bool has_device_buffer() const {
         std::shared_lock<std::shared_mutex> lock(mutex_);
-        ensure_device_allocated(lock);
-        return device_buffer_;
+        return device_allocated_;
+    }
+    
+    /**
+     * @brief RAII guard that keeps the device copy resident
+     * 
+     * Held across a kernel launch so the residency manager cannot evict
+     * the buffer between upload and mark_device_dirty().
+     */
+    class device_pin {
+    private:
+        const versioning_engine* engine_;
+        
+    public:
+        explicit device_pin(const versioning_engine& engine) : engine_(&engine) {
+            engine_->device_pins_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        
+        ~device_pin() {
+            if (engine_) engine_->device_pins_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        
+        device_pin(device_pin&& other) noexcept : engine_(other.engine_) {
+            other.engine_ = nullptr;
+        }
+        
+        device_pin(const device_pin&) = delete;
+        device_pin& operator=(const device_pin&) = delete;
+        device_pin& operator=(device_pin&&) = delete;
+    };
+    
+    /**
+     * @brief Pin the device copy for the lifetime of the returned guard
+     * @return Pin guard
+     */
+    device_pin pin_device() const {
+        return device_pin(*this);
     }
 #endif
     
+    /**
+     * @brief Register a writable host view on the storage
+     * 
+     * While any are open, copy-on-write copies duplicate the storage
+     * instead of sharing it, so writes made through the view stay private.
+     */
+    void retain_host_writer() const noexcept {
+        host_writers_.fetch_add(1, std::memory_order_acq_rel);
+    }
+    
+    /**
+     * @brief Unregister a writable host view
+     */
+    void release_host_writer() const noexcept {
+        host_writers_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    
+    /**
+     * @brief Check whether writable host views are open
+     * @return True if any retain_host_writer() is outstanding
+     */
+    bool has_host_writers() const noexcept {
+        return host_writers_.load(std::memory_order_acquire) != 0;
+    }
+    
     /**
      * @brief Clear all dirty ranges
      */
@@ -379,36 +871,90 @@ private:
      */
     void mark_device_dirty_impl(std::unique_lock<std::shared_mutex>& lock) {
         dirty_ranges_.clear();
+        undefined_ranges_.clear();
         state_.store(memory_state::device_dirty, std::memory_order_release);
+        host_epoch_.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Remove cut from a list of disjoint ranges
+     */
+    static void subtract_range(std::vector<dirty_range>& ranges, const dirty_range& cut) {
+        std::vector<dirty_range> kept;
+        kept.reserve(ranges.size() + 1);
+        for (const auto& range : ranges) {
+            if (!range.overlaps(cut)) {
+                kept.push_back(range);
+                continue;
+            }
+            if (range.start < cut.start) kept.emplace_back(range.start, cut.start);
+            if (cut.end < range.end) kept.emplace_back(cut.end, range.end);
+        }
+        ranges.swap(kept);
+    }
+    
+    /**
+     * @brief Implementation of discard_range with lock held
+     */
+    void discard_range_impl(std::unique_lock<std::shared_mutex>& /*lock*/, size_type start, size_type end) {
+        assert(start <= end && end <= capacity_);
+        if (start == end) return;
+        
+        subtract_range(dirty_ranges_, dirty_range(start, end));
+        if (dirty_ranges_.empty() && get_memory_state() == memory_state::host_dirty) {
+            state_.store(memory_state::clean, std::memory_order_release);
+        }
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (!device_allocated_) add_undefined_range(start, end);
+#endif
+    }
+    
+    /**
+     * @brief Record a discarded host range, merging it with the others
+     */
+    void add_undefined_range(size_type start, size_type end) {
+        undefined_ranges_.emplace_back(start, end);
+        auto spans = memory::coalesce_spans(undefined_ranges_, 0);
+        undefined_ranges_.clear();
+        for (const auto& span : spans) undefined_ranges_.emplace_back(span.start, span.end);
     }
     
     /**
      * @brief Implementation of sync_to_device with lock held
      */
     void sync_to_device_impl(std::unique_lock<std::shared_mutex>& lock) const {
-        if (get_memory_state() != memory_state::host_dirty) return;
-        
 #ifdef VULKAN_STDPAR_USE_SYCL
         ensure_device_allocated(lock);
+#endif
+        if (get_memory_state() != memory_state::host_dirty) return;
         
-        // Copy dirty ranges to device
-        for (const auto& range : dirty_ranges_) {
-            if (!range.empty()) {
-                auto host_sub = host_data_.data() + range.start;
-                auto device_sub = device_buffer_[sycl::range<1>(range.start)];
-                auto size = range.size();
-                
-                // Submit copy command
-                sycl::queue queue = get_default_queue();
-                queue.submit([&](sycl::handler& cgh) {
-                    auto device_acc = device_sub.get_access<sycl::access::mode::write>(cgh);
-                    cgh.copy(host_sub, device_acc, size);
-                });
-            }
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (zero_copy_) {
+#ifndef VULKAN_STDPAR_USE_USM
+            // Host writes went straight into the buffer's memory; tell the runtime
+            sycl::host_accessor<T, 1, sycl::access_mode::write> acc(*device_buffer_, sycl::no_init);
+            (void)acc;
+#endif
+            dirty_ranges_.clear();
+            state_.store(memory_state::clean, std::memory_order_release);
+            return;
         }
         
-        // Wait for completion
-        get_default_queue().wait();
+        // Join nearby dirty ranges into a few large spans
+        sycl::queue queue = get_default_queue();
+        auto spans = memory::coalesce_spans(
+            dirty_ranges_, VULKAN_STDPAR_STAGING_COALESCE_BYTES / sizeof(T));
+        
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        auto start_time = std::chrono::high_resolution_clock::now();
+#endif
+        upload_spans(queue, spans);
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        uint64_t bytes = 0;
+        for (const auto& span : spans) bytes += (span.end - span.start) * sizeof(T);
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_transfer_to_device(bytes, elapsed.count());
+#endif
 #endif
         
         dirty_ranges_.clear();
@@ -424,14 +970,39 @@ private:
 #ifdef VULKAN_STDPAR_USE_SYCL
         if (!device_allocated_) return;
         
+        if (zero_copy_) {
+            // Kernels wrote host memory in place; only wait for them
+#ifdef VULKAN_STDPAR_USE_USM
+            sycl::event::wait(device_events_);
+            device_events_.clear();
+#else
+            sycl::host_accessor<T, 1, sycl::access_mode::read> acc(*device_buffer_);
+            (void)acc;
+#endif
+            state_.store(memory_state::clean, std::memory_order_release);
+            return;
+        }
+        
         // Copy entire buffer from device to host
         sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        auto start_time = std::chrono::high_resolution_clock::now();
+#endif
+#ifdef VULKAN_STDPAR_USE_USM
+        queue.memcpy(host_data_.data(), device_ptr_, capacity_ * sizeof(T), device_events_).wait();
+        device_events_.clear();
+#else
         queue.submit([&](sycl::handler& cgh) {
-            auto device_acc = device_buffer_.get_access<sycl::access::mode::read>(cgh);
+            auto device_acc = device_buffer_->template get_access<sycl::access::mode::read>(cgh);
             cgh.copy(device_acc, host_data_.data());
         });
         
         queue.wait();
+#endif
+#ifdef VULKAN_STDPAR_ENABLE_PROFILING
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        profiling::record_transfer_from_device(capacity_ * sizeof(T), elapsed.count());
+#endif
 #endif
         
         state_.store(memory_state::clean, std::memory_order_release);
@@ -443,50 +1014,302 @@ private:
     void resize_impl(std::unique_lock<std::shared_mutex>& lock, size_type new_capacity) {
         if (new_capacity <= capacity_) return;
         
-        // Resize host storage
-        host_data_.reserve(new_capacity);
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (zero_copy_) {
+            // The device view aliases the storage about to grow; rebind on next use
+            sync_to_host_impl(lock);
+            release_device_buffer();
+        }
+#endif
+        
+        // Grow host storage, keeping every element written so far
+        const T* old_data = host_data_.data();
+        host_data_.reallocate(new_capacity, capacity_);
         
 #ifdef VULKAN_STDPAR_USE_SYCL
         if (device_allocated_) {
-            // Create new device buffer
-            sycl::buffer<T> new_buffer(new_capacity);
-            
-            // Copy old data if device is dirty
             if (get_memory_state() == memory_state::device_dirty) {
-                sycl::queue queue = get_default_queue();
-                queue.submit([&](sycl::handler& cgh) {
-                    auto old_acc = device_buffer_.get_access<sycl::access::mode::read>(cgh);
-                    auto new_acc = new_buffer.get_access<sycl::access::mode::write>(cgh);
-                    cgh.copy(old_acc, new_acc, capacity_);
-                });
-                queue.wait();
+                // Device holds the only current copy; move it to a larger buffer
+                auto& residency = memory::residency_manager::instance();
+                auto new_residency =
+                    residency.admit(this, memory::device_bucket_size(new_capacity * sizeof(T)));
+                std::optional<device_block> new_block;
+                try {
+                    new_block = device_cache::instance().checkout(new_capacity * sizeof(T));
+                } catch (...) {
+                    residency.release(new_residency);
+                    throw;
+                }
+                copy_device_prefix(*new_block, new_capacity);
+                release_device_buffer();
+                device_block_ = std::move(new_block);
+                bind_device_view(new_capacity);
+                residency_ = new_residency;
+                device_allocated_ = true;
+            } else {
+                // Host is current: defer reallocation to the next device use, which
+                // uploads the old contents together with whatever is appended meanwhile
+                release_device_buffer();
+                dirty_ranges_.assign(1, dirty_range(0, capacity_));
+                state_.store(memory_state::host_dirty, std::memory_order_release);
             }
-            
-            device_buffer_ = std::move(new_buffer);
         }
+        
+        // The new tail holds nothing until written, which marks it dirty
+        if (!device_allocated_) add_undefined_range(capacity_, new_capacity);
 #endif
         
         capacity_ = new_capacity;
+        if (host_data_.data() != old_data) {
+            host_epoch_.fetch_add(1, std::memory_order_release);
+        }
     }
     
 #ifdef VULKAN_STDPAR_USE_SYCL
     /**
-     * @brief Ensure device buffer is allocated
+     * @brief Ensure a device buffer is allocated (unique lock held)
+     * 
+     * On devices that share host memory the host storage itself becomes
+     * the device copy. Otherwise the allocation comes from the process-wide
+     * buffer cache and may hold stale data, so the whole host copy is
+     * scheduled for upload, except ranges discarded since the last
+     * allocation.
      */
-    void ensure_device_allocated(std::shared_lock<std::shared_mutex>& lock) const {
-        if (!device_allocated_) {
-            // Need to upgrade to unique lock
-            lock.unlock();
-            std::unique_lock<std::shared_mutex> unique_lock(mutex_);
-            
-            // Double-check after acquiring unique lock
-            if (!device_allocated_) {
-                device_buffer_ = sycl::buffer<T>(capacity_);
-                device_allocated_ = true;
+    void ensure_device_allocated(std::unique_lock<std::shared_mutex>& lock) const {
+        auto& residency = memory::residency_manager::instance();
+        if (device_allocated_) {
+            if (residency_) residency.touch(*residency_);
+            return;
+        }
+        
+        if (capacity_ > 0 && memory::supports_zero_copy(get_default_queue().get_device())) {
+            bind_host_view();
+            undefined_ranges_.clear();
+            return;
+        }
+        
+        allocate_device_block(lock);
+        
+        // Upload everything but discarded ranges; host writes to those are already dirty
+        std::vector<dirty_range> upload;
+        if (capacity_ > 0) upload.emplace_back(0, capacity_);
+        for (const auto& hole : undefined_ranges_) subtract_range(upload, hole);
+        upload.insert(upload.end(), dirty_ranges_.begin(), dirty_ranges_.end());
+        dirty_ranges_.clear();
+        for (const auto& span : memory::coalesce_spans(upload, 0)) {
+            dirty_ranges_.emplace_back(span.start, span.end);
+        }
+        undefined_ranges_.clear();
+        state_.store(dirty_ranges_.empty() ? memory_state::clean : memory_state::host_dirty,
+                     std::memory_order_release);
+    }
+    
+    /**
+     * @brief Check out a device allocation for capacity_ elements (unique lock held)
+     * @throws out_of_memory_exception if the device allocation fails
+     */
+    void allocate_device_block(std::unique_lock<std::shared_mutex>& lock) const {
+        auto& residency = memory::residency_manager::instance();
+        static const bool budget_initialized = [&residency] {
+            auto device = get_default_queue().get_device();
+            residency.init_budget(device.get_info<sycl::info::device::global_mem_size>() / 10 * 9);
+            return true;
+        }();
+        (void)budget_initialized;
+        
+        size_type count = std::max<size_type>(capacity_, 1);
+        memory::residency_manager::handle handle;
+        device_block_ = checkout_device_block(count * sizeof(T), handle);
+        residency_ = handle;
+        bind_device_view(count);
+        device_allocated_ = true;
+    }
+    
+    /**
+     * @brief Check out a cached device block counted against the residency budget
+     * 
+     * Other engines may be evicted to make room; this one is kept. Give the
+     * block back with checkin_device_block().
+     * 
+     * @param bytes Required size in bytes
+     * @param handle Set to the block's residency registration
+     * @throws out_of_memory_exception if the device allocation fails
+     */
+    device_block checkout_device_block(size_t bytes, memory::residency_manager::handle& handle) const {
+        auto& residency = memory::residency_manager::instance();
+        handle = residency.admit(this, memory::device_bucket_size(bytes));
+        try {
+            return device_cache::instance().checkout(bytes);
+        } catch (...) {
+            residency.release(handle);
+            throw;
+        }
+    }
+    
+    /**
+     * @brief Return a block from checkout_device_block() to the cache
+     */
+    static void checkin_device_block(device_block block, memory::residency_manager::handle handle) {
+        device_cache::instance().checkin(std::move(block));
+        memory::residency_manager::instance().release(handle);
+    }
+    
+    /**
+     * @brief Return the device allocation to the buffer cache (lock held)
+     */
+    void release_device_buffer() const {
+        if (zero_copy_) {
+            reset_device_view();
+            zero_copy_ = false;
+        }
+        if (residency_) {
+            memory::residency_manager::instance().release(*residency_);
+            residency_.reset();
+        }
+        if (device_block_) {
+            reset_device_view();
+            device_cache::instance().checkin(std::move(*device_block_));
+            device_block_.reset();
+        }
+        device_allocated_ = false;
+    }
+    
+    /**
+     * @brief Use host storage as the device copy (unique lock held)
+     * 
+     * Nothing is uploaded: pending host-dirty ranges are already in the
+     * memory kernels will read. The view takes no device memory, so it is
+     * not registered with the residency manager.
+     */
+    void bind_host_view() const {
+#ifdef VULKAN_STDPAR_USE_USM
+        device_ptr_ = host_data_.data();
+        device_events_.clear();
+#else
+        device_buffer_.emplace(host_data_.data(), sycl::range<1>(capacity_),
+                               sycl::property_list{sycl::property::buffer::use_host_ptr()});
+        // Host coherence is established by sync_to_host, not on destruction
+        device_buffer_->set_write_back(false);
+#endif
+        zero_copy_ = true;
+        device_allocated_ = true;
+    }
+    
+    /**
+     * @brief Point the typed view at the first count elements of device_block_
+     */
+    void bind_device_view(size_type count) const {
+#ifdef VULKAN_STDPAR_USE_USM
+        device_ptr_ = memory::view_device_block<T>(*device_block_, count);
+        device_events_.clear();
+#else
+        device_buffer_ = memory::view_device_block<T>(*device_block_, count);
+#endif
+    }
+    
+    /**
+     * @brief Drop the typed view once outstanding work on it has finished
+     */
+    void reset_device_view() const {
+#ifdef VULKAN_STDPAR_USE_USM
+        sycl::event::wait(device_events_);
+        device_events_.clear();
+        device_ptr_ = nullptr;
+#else
+        device_buffer_.reset();
+#endif
+    }
+    
+    /**
+     * @brief Copy the current capacity_ elements into a larger block
+     */
+    void copy_device_prefix(device_block& to, size_type new_capacity) const {
+        sycl::queue queue = get_default_queue();
+#ifdef VULKAN_STDPAR_USE_USM
+        T* destination = memory::view_device_block<T>(to, new_capacity);
+        queue.memcpy(destination, device_ptr_, capacity_ * sizeof(T), device_events_).wait();
+        device_events_.clear();
+#else
+        sycl::buffer<T> destination = memory::view_device_block<T>(to, new_capacity);
+        queue.submit([&](sycl::handler& cgh) {
+            auto old_acc = device_buffer_->template get_access<sycl::access::mode::read>(
+                cgh, sycl::range<1>(capacity_));
+            auto new_acc = destination.template get_access<sycl::access::mode::write>(
+                cgh, sycl::range<1>(capacity_));
+            cgh.copy(old_acc, new_acc);
+        });
+        queue.wait();
+#endif
+    }
+    
+    /**
+     * @brief Upload host spans to the device buffer (unique lock held)
+     * 
+     * Trivially copyable data streams through the pinned staging ring and
+     * returns without waiting: the SYCL runtime orders later work on the
+     * buffer after the transfers, and the host copy may change meanwhile
+     * because it has already been staged. Other data is copied directly.
+     */
+    void upload_spans(sycl::queue& queue, const std::vector<memory::upload_span>& spans) const {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            auto& ring = memory::staging_ring::instance(queue);
+            if (ring.usable(queue) && sizeof(T) <= ring.slot_bytes()) {
+                for (const auto& span : spans) {
+#ifdef VULKAN_STDPAR_USE_USM
+                    ring.upload(queue, device_ptr_ + span.start, host_data_.data() + span.start,
+                                span.end - span.start, device_events_);
+#else
+                    ring.upload(queue, *device_buffer_, span.start,
+                                host_data_.data() + span.start, span.end - span.start);
+#endif
+                }
+                return;
             }
-            
-            // Downgrade back to shared lock
-            lock = std::shared_lock<std::shared_mutex>(std::move(unique_lock));
+        }
+        
+#ifdef VULKAN_STDPAR_USE_USM
+        // Pageable source: copies must finish before the host may change it
+        std::vector<sycl::event> copies;
+        for (const auto& span : spans) {
+            copies.push_back(queue.memcpy(device_ptr_ + span.start, host_data_.data() + span.start,
+                                          (span.end - span.start) * sizeof(T), device_events_));
+        }
+        sycl::event::wait(copies);
+        device_events_.clear();
+#else
+        for (const auto& span : spans) {
+            const T* host_sub = host_data_.data() + span.start;
+            queue.submit([&](sycl::handler& cgh) {
+                auto device_acc = device_buffer_->template get_access<sycl::access::mode::write>(
+                    cgh, sycl::range<1>(span.end - span.start), sycl::id<1>(span.start));
+                cgh.copy(host_sub, device_acc);
+            });
+        }
+        queue.wait();
+#endif
+    }
+    
+    /**
+     * @brief Move other's device allocation into this engine (both locked)
+     */
+    void take_device_buffer(versioning_engine& other) {
+        device_block_ = std::move(other.device_block_);
+#ifdef VULKAN_STDPAR_USE_USM
+        device_ptr_ = other.device_ptr_;
+        device_events_ = std::move(other.device_events_);
+        other.device_ptr_ = nullptr;
+        other.device_events_.clear();
+#else
+        device_buffer_ = std::move(other.device_buffer_);
+        other.device_buffer_.reset();
+#endif
+        residency_ = other.residency_;
+        zero_copy_ = other.zero_copy_;
+        other.zero_copy_ = false;
+        other.device_block_.reset();
+        other.residency_.reset();
+        if (residency_) {
+            memory::residency_manager::instance().rebind(*residency_, this);
         }
     }
     
@@ -494,10 +1317,36 @@ private:
      * @brief Get default SYCL queue
      */
     static sycl::queue get_default_queue() {
-        static sycl::queue default_queue;
-        return default_queue;
+        return queue::get_default_queue();
     }
 #endif
+    
+    /**
+     * @brief Evict the device copy to host unless busy (called by the residency manager)
+     * @return Bytes freed
+     */
+    size_t try_evict() const override {
+#ifdef VULKAN_STDPAR_USE_SYCL
+        if (device_pins_.load(std::memory_order_acquire) != 0) return 0;
+        std::unique_lock<std::shared_mutex> lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock() || !device_block_ ||
+            device_pins_.load(std::memory_order_acquire) != 0) {
+            return 0;
+        }
+        
+        // Write device-only modifications back; the host copy stays valid
+        sync_to_host_impl(lock);
+        
+        size_t bytes = device_block_->byte_size();
+        reset_device_view();
+        device_block_.reset();
+        residency_.reset();
+        device_allocated_ = false;
+        return bytes;
+#else
+        return 0;
+#endif
+    }
 };
 
 } // namespace vulkan_stdpar
@@ -0,0 +1,836 @@
+/**
+ * @file npy.hpp
+ * @brief NumPy .npy and .npz interchange for unified_vector
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains load_npy, save_npy, load_npz and npz_writer. Loading
+ * parses the array header, checks the dtype against the element type and
+ * maps the payload in place as the vector's host storage, so arrays
+ * written by numpy.save or numpy.savez are usable without a copy. Only
+ * uncompressed archives can be mapped; numpy.savez_compressed output is
+ * rejected.
+ */
+
+#ifndef VULKAN_STDPAR_IO_NPY_HPP
+#define VULKAN_STDPAR_IO_NPY_HPP
+
+#include "../containers/unified_vector.hpp"
+#include "../core/exceptions.hpp"
+#include "posix_file.hpp"
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+/**
+ * @brief Parsed .npy array header
+ */
+struct npy_header {
+    std::string descr;              ///< dtype string, e.g. "<f4"
+    bool fortran_order;             ///< Column-major layout
+    std::vector<size_t> shape;      ///< Array dimensions (empty for a scalar)
+    size_t data_offset;             ///< Offset of the payload from the start of the array
+
+    npy_header() : fortran_order(false), data_offset(0) {}
+
+    /**
+     * @brief Get the number of elements
+     * @return Product of the dimensions
+     */
+    size_t count() const {
+        size_t n = 1;
+        for (size_t dim : shape) n *= dim;
+        return n;
+    }
+};
+
+/**
+ * @brief Options for load_npy and load_npz
+ */
+struct npy_load_options {
+    bool upload_to_device;  ///< Read ahead and upload before returning
+
+    npy_load_options() : upload_to_device(false) {}
+};
+
+namespace detail {
+
+constexpr char npy_magic[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+inline char npy_native_order() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? '<' : '>';
+}
+
+inline uint32_t read_le(const unsigned char* p, size_t bytes) {
+    uint32_t value = 0;
+    for (size_t i = bytes; i-- > 0;) value = (value << 8) | p[i];
+    return value;
+}
+
+inline uint64_t read_le64(const unsigned char* p) {
+    return uint64_t(read_le(p, 4)) | (uint64_t(read_le(p + 4, 4)) << 32);
+}
+
+inline void put_le(std::vector<unsigned char>& out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+}
+
+/**
+ * @brief Minimal parser for the Python dict literal in a .npy header
+ *
+ * Accepts exactly what numpy writes: string keys, a string descr, a
+ * True/False fortran_order and a tuple of integers for shape. Structured
+ * dtypes (a list for descr) are rejected.
+ */
+class npy_dict_parser {
+private:
+    const std::string& text_;
+    const std::string& path_;
+    size_t pos_;
+
+public:
+    npy_dict_parser(const std::string& text, const std::string& path)
+        : text_(text), path_(path), pos_(0) {}
+
+    npy_header parse() {
+        npy_header header;
+        bool has_descr = false, has_order = false, has_shape = false;
+        expect('{');
+        while (!accept('}')) {
+            std::string key = parse_string();
+            expect(':');
+            if (key == "descr") {
+                header.descr = parse_string();
+                has_descr = true;
+            } else if (key == "fortran_order") {
+                header.fortran_order = parse_bool();
+                has_order = true;
+            } else if (key == "shape") {
+                header.shape = parse_shape();
+                has_shape = true;
+            } else {
+                fail("unexpected key '" + key + "'");
+            }
+            if (!accept(',')) {
+                expect('}');
+                break;
+            }
+        }
+        if (!has_descr || !has_order || !has_shape) fail("header is missing a required key");
+        return header;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& what) const {
+        throw io_exception(path_, "invalid .npy header: " + what);
+    }
+
+    void skip_space() {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t')) ++pos_;
+    }
+
+    bool accept(char c) {
+        skip_space();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!accept(c)) fail(std::string("expected '") + c + "'");
+    }
+
+    std::string parse_string() {
+        skip_space();
+        if (pos_ >= text_.size() || (text_[pos_] != '\'' && text_[pos_] != '"')) fail("expected a string");
+        char quote = text_[pos_++];
+        size_t end = text_.find(quote, pos_);
+        if (end == std::string::npos) fail("unterminated string");
+        std::string value = text_.substr(pos_, end - pos_);
+        pos_ = end + 1;
+        return value;
+    }
+
+    bool parse_bool() {
+        skip_space();
+        if (text_.compare(pos_, 4, "True") == 0) {
+            pos_ += 4;
+            return true;
+        }
+        if (text_.compare(pos_, 5, "False") == 0) {
+            pos_ += 5;
+            return false;
+        }
+        fail("expected True or False");
+    }
+
+    std::vector<size_t> parse_shape() {
+        std::vector<size_t> shape;
+        expect('(');
+        while (!accept(')')) {
+            skip_space();
+            size_t start = pos_;
+            size_t value = 0;
+            while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+                value = value * 10 + static_cast<size_t>(text_[pos_++] - '0');
+            }
+            // numpy 1.x may write long literals such as 3L
+            if (pos_ < text_.size() && text_[pos_] == 'L') ++pos_;
+            if (pos_ == start) fail("expected a dimension");
+            shape.push_back(value);
+            if (!accept(',')) {
+                expect(')');
+                break;
+            }
+        }
+        return shape;
+    }
+};
+
+/**
+ * @brief Parse a .npy header from its leading bytes
+ * @param data Start of the array
+ * @param available Bytes available at data
+ * @param path File name for errors
+ * @return Header, or data_offset > available if more bytes are needed
+ */
+inline npy_header parse_npy_header(const unsigned char* data, size_t available, const std::string& path) {
+    if (available < 10 || std::memcmp(data, npy_magic, sizeof(npy_magic)) != 0) {
+        throw io_exception(path, "not a .npy array");
+    }
+    unsigned major = data[6];
+    if (major < 1 || major > 3) {
+        throw io_exception(path, ".npy format version " + std::to_string(major) + " is not supported");
+    }
+    size_t length_bytes = major == 1 ? 2 : 4;
+    if (available < 8 + length_bytes) throw io_exception(path, "truncated .npy header");
+    size_t dict_start = 8 + length_bytes;
+    size_t header_end = dict_start + read_le(data + 8, length_bytes);
+    if (header_end > available) {
+        npy_header partial;
+        partial.data_offset = header_end;
+        return partial;
+    }
+
+    std::string dict(reinterpret_cast<const char*>(data) + dict_start, header_end - dict_start);
+    while (!dict.empty() && (dict.back() == '\n' || dict.back() == ' ' || dict.back() == '\0')) {
+        dict.pop_back();
+    }
+    npy_header header = npy_dict_parser(dict, path).parse();
+    header.data_offset = header_end;
+    return header;
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the NumPy dtype string for an element type
+ *
+ * Covers bool and the arithmetic types, in native byte order.
+ *
+ * @tparam T Element type
+ * @return dtype string such as "<f4" or "|u1"
+ */
+template<typename T>
+std::string npy_descr() {
+    static_assert(std::is_arithmetic<T>::value, "NumPy interchange requires arithmetic elements");
+    char kind = std::is_same<T, bool>::value ? 'b' :
+                std::is_floating_point<T>::value ? 'f' :
+                std::is_unsigned<T>::value ? 'u' : 'i';
+    char order = sizeof(T) == 1 ? '|' : detail::npy_native_order();
+    return std::string(1, order) + kind + std::to_string(sizeof(T));
+}
+
+namespace detail {
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+/**
+ * @brief Read and parse the .npy header of an array starting at offset
+ */
+inline npy_header read_npy_header_at(int fd, size_t offset, size_t file_bytes, const std::string& path) {
+    std::vector<unsigned char> buffer(std::min<size_t>(4096, file_bytes - std::min(offset, file_bytes)));
+    detail::pread_all(fd, buffer.data(), buffer.size(), offset, path);
+    npy_header header = parse_npy_header(buffer.data(), buffer.size(), path);
+    if (header.data_offset > buffer.size()) {
+        if (header.data_offset > file_bytes - offset) throw io_exception(path, "truncated .npy header");
+        buffer.resize(header.data_offset);
+        detail::pread_all(fd, buffer.data(), buffer.size(), offset, path);
+        header = parse_npy_header(buffer.data(), buffer.size(), path);
+    }
+    return header;
+}
+
+inline size_t file_size(int fd, const std::string& path) {
+    struct stat info;
+    if (::fstat(fd, &info) != 0) throw io_exception(path, std::strerror(errno));
+    return static_cast<size_t>(info.st_size);
+}
+#endif
+
+/**
+ * @brief Check a dtype string against an element type
+ *
+ * The kind and size must match and the byte order must be native or
+ * irrelevant ('|'); byte-swapped arrays cannot be mapped in place.
+ */
+template<typename T>
+void check_npy_dtype(const npy_header& header, const std::string& path) {
+    const std::string& descr = header.descr;
+    std::string expected = npy_descr<T>();
+    bool order_ok = descr.size() >= 2 &&
+        (descr[0] == '|' || descr[0] == '=' || descr[0] == npy_native_order());
+    if (!order_ok || descr.compare(1, std::string::npos, expected, 1, std::string::npos) != 0) {
+        throw io_exception(path, "dtype '" + descr + "' does not match element type '" + expected + "'");
+    }
+    if (header.fortran_order && header.shape.size() > 1) {
+        throw io_exception(path, "Fortran-ordered arrays are not supported");
+    }
+}
+
+/**
+ * @brief Serialize a version 1.0 (or 2.0 if large) .npy header
+ */
+template<typename T>
+std::vector<unsigned char> make_npy_header(const std::vector<size_t>& shape) {
+    std::string dict = "{'descr': '" + npy_descr<T>() + "', 'fortran_order': False, 'shape': (";
+    for (size_t i = 0; i < shape.size(); ++i) {
+        dict += (i > 0 ? ", " : "") + std::to_string(shape[i]);
+    }
+    if (shape.size() == 1) dict += ',';
+    dict += "), }";
+
+    // Pad with spaces and a newline so the payload is 64-byte aligned
+    bool large = dict.size() + 1 + 10 > 65535;
+    size_t preamble = large ? 12 : 10;
+    size_t total = (preamble + dict.size() + 1 + 63) / 64 * 64;
+    dict.append(total - preamble - dict.size() - 1, ' ');
+    dict += '\n';
+
+    std::vector<unsigned char> out(npy_magic, npy_magic + sizeof(npy_magic));
+    out.push_back(large ? 2 : 1);
+    out.push_back(0);
+    put_le(out, dict.size(), large ? 4 : 2);
+    out.insert(out.end(), dict.begin(), dict.end());
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief Read the header of a .npy file
+ * @param path .npy file
+ * @return Parsed header; data_offset is the payload's file offset
+ * @throws io_exception if the file cannot be read or is not a .npy array
+ */
+inline npy_header read_npy_header(const std::string& path) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    return detail::read_npy_header_at(file.get(), 0, detail::file_size(file.get(), path), path);
+#else
+    (void)path;
+    throw unsupported_operation_exception("read_npy_header without POSIX file I/O");
+#endif
+}
+
+namespace detail {
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+/**
+ * @brief Map the array at array_offset of an open file as a vector
+ *
+ * array_bytes bounds the array (header plus payload) so trailing archive
+ * data is not mapped.
+ */
+template<typename T>
+unified_vector<T> map_npy_array(int fd, const std::string& path, size_t array_offset,
+                                size_t array_bytes, const npy_load_options& options) {
+    size_t file_bytes = file_size(fd, path);
+    npy_header header = read_npy_header_at(fd, array_offset, file_bytes, path);
+    check_npy_dtype<T>(header, path);
+
+    size_t payload_offset = array_offset + header.data_offset;
+    size_t payload_bytes = header.count() * sizeof(T);
+    if (header.data_offset + payload_bytes != array_bytes) {
+        throw io_exception(path, "array size does not match its shape");
+    }
+    if (payload_bytes == 0) return unified_vector<T>();
+    if (payload_offset % alignof(T) != 0) {
+        // Cannot map in place (e.g. a numpy.savez entry); read a copy instead
+        unified_vector<T> vec(header.count(), no_init);
+        pread_all(fd, vec.get_engine().host_data(), payload_bytes, payload_offset, path);
+        vec.get_engine().mark_host_dirty(0, vec.size());
+        if (options.upload_to_device) vec.prefetch_to_device();
+        return vec;
+    }
+
+    if (options.upload_to_device) {
+        // Start readahead so the staged upload below overlaps with disk reads
+        ::posix_fadvise(fd, static_cast<off_t>(payload_offset), static_cast<off_t>(payload_bytes),
+                        POSIX_FADV_WILLNEED);
+    }
+    auto vec = unified_vector<T>::map_file(path, map_mode::read_only, payload_offset, payload_bytes);
+    if (options.upload_to_device) vec.prefetch_to_device();
+    return vec;
+}
+#endif
+
+/**
+ * @brief CRC-32 (IEEE) as required by zip entries
+ */
+inline uint32_t crc32_update(uint32_t crc, const void* data, size_t bytes) {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < bytes; ++i) crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+} // namespace detail
+
+/**
+ * @brief Load a .npy file into a vector backed by the file
+ *
+ * The payload is mapped copy-on-write and adopted as host storage, so
+ * pages are read on first access and the file is never modified.
+ * Multi-dimensional arrays load flattened in C order; use
+ * read_npy_header for the shape. With options.upload_to_device the
+ * kernel is asked to read the payload ahead and the vector is uploaded
+ * before returning, staged in slot-sized pieces that overlap with the
+ * remaining reads.
+ *
+ * @tparam T Element type matching the array's dtype
+ * @param path .npy file
+ * @param options Load settings
+ * @return Vector holding the array's elements
+ * @throws io_exception if the file is not a .npy array, its dtype does not
+ *         match T, or it is byte-swapped or Fortran-ordered
+ */
+template<typename T>
+unified_vector<T> load_npy(const std::string& path, const npy_load_options& options = npy_load_options()) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    size_t file_bytes = detail::file_size(file.get(), path);
+    return detail::map_npy_array<T>(file.get(), path, 0, file_bytes, options);
+#else
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("load_npy without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Write a vector to a .npy file, replacing it
+ *
+ * Device-side modifications are synchronized first. The header is padded
+ * so the payload is 64-byte aligned, as numpy does.
+ *
+ * @tparam T Arithmetic element type
+ * @tparam Alloc Vector allocator
+ * @param vec Vector to save
+ * @param path Output file
+ * @param shape Array dimensions (default: one dimension of vec.size())
+ * @throws invalid_argument_exception if shape does not cover vec.size() elements
+ * @throws io_exception on write failure
+ */
+template<typename T, typename Alloc>
+void save_npy(const unified_vector<T, Alloc>& vec, const std::string& path,
+              std::vector<size_t> shape = {}) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    if (shape.empty()) shape.push_back(vec.size());
+    npy_header check;
+    check.shape = shape;
+    if (check.count() != vec.size()) {
+        throw invalid_argument_exception("shape", "element count does not match vector size");
+    }
+
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    std::vector<unsigned char> header = detail::make_npy_header<T>(shape);
+
+    detail::file_handle file(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    detail::pwrite_all(file.get(), header.data(), header.size(), 0, path);
+    detail::pwrite_all(file.get(), engine.host_data(), vec.size() * sizeof(T), header.size(), path);
+    file.close(path);
+#else
+    (void)vec;
+    (void)path;
+    (void)shape;
+    throw unsupported_operation_exception("save_npy without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Writer for uncompressed .npz archives
+ *
+ * Each add() appends one array as "<name>.npy", stored without
+ * compression and padded so its payload is 64-byte aligned, which lets
+ * load_npz map it in place. close() writes the archive directory; an
+ * archive not closed is incomplete. Archives are limited to 4 GiB.
+ */
+class npz_writer {
+private:
+    struct entry {
+        std::string name;       ///< Entry name including ".npy"
+        uint32_t crc;           ///< CRC-32 of the entry data
+        uint32_t bytes;         ///< Entry data size
+        uint32_t offset;        ///< Local header offset
+    };
+
+    std::string path_;
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file_;
+#endif
+    std::vector<entry> entries_;
+    size_t offset_;
+    bool closed_;
+
+    static constexpr uint16_t padding_extra_id = 0xD935;  // zipalign's padding field
+
+public:
+    /**
+     * @brief Create or replace an archive
+     * @param path Output file
+     * @throws io_exception if the file cannot be created
+     */
+    explicit npz_writer(const std::string& path)
+        : path_(path)
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        , file_(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644))
+#endif
+        , offset_(0)
+        , closed_(false)
+    {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (file_.get() < 0) throw io_exception(path, std::strerror(errno));
+#else
+        throw unsupported_operation_exception("npz_writer without POSIX file I/O");
+#endif
+    }
+
+    npz_writer(const npz_writer&) = delete;
+    npz_writer& operator=(const npz_writer&) = delete;
+
+    /**
+     * @brief Finish the archive if close() was not called
+     */
+    ~npz_writer() {
+        if (!closed_) {
+            try {
+                close();
+            } catch (...) {
+            }
+        }
+    }
+
+    /**
+     * @brief Append an array
+     * @tparam T Arithmetic element type
+     * @tparam Alloc Vector allocator
+     * @param name Array name (".npy" is appended)
+     * @param vec Vector to store
+     * @param shape Array dimensions (default: one dimension of vec.size())
+     * @throws invalid_argument_exception if shape does not cover vec.size() elements
+     * @throws io_exception on write failure or if the archive would exceed 4 GiB
+     */
+    template<typename T, typename Alloc>
+    void add(const std::string& name, const unified_vector<T, Alloc>& vec, std::vector<size_t> shape = {}) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (closed_) throw unsupported_operation_exception("add to a closed npz_writer");
+        if (shape.empty()) shape.push_back(vec.size());
+        npy_header check;
+        check.shape = shape;
+        if (check.count() != vec.size()) {
+            throw invalid_argument_exception("shape", "element count does not match vector size");
+        }
+
+        auto& engine = vec.get_engine();
+        engine.sync_to_host();
+        std::vector<unsigned char> header = detail::make_npy_header<T>(shape);
+        size_t payload_bytes = vec.size() * sizeof(T);
+        size_t data_bytes = header.size() + payload_bytes;
+
+        entry e;
+        e.name = name + ".npy";
+        size_t extra = (64 - (offset_ + 30 + e.name.size()) % 64) % 64;
+        if (extra > 0 && extra < 4) extra += 64;
+        size_t data_offset = offset_ + 30 + e.name.size() + extra;
+        if (data_offset + data_bytes > 0xFFFFFFFFu) {
+            throw io_exception(path_, "npz archives above 4 GiB are not supported");
+        }
+        e.crc = detail::crc32_update(0, header.data(), header.size());
+        e.crc = detail::crc32_update(e.crc, engine.host_data(), payload_bytes);
+        e.bytes = static_cast<uint32_t>(data_bytes);
+        e.offset = static_cast<uint32_t>(offset_);
+
+        std::vector<unsigned char> local;
+        detail::put_le(local, 0x04034b50u, 4);     // local file header
+        detail::put_le(local, 20, 2);              // version needed
+        detail::put_le(local, 0, 2);               // flags
+        detail::put_le(local, 0, 2);               // stored
+        detail::put_le(local, 0, 2);               // time
+        detail::put_le(local, 0x21, 2);            // date: 1980-01-01
+        detail::put_le(local, e.crc, 4);
+        detail::put_le(local, e.bytes, 4);         // compressed size
+        detail::put_le(local, e.bytes, 4);         // uncompressed size
+        detail::put_le(local, e.name.size(), 2);
+        detail::put_le(local, extra, 2);
+        local.insert(local.end(), e.name.begin(), e.name.end());
+        if (extra > 0) {
+            detail::put_le(local, padding_extra_id, 2);
+            detail::put_le(local, extra - 4, 2);
+            local.resize(local.size() + extra - 4, 0);
+        }
+        local.insert(local.end(), header.begin(), header.end());
+
+        detail::pwrite_all(file_.get(), local.data(), local.size(), offset_, path_);
+        detail::pwrite_all(file_.get(), engine.host_data(), payload_bytes, offset_ + local.size(), path_);
+        offset_ = data_offset + data_bytes;
+        entries_.push_back(e);
+#else
+        (void)name;
+        (void)vec;
+        (void)shape;
+#endif
+    }
+
+    /**
+     * @brief Write the archive directory and close the file
+     * @throws io_exception on write failure
+     */
+    void close() {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+        if (closed_) return;
+        closed_ = true;
+        std::vector<unsigned char> directory;
+        for (const entry& e : entries_) {
+            detail::put_le(directory, 0x02014b50u, 4);     // central directory header
+            detail::put_le(directory, 20, 2);              // version made by
+            detail::put_le(directory, 20, 2);              // version needed
+            detail::put_le(directory, 0, 2);               // flags
+            detail::put_le(directory, 0, 2);               // stored
+            detail::put_le(directory, 0, 2);               // time
+            detail::put_le(directory, 0x21, 2);            // date
+            detail::put_le(directory, e.crc, 4);
+            detail::put_le(directory, e.bytes, 4);
+            detail::put_le(directory, e.bytes, 4);
+            detail::put_le(directory, e.name.size(), 2);
+            detail::put_le(directory, 0, 2);               // extra
+            detail::put_le(directory, 0, 2);               // comment
+            detail::put_le(directory, 0, 2);               // disk
+            detail::put_le(directory, 0, 2);               // internal attributes
+            detail::put_le(directory, 0, 4);               // external attributes
+            detail::put_le(directory, e.offset, 4);
+            directory.insert(directory.end(), e.name.begin(), e.name.end());
+        }
+        if (offset_ + directory.size() > 0xFFFFFFFFu) {
+            throw io_exception(path_, "npz archives above 4 GiB are not supported");
+        }
+        size_t directory_size = directory.size();
+        detail::put_le(directory, 0x06054b50u, 4);         // end of central directory
+        detail::put_le(directory, 0, 2);
+        detail::put_le(directory, 0, 2);
+        detail::put_le(directory, entries_.size(), 2);
+        detail::put_le(directory, entries_.size(), 2);
+        detail::put_le(directory, directory_size, 4);
+        detail::put_le(directory, offset_, 4);
+        detail::put_le(directory, 0, 2);                   // comment length
+
+        detail::pwrite_all(file_.get(), directory.data(), directory.size(), offset_, path_);
+        file_.close(path_);
+#endif
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Location of one .npz entry
+ */
+struct npz_entry {
+    std::string name;           ///< Entry name as stored
+    uint16_t method;            ///< Compression method (0 = stored)
+    uint64_t bytes;             ///< Uncompressed size
+    uint64_t header_offset;     ///< Local header offset
+};
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+/**
+ * @brief Read the central directory of a zip archive (zip64 aware)
+ */
+inline std::vector<npz_entry> read_npz_directory(int fd, const std::string& path) {
+    size_t file_bytes = file_size(fd, path);
+    size_t tail_bytes = std::min<size_t>(file_bytes, 22 + 65535);
+    std::vector<unsigned char> tail(tail_bytes);
+    pread_all(fd, tail.data(), tail_bytes, file_bytes - tail_bytes, path);
+
+    size_t eocd = tail_bytes;
+    for (size_t i = tail_bytes >= 22 ? tail_bytes - 22 + 1 : 0; i-- > 0;) {
+        if (read_le(tail.data() + i, 4) == 0x06054b50u) {
+            eocd = i;
+            break;
+        }
+    }
+    if (eocd == tail_bytes) throw io_exception(path, "not a zip archive");
+
+    uint64_t count = read_le(tail.data() + eocd + 10, 2);
+    uint64_t directory_size = read_le(tail.data() + eocd + 12, 4);
+    uint64_t directory_offset = read_le(tail.data() + eocd + 16, 4);
+
+    // zip64 end-of-directory locator sits immediately before the classic record
+    if (eocd >= 20 && read_le(tail.data() + eocd - 20, 4) == 0x07064b50u) {
+        unsigned char record[56];
+        pread_all(fd, record, sizeof(record), static_cast<size_t>(read_le64(tail.data() + eocd - 12)), path);
+        if (read_le(record, 4) != 0x06064b50u) throw io_exception(path, "corrupt zip64 directory");
+        count = read_le64(record + 32);
+        directory_size = read_le64(record + 40);
+        directory_offset = read_le64(record + 48);
+    }
+    if (directory_offset + directory_size > file_bytes) throw io_exception(path, "corrupt zip directory");
+
+    std::vector<unsigned char> directory(static_cast<size_t>(directory_size));
+    pread_all(fd, directory.data(), directory.size(), static_cast<size_t>(directory_offset), path);
+
+    std::vector<npz_entry> entries;
+    size_t pos = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        if (pos + 46 > directory.size() || read_le(directory.data() + pos, 4) != 0x02014b50u) {
+            throw io_exception(path, "corrupt zip directory");
+        }
+        const unsigned char* h = directory.data() + pos;
+        size_t name_bytes = read_le(h + 28, 2);
+        size_t extra_bytes = read_le(h + 30, 2);
+        size_t comment_bytes = read_le(h + 32, 2);
+        if (pos + 46 + name_bytes + extra_bytes + comment_bytes > directory.size()) {
+            throw io_exception(path, "corrupt zip directory");
+        }
+
+        npz_entry e;
+        e.name.assign(reinterpret_cast<const char*>(h + 46), name_bytes);
+        e.method = static_cast<uint16_t>(read_le(h + 10, 2));
+        e.bytes = read_le(h + 24, 4);
+        uint64_t compressed = read_le(h + 20, 4);
+        e.header_offset = read_le(h + 42, 4);
+
+        // zip64 extra field holds the sizes and offset that overflowed, in order
+        const unsigned char* extra = h + 46 + name_bytes;
+        for (size_t x = 0; x + 4 <= extra_bytes;) {
+            size_t id = read_le(extra + x, 2);
+            size_t len = read_le(extra + x + 2, 2);
+            if (id == 0x0001) {
+                const unsigned char* field = extra + x + 4;
+                const unsigned char* field_end = field + std::min(len, extra_bytes - x - 4);
+                if (e.bytes == 0xFFFFFFFFu && field + 8 <= field_end) {
+                    e.bytes = read_le64(field);
+                    field += 8;
+                }
+                if (compressed == 0xFFFFFFFFu && field + 8 <= field_end) field += 8;
+                if (e.header_offset == 0xFFFFFFFFu && field + 8 <= field_end) {
+                    e.header_offset = read_le64(field);
+                }
+            }
+            x += 4 + len;
+        }
+        entries.push_back(e);
+        pos += 46 + name_bytes + extra_bytes + comment_bytes;
+    }
+    return entries;
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief List the arrays in an .npz archive
+ * @param path .npz file
+ * @return Array names without the ".npy" suffix
+ * @throws io_exception if the file is not a zip archive
+ */
+inline std::vector<std::string> npz_names(const std::string& path) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+    std::vector<std::string> names;
+    for (const auto& e : detail::read_npz_directory(file.get(), path)) {
+        std::string name = e.name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".npy") == 0) name.resize(name.size() - 4);
+        names.push_back(name);
+    }
+    return names;
+#else
+    (void)path;
+    throw unsupported_operation_exception("npz_names without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Load one array of an uncompressed .npz archive
+ *
+ * The entry's payload is mapped in place like load_npy. numpy.savez
+ * stores entries without aligning them, so a payload misaligned for T is
+ * read into ordinary memory instead; npz_writer aligns every entry.
+ *
+ * @tparam T Element type matching the array's dtype
+ * @param path .npz file
+ * @param name Array name, with or without ".npy"
+ * @param options Load settings
+ * @return Vector holding the array's elements
+ * @throws io_exception if the array is missing, compressed or of another dtype
+ */
+template<typename T>
+unified_vector<T> load_npz(const std::string& path, const std::string& name,
+                           const npy_load_options& options = npy_load_options()) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+
+    for (const auto& e : detail::read_npz_directory(file.get(), path)) {
+        if (e.name != name && e.name != name + ".npy") continue;
+        if (e.method != 0) {
+            throw io_exception(path, "array '" + name + "' is compressed and cannot be mapped");
+        }
+        unsigned char local[30];
+        detail::pread_all(file.get(), local, sizeof(local), static_cast<size_t>(e.header_offset), path);
+        if (detail::read_le(local, 4) != 0x04034b50u) throw io_exception(path, "corrupt zip entry");
+        size_t data_offset = static_cast<size_t>(e.header_offset) + 30 +
+                             detail::read_le(local + 26, 2) + detail::read_le(local + 28, 2);
+        return detail::map_npy_array<T>(file.get(), path, data_offset, static_cast<size_t>(e.bytes), options);
+    }
+    throw io_exception(path, "no array named '" + name + "'");
+#else
+    (void)path;
+    (void)name;
+    (void)options;
+    throw unsupported_operation_exception("load_npz without POSIX file I/O");
+#endif
+}
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_IO_NPY_HPP
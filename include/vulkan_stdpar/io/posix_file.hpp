@@ -0,0 +1,156 @@
+/**
+ * @file posix_file.hpp
+ * @brief Small POSIX file helpers shared by the I/O headers
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains an owning file descriptor, a read-only whole-file
+ * mapping, and positioned read/write loops that retry short transfers and
+ * report failures as io_exception.
+ */
+
+#ifndef VULKAN_STDPAR_IO_POSIX_FILE_HPP
+#define VULKAN_STDPAR_IO_POSIX_FILE_HPP
+
+#include "../core/exceptions.hpp"
+#include "../core/host_storage.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Largest single pwrite issued by the I/O writers, in bytes
+ */
+#ifndef VULKAN_STDPAR_FILE_WRITE_BYTES
+#define VULKAN_STDPAR_FILE_WRITE_BYTES (size_t(64) * 1024 * 1024)
+#endif
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+namespace detail {
+
+#ifdef VULKAN_STDPAR_HAS_MMAP
+inline size_t file_page_size() {
+    static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/**
+ * @brief Write all bytes at offset, retrying short writes
+ */
+inline void pwrite_all(int fd, const void* data, size_t bytes, size_t offset, const std::string& path) {
+    const char* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        size_t chunk = std::min(bytes, VULKAN_STDPAR_FILE_WRITE_BYTES);
+        ssize_t written = ::pwrite(fd, p, chunk, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw io_exception(path, std::strerror(errno));
+        }
+        p += written;
+        offset += static_cast<size_t>(written);
+        bytes -= static_cast<size_t>(written);
+    }
+}
+
+/**
+ * @brief Read all bytes at offset, failing on a short file
+ */
+inline void pread_all(int fd, void* data, size_t bytes, size_t offset, const std::string& path) {
+    char* p = static_cast<char*>(data);
+    while (bytes > 0) {
+        ssize_t got = ::pread(fd, p, bytes, static_cast<off_t>(offset));
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            throw io_exception(path, std::strerror(errno));
+        }
+        if (got == 0) throw io_exception(path, "unexpected end of file");
+        p += got;
+        offset += static_cast<size_t>(got);
+        bytes -= static_cast<size_t>(got);
+    }
+}
+
+/**
+ * @brief File descriptor closed on scope exit
+ */
+class file_handle {
+private:
+    int fd_;
+
+public:
+    explicit file_handle(int fd) : fd_(fd) {}
+    ~file_handle() { if (fd_ >= 0) ::close(fd_); }
+    file_handle(const file_handle&) = delete;
+    file_handle& operator=(const file_handle&) = delete;
+    int get() const noexcept { return fd_; }
+
+    /**
+     * @brief Close now, reporting errors (deferred write failures surface here)
+     */
+    void close(const std::string& path) {
+        int fd = fd_;
+        fd_ = -1;
+        if (::close(fd) != 0) throw io_exception(path, std::strerror(errno));
+    }
+};
+
+/**
+ * @brief Read-only mapping of a whole file, unmapped on scope exit
+ */
+class mapped_file {
+private:
+    const char* data_;
+    size_t size_;
+
+public:
+    /**
+     * @brief Map a file for sequential reading
+     * @param path File to map
+     * @throws io_exception if the file cannot be opened or mapped
+     */
+    explicit mapped_file(const std::string& path) : data_(nullptr), size_(0) {
+        file_handle file(::open(path.c_str(), O_RDONLY));
+        if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+        struct stat info;
+        if (::fstat(file.get(), &info) != 0) throw io_exception(path, std::strerror(errno));
+        size_ = static_cast<size_t>(info.st_size);
+        if (size_ == 0) return;
+
+        void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+        if (ptr == MAP_FAILED) throw io_exception(path, std::strerror(errno));
+        ::madvise(ptr, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(ptr);
+    }
+
+    ~mapped_file() {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const char* data() const noexcept { return data_; }
+    size_t size() const noexcept { return size_; }
+};
+#endif
+
+} // namespace detail
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_IO_POSIX_FILE_HPP
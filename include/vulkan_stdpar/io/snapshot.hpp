@@ -0,0 +1,276 @@
+/**
+ * @file snapshot.hpp
+ * @brief Versioned binary snapshots of unified_vector with zero-copy reload
+ * @author Vulkan STD-Parallel Team
+ * @version 1.0
+ * @date 2025-12-02
+ *
+ * This file contains save_snapshot and load_snapshot. A snapshot is a
+ * fixed header followed, at a page-aligned offset, by the raw elements.
+ * Saving writes host data with a few large pwrite calls; loading maps the
+ * payload and adopts the mapping as the vector's host storage, so pages
+ * are read from disk on first use and never copied.
+ */
+
+#ifndef VULKAN_STDPAR_IO_SNAPSHOT_HPP
+#define VULKAN_STDPAR_IO_SNAPSHOT_HPP
+
+#include "../containers/unified_vector.hpp"
+#include "../core/exceptions.hpp"
+#include "posix_file.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vulkan_stdpar {
+
+namespace io {
+
+/**
+ * @brief Snapshot format version written by this library
+ */
+constexpr uint32_t snapshot_version = 1;
+
+/**
+ * @brief Element type tag stored in snapshot headers
+ *
+ * Arithmetic types get a tag from their kind and size, so a snapshot of
+ * int32_t is not loaded as float. Other types get 0, which only checks
+ * the element size; specialize this trait to give them a tag.
+ *
+ * @tparam T Element type
+ */
+template<typename T>
+struct snapshot_type_tag {
+    static constexpr uint32_t kind =
+        std::is_same<T, bool>::value ? 4u :
+        std::is_floating_point<T>::value ? 3u :
+        std::is_integral<T>::value && std::is_unsigned<T>::value ? 2u :
+        std::is_integral<T>::value ? 1u : 0u;
+    static constexpr uint32_t value = kind == 0 ? 0u : (kind << 16) | uint32_t(sizeof(T));
+};
+
+/**
+ * @brief On-disk snapshot header (little-endian host layout)
+ */
+struct snapshot_header {
+    char magic[8];              ///< "VKSPSNAP"
+    uint32_t version;           ///< Format version
+    uint32_t byte_order;        ///< 0x01020304 as written by the producer
+    uint64_t payload_offset;    ///< File offset of the first element
+    uint64_t element_count;     ///< Number of elements
+    uint32_t element_size;      ///< sizeof(T)
+    uint32_t type_tag;          ///< snapshot_type_tag<T>::value
+    uint64_t checksum;          ///< Payload checksum (valid if has_checksum)
+    uint32_t has_checksum;      ///< Nonzero if checksum was computed
+    uint32_t reserved[5];       ///< Zero
+
+    snapshot_header()
+        : magic{}, version(0), byte_order(0), payload_offset(0), element_count(0)
+        , element_size(0), type_tag(0), checksum(0), has_checksum(0), reserved{}
+    {}
+};
+
+static_assert(sizeof(snapshot_header) == 72, "snapshot_header layout changed");
+
+/**
+ * @brief Options for save_snapshot
+ */
+struct snapshot_options {
+    bool checksum;          ///< Store a payload checksum
+    bool sync;              ///< fsync before returning
+    size_t alignment;       ///< Payload alignment (0 uses the page size)
+
+    snapshot_options() : checksum(true), sync(false), alignment(0) {}
+};
+
+/**
+ * @brief Options for load_snapshot
+ */
+struct snapshot_load_options {
+    bool verify_checksum;   ///< Check the stored checksum (reads every page once)
+
+    snapshot_load_options() : verify_checksum(true) {}
+};
+
+namespace detail {
+
+constexpr char snapshot_magic[8] = {'V', 'K', 'S', 'P', 'S', 'N', 'A', 'P'};
+constexpr uint32_t snapshot_byte_order = 0x01020304u;
+
+/**
+ * @brief 64-bit FNV-1a over 8-byte words, then trailing bytes
+ *
+ * Word-at-a-time keeps the checksum well above disk bandwidth; it detects
+ * truncation and corruption, not tampering.
+ */
+inline uint64_t snapshot_checksum(const void* data, size_t bytes) {
+    const uint64_t prime = 0x100000001b3ull;
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    size_t words = bytes / 8;
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t word;
+        std::memcpy(&word, p + i * 8, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = words * 8; i < bytes; ++i) {
+        hash = (hash ^ p[i]) * prime;
+    }
+    return hash;
+}
+
+
+} // namespace detail
+
+/**
+ * @brief Read and validate a snapshot header
+ * @param path Snapshot file
+ * @return Header
+ * @throws io_exception if the file cannot be read or is not a valid snapshot
+ */
+inline snapshot_header read_snapshot_header(const std::string& path) {
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    detail::file_handle file(::open(path.c_str(), O_RDONLY));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+
+    snapshot_header header;
+    detail::pread_all(file.get(), &header, sizeof(header), 0, path);
+    if (std::memcmp(header.magic, detail::snapshot_magic, sizeof(header.magic)) != 0) {
+        throw io_exception(path, "not a snapshot file");
+    }
+    if (header.version > snapshot_version) {
+        throw io_exception(path, "snapshot version " + std::to_string(header.version) +
+                                 " is newer than supported version " +
+                                 std::to_string(snapshot_version));
+    }
+    if (header.byte_order != detail::snapshot_byte_order) {
+        throw io_exception(path, "snapshot was written with a different byte order");
+    }
+
+    struct stat info;
+    if (::fstat(file.get(), &info) != 0) throw io_exception(path, std::strerror(errno));
+    uint64_t payload = header.element_count * header.element_size;
+    if (header.payload_offset < sizeof(header) ||
+        static_cast<uint64_t>(info.st_size) != header.payload_offset + payload) {
+        throw io_exception(path, "snapshot is truncated or has trailing data");
+    }
+    return header;
+#else
+    (void)path;
+    throw unsupported_operation_exception("read_snapshot_header without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Write a vector to a snapshot file, replacing it
+ *
+ * Device-side modifications are synchronized first. The payload starts at
+ * a page-aligned offset so load_snapshot can map it in place.
+ *
+ * @tparam T Trivially copyable element type
+ * @tparam Alloc Vector allocator
+ * @param vec Vector to save
+ * @param path Output file
+ * @param options Checksum, sync and alignment settings
+ * @throws io_exception on write failure
+ */
+template<typename T, typename Alloc>
+void save_snapshot(const unified_vector<T, Alloc>& vec, const std::string& path,
+                   const snapshot_options& options = snapshot_options()) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Snapshots require trivially copyable elements");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    auto& engine = vec.get_engine();
+    engine.sync_to_host();
+    const T* data = engine.host_data();
+    size_t bytes = vec.size() * sizeof(T);
+
+    size_t alignment = std::max(options.alignment, detail::file_page_size());
+    snapshot_header header;
+    std::memcpy(header.magic, detail::snapshot_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.byte_order = detail::snapshot_byte_order;
+    header.payload_offset = (sizeof(header) + alignment - 1) / alignment * alignment;
+    header.element_count = vec.size();
+    header.element_size = sizeof(T);
+    header.type_tag = snapshot_type_tag<T>::value;
+    if (options.checksum) {
+        header.checksum = detail::snapshot_checksum(data, bytes);
+        header.has_checksum = 1;
+    }
+
+    detail::file_handle file(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    if (file.get() < 0) throw io_exception(path, std::strerror(errno));
+
+    // Header block is zero padded up to the payload
+    std::vector<char> block(header.payload_offset, 0);
+    std::memcpy(block.data(), &header, sizeof(header));
+    detail::pwrite_all(file.get(), block.data(), block.size(), 0, path);
+    detail::pwrite_all(file.get(), data, bytes, header.payload_offset, path);
+
+    if (options.sync && ::fsync(file.get()) != 0) throw io_exception(path, std::strerror(errno));
+    file.close(path);
+#else
+    (void)vec;
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("save_snapshot without POSIX file I/O");
+#endif
+}
+
+/**
+ * @brief Load a snapshot into a vector backed by the file
+ *
+ * The payload is mapped copy-on-write and adopted as host storage: the
+ * file is never modified and pages are read on first access.
+ *
+ * @tparam T Element type the snapshot was saved with
+ * @param path Snapshot file
+ * @param options Load settings
+ * @return Vector holding the snapshot's elements
+ * @throws io_exception if the file is invalid, of another element type,
+ *         or fails checksum verification
+ */
+template<typename T>
+unified_vector<T> load_snapshot(const std::string& path,
+                                const snapshot_load_options& options = snapshot_load_options()) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Snapshots require trivially copyable elements");
+#ifdef VULKAN_STDPAR_HAS_MMAP
+    snapshot_header header = read_snapshot_header(path);
+    if (header.element_size != sizeof(T) ||
+        (header.type_tag != 0 && snapshot_type_tag<T>::value != 0 &&
+         header.type_tag != snapshot_type_tag<T>::value)) {
+        throw io_exception(path, "snapshot element type does not match");
+    }
+
+    if (header.payload_offset % alignof(T) != 0) {
+        throw io_exception(path, "snapshot payload is not aligned for the element type");
+    }
+
+    size_t count = static_cast<size_t>(header.element_count);
+    auto vec = unified_vector<T>::map_file(path, map_mode::read_only,
+                                           static_cast<size_t>(header.payload_offset));
+
+    if (options.verify_checksum && header.has_checksum &&
+        detail::snapshot_checksum(vec.get_engine().host_data(), count * sizeof(T)) != header.checksum) {
+        throw io_exception(path, "snapshot checksum mismatch");
+    }
+    return vec;
+#else
+    (void)path;
+    (void)options;
+    throw unsupported_operation_exception("load_snapshot without POSIX file I/O");
+#endif
+}
+
+} // namespace io
+
+} // namespace vulkan_stdpar
+
+#endif // VULKAN_STDPAR_IO_SNAPSHOT_HPP
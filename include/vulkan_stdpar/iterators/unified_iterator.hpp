@@ -12,20 +12,20 @@
 #ifndef VULKAN_STDPAR_ITERATORS_UNIFIED_ITERATOR_HPP
 #define VULKAN_STDPAR_ITERATORS_UNIFIED_ITERATOR_HPP
 
+#include "../core/exceptions.hpp"
+#include "../containers/fwd.hpp"
+#include <cstdint>
 #include <iterator>
 #include <type_traits>
 
 namespace vulkan_stdpar {
 
-// Forward declarations
-template<typename T> class unified_vector;
-template<typename T> class unified_reference;
-
 /**
  * @brief Mutable iterator for unified_vector
  * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
  */
-template<typename T>
+template<typename T, typename Alloc>
 class unified_iterator {
 public:
     // Iterator traits
@@ -33,15 +33,15 @@ public:
     using value_type = T;
     using difference_type = ptrdiff_t;
     using pointer = void;  // Disabled to prevent pointer escape
-    using reference = unified_reference<T>;
+    using reference = unified_reference<T, Alloc>;
     
 private:
-    unified_vector<T>* container_;    ///< Parent container
+    unified_vector<T, Alloc>* container_;    ///< Parent container
     size_t index_;                     ///< Current position
     
     // Friend declarations
-    template<typename U> friend class unified_vector;
-    template<typename U> friend class const_unified_iterator;
+    template<typename U, typename A> friend class unified_vector;
+    template<typename U, typename A> friend class const_unified_iterator;
     
 public:
     /**
@@ -54,7 +54,7 @@ public:
      * @param container Parent container
      * @param index Start position
      */
-    unified_iterator(unified_vector<T>* container, size_t index)
+    unified_iterator(unified_vector<T, Alloc>* container, size_t index)
         : container_(container), index_(index)
     {}
     
@@ -216,16 +216,24 @@ public:
      * @brief Get container pointer
      * @return Pointer to container
      */
-    unified_vector<T>* get_container() const {
+    unified_vector<T, Alloc>* get_container() const {
         return container_;
     }
 };
 
 /**
  * @brief Const iterator for unified_vector
+ * 
+ * Const iterators are snapshot iterators: the container is synchronized to
+ * the host once when the iterator is created, and dereferencing reads the
+ * host copy through a raw pointer with no locking. With VULKAN_STDPAR_DEBUG
+ * defined, dereferencing an iterator whose snapshot was invalidated (by
+ * reallocation or a device-side write) throws.
+ * 
  * @tparam T Element type
+ * @tparam Alloc Allocator of the parent container
  */
-template<typename T>
+template<typename T, typename Alloc>
 class const_unified_iterator {
 public:
     // Iterator traits
@@ -236,33 +244,47 @@ public:
     using reference = const T&;
     
 private:
-    const unified_vector<T>* container_;    ///< Parent container
+    const unified_vector<T, Alloc>* container_;    ///< Parent container
     size_t index_;                           ///< Current position
+    const T* data_;                          ///< Host snapshot of container data
+#ifdef VULKAN_STDPAR_DEBUG
+    uint64_t epoch_;                         ///< Host epoch at snapshot time
+#endif
     
     // Friend declarations
-    template<typename U> friend class unified_vector;
+    template<typename U, typename A> friend class unified_vector;
     
 public:
     /**
      * @brief Default constructor
      */
-    const_unified_iterator() : container_(nullptr), index_(0) {}
+    const_unified_iterator()
+        : container_(nullptr), index_(0), data_(nullptr)
+#ifdef VULKAN_STDPAR_DEBUG
+        , epoch_(0)
+#endif
+    {}
     
     /**
-     * @brief Construct const iterator
+     * @brief Construct const iterator (synchronizes container to host)
      * @param container Parent container
      * @param index Start position
      */
-    const_unified_iterator(const unified_vector<T>* container, size_t index)
-        : container_(container), index_(index)
-    {}
+    const_unified_iterator(const unified_vector<T, Alloc>* container, size_t index)
+        : container_(container), index_(index), data_(nullptr)
+#ifdef VULKAN_STDPAR_DEBUG
+        , epoch_(0)
+#endif
+    {
+        snapshot();
+    }
     
     /**
-     * @brief Construct from mutable iterator
+     * @brief Construct from mutable iterator (synchronizes container to host)
      * @param other Mutable iterator
      */
-    const_unified_iterator(const unified_iterator<T>& other)
-        : container_(other.get_container()), index_(other.get_index())
+    const_unified_iterator(const unified_iterator<T, Alloc>& other)
+        : const_unified_iterator(other.get_container(), other.get_index())
     {}
     
     /**
@@ -280,16 +302,27 @@ public:
      * @return Const reference to current element
      */
     reference operator*() const {
-        return (*container_)[index_];
+        check_snapshot();
+        return data_[index_];
     }
     
     /**
-     * @brief Subscr operator
+     * @brief Member access operator
+     * @return Const pointer to current element
+     */
+    pointer operator->() const {
+        check_snapshot();
+        return data_ + index_;
+    }
+    
+    /**
+     * @brief Subscript operator
      * @param n Offset
      * @return Const reference to element at offset
      */
     reference operator[](difference_type n) const {
-        return (*container_)[index_ + n];
+        check_snapshot();
+        return data_[index_ + n];
     }
     
     // ==================== Increment/Decrement ====================
@@ -329,11 +362,15 @@ public:
     }
     
     const_unified_iterator operator+(difference_type n) const {
-        return const_unified_iterator(container_, index_ + n);
+        const_unified_iterator result = *this;
+        result.index_ += n;
+        return result;
     }
     
     const_unified_iterator operator-(difference_type n) const {
-        return const_unified_iterator(container_, index_ - n);
+        const_unified_iterator result = *this;
+        result.index_ -= n;
+        return result;
     }
     
     difference_type operator-(const const_unified_iterator& other) const {
@@ -370,9 +407,34 @@ public:
         return index_;
     }
     
-    const unified_vector<T>* get_container() const {
+    const unified_vector<T, Alloc>* get_container() const {
         return container_;
     }
+    
+private:
+    /**
+     * @brief Synchronize the container once and capture its host pointer
+     */
+    void snapshot() {
+        if (!container_) return;
+        const auto& engine = container_->get_engine();
+        // An empty range is never dereferenced; skip the engine lock
+        if (!container_->empty()) {
+            engine.sync_to_host();
+            data_ = engine.host_data();
+        }
+#ifdef VULKAN_STDPAR_DEBUG
+        epoch_ = engine.host_epoch();
+#endif
+    }
+    
+    /**
+     * @brief Verify the snapshot is still valid (debug builds only)
+     */
+    void check_snapshot() const {
+        VULKAN_STDPAR_ASSERT(container_ && epoch_ == container_->get_engine().host_epoch(),
+                             "const_unified_iterator used after its snapshot was invalidated");
+    }
 };
 
 // ==================== Non-member Operators ====================
@@ -380,18 +442,18 @@ public:
 /**
  * @brief Add offset to iterator (reversed operands)
  */
-template<typename T>
-unified_iterator<T> operator+(typename unified_iterator<T>::difference_type n, 
-                              const unified_iterator<T>& it) {
+template<typename T, typename Alloc>
+unified_iterator<T, Alloc> operator+(typename unified_iterator<T, Alloc>::difference_type n, 
+                                     const unified_iterator<T, Alloc>& it) {
     return it + n;
 }
 
 /**
  * @brief Add offset to const iterator (reversed operands)
  */
-template<typename T>
-const_unified_iterator<T> operator+(typename const_unified_iterator<T>::difference_type n,
-                                    const const_unified_iterator<T>& it) {
+template<typename T, typename Alloc>
+const_unified_iterator<T, Alloc> operator+(typename const_unified_iterator<T, Alloc>::difference_type n,
+                                           const const_unified_iterator<T, Alloc>& it) {
     return it + n;
 }
 
@@ -400,105 +462,152 @@ const_unified_iterator<T> operator+(typename const_unified_iterator<T>::differen
 // Implementation of unified_vector iterator member functions
 namespace vulkan_stdpar {
 
-template<typename T>
-typename unified_vector<T>::iterator unified_vector<T>::begin() noexcept {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator unified_vector<T, Alloc>::begin() noexcept {
     return iterator(this, 0);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::begin() const noexcept {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::begin() const {
     return const_iterator(this, 0);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::cbegin() const noexcept {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::cbegin() const {
     return const_iterator(this, 0);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator unified_vector<T>::end() noexcept {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator unified_vector<T, Alloc>::end() noexcept {
     return iterator(this, size_);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::end() const noexcept {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::end() const {
     return const_iterator(this, size_);
 }
 
-template<typename T>
-typename unified_vector<T>::const_iterator unified_vector<T>::cend() const noexcept {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::const_iterator unified_vector<T, Alloc>::cend() const {
     return const_iterator(this, size_);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::insert(const_iterator pos, const T& value) {
-    size_type insert_pos = pos.get_index();
-    if (size_ >= capacity()) {
-        reserve(capacity() == 0 ? 1 : capacity() * 2);
-    }
-    
-    // Shift elements right
-    engine_.sync_to_host();
-    std::copy_backward(data_impl() + insert_pos, data_impl() + size_, 
-                      data_impl() + size_ + 1);
-    data_impl()[insert_pos] = value;
-    engine_.mark_host_dirty(insert_pos, size_ + 1);
-    ++size_;
-    
-    return iterator(this, insert_pos);
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_value(size_type pos, T&& value) {
+    bool on_device = open_gap(pos, 1);
+    data_impl()[pos] = std::move(value);
+    if (on_device) engine_->upload_range(pos, pos + 1);
+    
+    return iterator(this, pos);
+}
+
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_fill(size_type pos, size_type count, const T& value) {
+    if (count == 0) return iterator(this, pos);
+    
+    // value may refer into this vector; the gap can move or overwrite it
+    T copy = value;
+    bool on_device = open_gap(pos, count);
+    std::fill_n(data_impl() + pos, count, copy);
+    if (on_device) engine_->upload_range(pos, pos + count);
+    
+    return iterator(this, pos);
+}
+
+template<typename T, typename Alloc>
+template<typename InputIt>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_range(size_type pos, InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    
+    if constexpr (std::is_same<InputIt, iterator>::value || std::is_same<InputIt, const_iterator>::value) {
+        // Another unified_vector: bulk copy, on the device where possible
+        size_type count = static_cast<size_type>(last.get_index() - first.get_index());
+        return insert_from(pos, *first.get_container(), first.get_index(), count);
+    } else if constexpr (!std::is_base_of<std::forward_iterator_tag, category>::value) {
+        // Single pass: the length is only known after reading
+        std::vector<T> buffer(first, last);
+        return insert_range(pos, buffer.begin(), buffer.end());
+    } else {
+        size_type count = static_cast<size_type>(std::distance(first, last));
+        if (count == 0) return iterator(this, pos);
+        
+        bool on_device = open_gap(pos, count);
+        std::copy_n(first, count, data_impl() + pos);
+        if (on_device) engine_->upload_range(pos, pos + count);
+        
+        return iterator(this, pos);
+    }
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::insert(const_iterator pos, T&& value) {
-    size_type insert_pos = pos.get_index();
-    if (size_ >= capacity()) {
-        reserve(capacity() == 0 ? 1 : capacity() * 2);
-    }
-    
-    // Shift elements right
-    engine_.sync_to_host();
-    std::copy_backward(data_impl() + insert_pos, data_impl() + size_,
-                      data_impl() + size_ + 1);
-    data_impl()[insert_pos] = std::move(value);
-    engine_.mark_host_dirty(insert_pos, size_ + 1);
-    ++size_;
-    
-    return iterator(this, insert_pos);
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::insert_from(size_type pos, const unified_vector& source,
+                                      size_type start, size_type count) {
+    if (count == 0) return iterator(this, pos);
+    if (&source == this) {
+        // The gap would move the source elements; copy them out first
+        engine_->sync_to_host();
+        std::vector<T> buffer(data_impl() + start, data_impl() + start + count);
+        return insert_range(pos, buffer.begin(), buffer.end());
+    }
+    
+    if (size_ == 0) {
+        // Nothing to keep: an empty vector can take device data as is
+        detach(count, false);
+        reserve(count);
+        if (engine_->copy_device_from(*source.engine_, count, 0, start)) {
+            size_ = count;
+            return iterator(this, 0);
+        }
+    }
+    
+    bool on_device = open_gap(pos, count);
+    if (on_device && engine_->copy_device_from(*source.engine_, count, pos, start)) {
+        return iterator(this, pos);
+    }
+    source.engine_->sync_to_host();
+    std::copy_n(source.data_impl() + start, count, data_impl() + pos);
+    if (on_device) engine_->upload_range(pos, pos + count);
+    
+    return iterator(this, pos);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::erase(const_iterator pos) {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::erase(const_iterator pos) {
     size_type erase_pos = pos.get_index();
-    engine_.sync_to_host();
+    detach();
+    engine_->sync_to_host();
     
     // Shift elements left
     std::copy(data_impl() + erase_pos + 1, data_impl() + size_,
              data_impl() + erase_pos);
     --size_;
-    engine_.mark_host_dirty(erase_pos, size_);
+    engine_->mark_host_dirty(erase_pos, size_);
     
     return iterator(this, erase_pos);
 }
 
-template<typename T>
-typename unified_vector<T>::iterator 
-unified_vector<T>::erase(const_iterator first, const_iterator last) {
+template<typename T, typename Alloc>
+typename unified_vector<T, Alloc>::iterator 
+unified_vector<T, Alloc>::erase(const_iterator first, const_iterator last) {
     size_type first_pos = first.get_index();
     size_type last_pos = last.get_index();
     size_type count = last_pos - first_pos;
     
     if (count == 0) return iterator(this, first_pos);
     
-    engine_.sync_to_host();
+    detach();
+    engine_->sync_to_host();
     
     // Shift elements left
     std::copy(data_impl() + last_pos, data_impl() + size_,
              data_impl() + first_pos);
     size_ -= count;
-    engine_.mark_host_dirty(first_pos, size_);
+    engine_->mark_host_dirty(first_pos, size_);
     
     return iterator(this, first_pos);
 }
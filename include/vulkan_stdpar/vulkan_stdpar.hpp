@@ -20,17 +20,32 @@
 #define VULKAN_STDPAR_VULKAN_STDPAR_HPP
 
 // Core components
+#include "core/host_storage.hpp"
+#include "core/memory_management.hpp"
 #include "core/versioning_engine.hpp"
 #include "core/device_selection.hpp"
 #include "core/profiling.hpp"
+#include "core/device_cache.hpp"
+#include "core/residency.hpp"
+#include "core/staging.hpp"
+#include "core/thread_pool.hpp"
+#include "core/numa.hpp"
 #include "core/exceptions.hpp"
 
 // Containers
+#include "containers/fwd.hpp"
 #include "containers/unified_vector.hpp"
+#include "containers/host_view.hpp"
+
+// File I/O
+#include "io/snapshot.hpp"
+#include "io/npy.hpp"
+#include "io/csv.hpp"
 
 // Iterators (included by unified_vector.hpp)
 
 // Algorithms
+#include "algorithms/std_overloads.hpp"
 #include "algorithms/parallel_invoker.hpp"
 
 // Main namespace
@@ -29,24 +29,33 @@ def read_header(file_path, processed=None):
     
     processed.add(file_path)
     
-    content_lines = []
     with open(file_path, 'r') as f:
-        in_header_guard = False
-        for line in f:
-            # Skip include guards
-            if '#ifndef' in line or '#define' in line:
-                if any(guard in line for guard in ['_HPP', '_H']):
-                    in_header_guard = True
-                    continue
-            if in_header_guard and '#endif' in line:
-                in_header_guard = False
-                continue
-            
-            # Skip local includes (we'll resolve dependencies)
-            if re.match(r'#include\s+"', line):
-                continue
-            
-            content_lines.append(line)
+        lines = f.readlines()
+    
+    # Skip the include guard: "#ifndef X_HPP", "#define X_HPP" and the
+    # file's last #endif. Other #ifndef/#define pairs (configuration
+    # macros such as VULKAN_STDPAR_HOST_ALIGNMENT) are kept.
+    guard_lines = set()
+    for i, line in enumerate(lines):
+        match = re.match(r'#ifndef\s+(\w+_HPP)\s*$', line)
+        if match and i + 1 < len(lines) and re.match(r'#define\s+' + match.group(1) + r'\s*$', lines[i + 1]):
+            guard_lines.update((i, i + 1))
+            for j in range(len(lines) - 1, i + 1, -1):
+                if lines[j].startswith('#endif'):
+                    guard_lines.add(j)
+                    break
+            break
+    
+    content_lines = []
+    for i, line in enumerate(lines):
+        if i in guard_lines:
+            continue
+        
+        # Skip local includes (we'll resolve dependencies)
+        if re.match(r'#include\s+"', line):
+            continue
+        
+        content_lines.append(line)
     
     return ''.join(content_lines)
 
@@ -59,14 +68,29 @@ def bundle_headers(include_dir, output_file):
         # Core infrastructure first
         'core/exceptions.hpp',
         'core/profiling.hpp',
-        'core/versioning_engine.hpp',
         'core/device_selection.hpp',
+        'core/device_cache.hpp',
+        'core/residency.hpp',
+        'core/staging.hpp',
+        'core/numa.hpp',
+        'core/thread_pool.hpp',
+        'core/memory_management.hpp',
+        'core/host_storage.hpp',
+        'core/versioning_engine.hpp',
         # Containers
+        'containers/fwd.hpp',
         'containers/unified_reference.hpp',
         'containers/unified_vector.hpp',
+        'containers/host_view.hpp',
         # Iterators
         'iterators/unified_iterator.hpp',
+        # I/O
+        'io/posix_file.hpp',
+        'io/snapshot.hpp',
+        'io/npy.hpp',
+        'io/csv.hpp',
         # Algorithms
+        'algorithms/std_overloads.hpp',
         'algorithms/parallel_invoker.hpp',
     ]
     